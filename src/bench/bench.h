@@ -0,0 +1,82 @@
+/* extend - expansible programming language
+ * Copyright (C) 2022 Vladimir Liutov vs@lutov.net
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/** Benchmark harness of *.bench.cpp files.
+ *
+ * Every lib or executable with *.bench.cpp gets bench.lib.NAME or
+ * bench.exe.NAME target built with main.cpp of this directory:
+ *
+ *   EXTEND_BENCH("OStream << int32_t")
+ *   {
+ *     for (uint64_t i = 0; i < iterations; ++i) {
+ *       info << 42;
+ *     }
+ *   }
+ *
+ * The body runs the operation the given count of times. The count grows
+ * until a run takes long enough to measure, then the median of a few runs
+ * is reported as ns/op, along with heap allocations per op.
+ */
+
+#pragma once
+
+#include <cinttypes>
+
+namespace extend::bench {
+
+/** Registered benchmark, see EXTEND_BENCH.
+ */
+struct Benchmark
+{
+  using Function = void (*)(uint64_t iterations);
+
+  const char* name;
+  Function run;
+  const Benchmark* next;
+
+  Benchmark(const char* name, Function run);
+};
+
+/** Keep the value, so the compiler does not remove its computation.
+ */
+template<typename T>
+inline void
+keep(const T& value)
+{
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/** Count of heap allocations in the process so far.
+ */
+uint64_t
+allocations();
+
+}
+
+#define EXTEND_BENCH_CONCAT_IMPL(a, b) a##b
+#define EXTEND_BENCH_CONCAT(a, b) EXTEND_BENCH_CONCAT_IMPL(a, b)
+#define EXTEND_BENCH_IMPL(name, id)                                            \
+  static void EXTEND_BENCH_CONCAT(bench_, id)(uint64_t iterations);            \
+  static const ::extend::bench::Benchmark EXTEND_BENCH_CONCAT(bench_info_,     \
+                                                              id)(             \
+    name, &EXTEND_BENCH_CONCAT(bench_, id));                                   \
+  static void EXTEND_BENCH_CONCAT(bench_, id)(                                 \
+    [[maybe_unused]] uint64_t iterations)
+
+/** Define benchmark, the body gets uint64_t iterations.
+ */
+#define EXTEND_BENCH(name) EXTEND_BENCH_IMPL(name, __COUNTER__)
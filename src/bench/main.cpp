@@ -0,0 +1,409 @@
+/* extend - expansible programming language
+ * Copyright (C) 2022 Vladimir Liutov vs@lutov.net
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/** Run benchmarks of the executable, write results as JSON and compare them
+ * with the baseline.
+ *
+ * Usage: bench.lib.NAME [--filter TEXT] [--json FILE] [--baseline FILE]
+ *                       [--tolerance FRACTION] [--samples N] [--min-time MS]
+ *
+ * Exit code is 1 if any benchmark is slower than the baseline by more than
+ * the tolerance or allocates more.
+ */
+
+#include <EASTL/algorithm.h>
+#include <EASTL/atomic.h>
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <new>
+
+#include "bench.h"
+
+namespace {
+eastl::atomic<uint64_t> allocation_count{ 0 };
+const extend::bench::Benchmark* benchmarks = nullptr;
+
+struct Result
+{
+  eastl::string name;
+  double ns_per_op = 0;
+  double allocations_per_op = 0;
+  uint64_t iterations = 0;
+};
+
+struct Options
+{
+  const char* filter = nullptr;
+  const char* json = nullptr;
+  const char* baseline = nullptr;
+  double tolerance = 0.2;
+  unsigned samples = 5;
+  int64_t min_time_ns = 50000000;
+};
+
+void*
+allocate(size_t size, size_t alignment = 0)
+{
+  allocation_count.fetch_add(1, eastl::memory_order_relaxed);
+  void* p = alignment == 0
+              ? malloc(size == 0 ? 1 : size)
+              : aligned_alloc(alignment, (size + alignment - 1) / alignment *
+                                           alignment);
+  if (p == nullptr) {
+    abort();
+  }
+  return p;
+}
+
+int64_t
+now_ns()
+{
+  timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return time.tv_sec * 1000000000 + time.tv_nsec;
+}
+
+int64_t
+time_run(const extend::bench::Benchmark& benchmark, uint64_t iterations)
+{
+  const int64_t start = now_ns();
+  benchmark.run(iterations);
+  return now_ns() - start;
+}
+
+Result
+measure(const extend::bench::Benchmark& benchmark, const Options& options)
+{
+  // Grow the count until one run takes the minimal time
+  uint64_t iterations = 1;
+  for (;;) {
+    const int64_t elapsed = time_run(benchmark, iterations);
+    if (elapsed >= options.min_time_ns) {
+      break;
+    }
+    const double scale = elapsed <= 0 ? 100.0
+                                      : 1.2 * static_cast<double>(
+                                                options.min_time_ns) /
+                                          static_cast<double>(elapsed);
+    iterations = static_cast<uint64_t>(static_cast<double>(iterations) *
+                                       eastl::clamp(scale, 2.0, 100.0));
+  }
+
+  eastl::vector<double> samples;
+  const uint64_t before = extend::bench::allocations();
+  for (unsigned i = 0; i < options.samples; ++i) {
+    samples.push_back(static_cast<double>(time_run(benchmark, iterations)) /
+                      static_cast<double>(iterations));
+  }
+  const uint64_t allocated = extend::bench::allocations() - before;
+  eastl::sort(samples.begin(), samples.end());
+
+  Result result;
+  result.name = benchmark.name;
+  result.ns_per_op = samples[samples.size() / 2];
+  result.allocations_per_op =
+    static_cast<double>(allocated) /
+    static_cast<double>(iterations * options.samples);
+  result.iterations = iterations;
+  return result;
+}
+
+void
+write_json(FILE* file, const eastl::vector<Result>& results)
+{
+  fputs("[\n", file);
+  for (size_t i = 0; i < results.size(); ++i) {
+    fputs("  {\"name\": \"", file);
+    for (char c : results[i].name) {
+      if (c == '"' || c == '\\') {
+        fputc('\\', file);
+      }
+      fputc(c, file);
+    }
+    fprintf(file,
+            "\", \"ns_per_op\": %.3f, \"allocations_per_op\": %.3f, "
+            "\"iterations\": %" PRIu64 "}%s\n",
+            results[i].ns_per_op,
+            results[i].allocations_per_op,
+            results[i].iterations,
+            i + 1 == results.size() ? "" : ",");
+  }
+  fputs("]\n", file);
+}
+
+// Read results written by write_json, other JSON is not supported
+bool
+read_json(const char* path, eastl::vector<Result>& results)
+{
+  FILE* file = fopen(path, "rb");
+  if (file == nullptr) {
+    return false;
+  }
+  eastl::string text;
+  char chunk[4096];
+  size_t count = 0;
+  while ((count = fread(chunk, 1, sizeof(chunk), file)) != 0) {
+    text.append(chunk, count);
+  }
+  fclose(file);
+
+  constexpr eastl::string_view NAME = "\"name\": \"";
+  size_t pos = 0;
+  while ((pos = text.find(NAME.data(), pos)) != eastl::string::npos) {
+    Result result;
+    for (pos += NAME.size(); pos < text.size() && text[pos] != '"'; ++pos) {
+      if (text[pos] == '\\') {
+        ++pos;
+      }
+      result.name.push_back(text[pos]);
+    }
+    const char* ns = strstr(text.c_str() + pos, "\"ns_per_op\": ");
+    const char* allocs = strstr(text.c_str() + pos, "\"allocations_per_op\": ");
+    if (ns == nullptr || allocs == nullptr) {
+      return false;
+    }
+    result.ns_per_op = strtod(ns + strlen("\"ns_per_op\": "), nullptr);
+    result.allocations_per_op =
+      strtod(allocs + strlen("\"allocations_per_op\": "), nullptr);
+    results.push_back(result);
+  }
+  return true;
+}
+
+// Print regressions against the baseline, false if there are any
+bool
+compare(const eastl::vector<Result>& results,
+        const eastl::vector<Result>& baseline,
+        double tolerance)
+{
+  bool passed = true;
+  for (const Result& result : results) {
+    const auto base =
+      eastl::find_if(baseline.begin(), baseline.end(), [&](const Result& r) {
+        return r.name == result.name;
+      });
+    if (base == baseline.end()) {
+      printf("new: %s\n", result.name.c_str());
+      continue;
+    }
+    if (result.ns_per_op > base->ns_per_op * (1 + tolerance)) {
+      printf("slower: %s %.3f ns/op, baseline %.3f ns/op\n",
+             result.name.c_str(),
+             result.ns_per_op,
+             base->ns_per_op);
+      passed = false;
+    }
+    if (result.allocations_per_op > base->allocations_per_op + 0.01) {
+      printf("allocates more: %s %.3f per op, baseline %.3f per op\n",
+             result.name.c_str(),
+             result.allocations_per_op,
+             base->allocations_per_op);
+      passed = false;
+    }
+  }
+  return passed;
+}
+
+bool
+parse_options(int argc, char** argv, Options& options)
+{
+  for (int i = 1; i < argc; ++i) {
+    const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+    if (value == nullptr) {
+      return false;
+    }
+    if (strcmp(argv[i], "--filter") == 0) {
+      options.filter = value;
+    } else if (strcmp(argv[i], "--json") == 0) {
+      options.json = value;
+    } else if (strcmp(argv[i], "--baseline") == 0) {
+      options.baseline = value;
+    } else if (strcmp(argv[i], "--tolerance") == 0) {
+      options.tolerance = strtod(value, nullptr);
+    } else if (strcmp(argv[i], "--samples") == 0) {
+      options.samples = eastl::max(1, atoi(value));
+    } else if (strcmp(argv[i], "--min-time") == 0) {
+      options.min_time_ns = eastl::max(1, atoi(value)) * int64_t(1000000);
+    } else {
+      return false;
+    }
+    ++i;
+  }
+  return true;
+}
+}
+
+namespace extend::bench {
+
+Benchmark::Benchmark(const char* n, Function r)
+  : name(n)
+  , run(r)
+  , next(benchmarks)
+{
+  benchmarks = this;
+}
+
+uint64_t
+allocations()
+{
+  return allocation_count.load(eastl::memory_order_relaxed);
+}
+
+}
+
+void*
+operator new(size_t size)
+{
+  return allocate(size);
+}
+
+void*
+operator new[](size_t size)
+{
+  return allocate(size);
+}
+
+void*
+operator new(size_t size, const std::nothrow_t&) noexcept
+{
+  return allocate(size);
+}
+
+void*
+operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+  return allocate(size);
+}
+
+void*
+operator new(size_t size, std::align_val_t alignment)
+{
+  return allocate(size, static_cast<size_t>(alignment));
+}
+
+void*
+operator new[](size_t size, std::align_val_t alignment)
+{
+  return allocate(size, static_cast<size_t>(alignment));
+}
+
+void
+operator delete(void* p) noexcept
+{
+  free(p);
+}
+
+void
+operator delete[](void* p) noexcept
+{
+  free(p);
+}
+
+void
+operator delete(void* p, size_t) noexcept
+{
+  free(p);
+}
+
+void
+operator delete[](void* p, size_t) noexcept
+{
+  free(p);
+}
+
+void
+operator delete(void* p, std::align_val_t) noexcept
+{
+  free(p);
+}
+
+void
+operator delete[](void* p, std::align_val_t) noexcept
+{
+  free(p);
+}
+
+void
+operator delete(void* p, size_t, std::align_val_t) noexcept
+{
+  free(p);
+}
+
+void
+operator delete[](void* p, size_t, std::align_val_t) noexcept
+{
+  free(p);
+}
+
+int
+main(int argc, char** argv)
+{
+  Options options;
+  if (!parse_options(argc, argv, options)) {
+    fprintf(stderr,
+            "Usage: %s [--filter TEXT] [--json FILE] [--baseline FILE] "
+            "[--tolerance FRACTION] [--samples N] [--min-time MS]\n",
+            argv[0]);
+    return 2;
+  }
+
+  // Registration order is reversed by the list
+  eastl::vector<const extend::bench::Benchmark*> selected;
+  for (const auto* b = benchmarks; b != nullptr; b = b->next) {
+    if (options.filter == nullptr || strstr(b->name, options.filter)) {
+      selected.push_back(b);
+    }
+  }
+  eastl::reverse(selected.begin(), selected.end());
+
+  eastl::vector<Result> results;
+  for (const extend::bench::Benchmark* benchmark : selected) {
+    results.push_back(measure(*benchmark, options));
+    const Result& result = results.back();
+    printf("%-56s %12.3f ns/op %8.3f allocs/op\n",
+           result.name.c_str(),
+           result.ns_per_op,
+           result.allocations_per_op);
+    fflush(stdout);
+  }
+
+  if (options.json != nullptr) {
+    FILE* file = fopen(options.json, "w");
+    if (file == nullptr) {
+      fprintf(stderr, "Cannot write %s\n", options.json);
+      return 1;
+    }
+    write_json(file, results);
+    fclose(file);
+  }
+
+  if (options.baseline != nullptr) {
+    eastl::vector<Result> baseline;
+    if (!read_json(options.baseline, baseline)) {
+      fprintf(stderr, "Cannot read %s\n", options.baseline);
+      return 1;
+    }
+    if (!compare(results, baseline, options.tolerance)) {
+      return 1;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,169 @@
+/* extend - expansible programming language
+ * Copyright (C) 2022 Vladimir Liutov vs@lutov.net
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/** Decode BinaryPipe output into the text CErrPipe would print, or into
+ * NDJSON with --json. CompressPipe output is unpacked to its text.
+ */
+
+#include <EASTL/algorithm.h>
+#include <EASTL/vector.h>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <log/binary.h>
+#include <log/compress.h>
+#include <log/log.h>
+#include <unistd.h>
+
+using namespace extend::log;
+
+namespace {
+/** Sites are numbered from 1 in the order of the first line, ids above the
+ * limit are not remembered.
+ */
+constexpr uint32_t MAX_SITES = 1 << 20;
+
+/** Print logs to cout the same way CErrPipe prints to stderr.
+ */
+struct COutPipe : IPipe
+{
+  virtual void log(LEVEL level, eastl::u8string_view str) override
+  {
+    const eastl::u8string_view prefix = linePrefix(level);
+    std::cout.write(reinterpret_cast<const char*>(prefix.data()),
+                    prefix.size());
+    std::cout.write(reinterpret_cast<const char*>(str.data()), str.size());
+    std::cout.put('\n');
+  }
+};
+
+bool
+read_all(int fd, eastl::vector<char8_t>& data)
+{
+  constexpr size_t CHUNK = 1 << 16;
+  for (;;) {
+    const size_t size = data.size();
+    data.resize(size + CHUNK);
+    const ssize_t count = ::read(fd, data.data() + size, CHUNK);
+    if (count < 0) {
+      return false;
+    }
+    data.resize(size + count);
+    if (count == 0) {
+      return true;
+    }
+  }
+}
+}
+
+int
+main(int argc, char** argv)
+{
+  bool sites = false;
+  bool json = false;
+  const char* path = nullptr;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--sites") == 0) {
+      sites = true;
+    } else if (strcmp(argv[i], "--json") == 0) {
+      json = true;
+    } else if (path == nullptr && argv[i][0] != '-') {
+      path = argv[i];
+    } else {
+      std::cerr << "Usage: " << argv[0] << " [--sites | --json] [FILE]"
+                << std::endl;
+      return 2;
+    }
+  }
+
+  const int fd = path ? ::open(path, O_RDONLY) : STDIN_FILENO;
+  eastl::vector<char8_t> data;
+  const bool read = fd >= 0 && read_all(fd, data);
+  if (path && fd >= 0) {
+    ::close(fd);
+  }
+  if (!read) {
+    std::cerr << "Cannot read " << (path ? path : "stdin") << std::endl;
+    return 1;
+  }
+  if (data.empty()) {
+    std::cerr << "Not a log: " << (path ? path : "stdin") << " is empty"
+              << std::endl;
+    return 1;
+  }
+
+  uint32_t magic = 0;
+  memcpy(&magic, data.data(), eastl::min(data.size(), sizeof(magic)));
+  if (magic == BlockHeader::MAGIC) {
+    eastl::u8string text;
+    const bool complete =
+      decompress(eastl::u8string_view(data.data(), data.size()), text);
+    std::cout.write(reinterpret_cast<const char*>(text.data()), text.size());
+    if (!complete) {
+      std::cerr << "Malformed block" << std::endl;
+      return 1;
+    }
+    return 0;
+  }
+
+  COutPipe pipe;
+  set_level(LEVEL::DEBUG);
+  eastl::vector<SiteInfo> known;
+  eastl::u8string_view view(data.data(), data.size());
+  BinaryRecord record;
+  while (next_record(view, record)) {
+    if (json) {
+      JsonLine line;
+      if (!to_json(record.level, record.line, line)) {
+        std::cerr << "Malformed record" << std::endl;
+        return 1;
+      }
+      line.push_back(u8'\n');
+      std::cout.write(reinterpret_cast<const char*>(line.data()), line.size());
+      continue;
+    }
+
+    OStreamFactory factory(record.level, pipe);
+    OStream out(factory);
+
+    SiteInfo site;
+    if (sites && read_site(record.line, site) && site.id < MAX_SITES) {
+      if (site.id >= known.size()) {
+        known.resize(site.id + 1);
+      }
+      if (site.file.empty()) {
+        site = known[site.id];
+      } else {
+        known[site.id] = site;
+      }
+      if (!site.file.empty()) {
+        out << site.file << u8':' << site.line << u8": ";
+      }
+    }
+
+    if (!replay(record.line, out)) {
+      std::cerr << "Malformed record" << std::endl;
+      return 1;
+    }
+  }
+
+  if (!view.empty()) {
+    std::cerr << "Truncated record" << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,254 @@
+/* extend - expansible programming language
+ * Copyright (C) 2022 Vladimir Liutov vs@lutov.net
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "async.h"
+
+#include "posix.h"
+
+namespace extend::log {
+
+namespace {
+// Writer thread wakes up by itself at least this often (milliseconds), so a
+// missed wake up only delays lines, never loses them.
+constexpr int64_t WRITER_POLL_MS = 10;
+}
+
+AsyncPipe::AsyncPipe(IPipe& s, OVERFLOW_POLICY p, size_t capacity)
+  : sink(s)
+  , policy(p)
+  , mask(ceil_pow2(capacity) - 1)
+  , slots(eastl::make_unique<Slot[]>(mask + 1))
+{
+  for (size_t i = 0; i <= mask; ++i) {
+    slots[i].sequence.store(i, eastl::memory_order_relaxed);
+  }
+
+  EA::Thread::ThreadParameters params;
+  params.mpName = "extend-log";
+  writer.Begin(&AsyncPipe::run, this, &params);
+}
+
+AsyncPipe::~AsyncPipe()
+{
+  running.store(false, eastl::memory_order_release);
+  signal.Post();
+  writer.WaitForEnd();
+}
+
+void
+AsyncPipe::log(LEVEL level, eastl::u8string_view str)
+{
+  enqueue(level, {}, str);
+  wake();
+}
+
+void
+AsyncPipe::log_batch(eastl::span<const Line> lines)
+{
+  for (const Line& line : lines) {
+    enqueue(line.level, line.head, line.str);
+  }
+  wake();
+}
+
+void
+AsyncPipe::log_prefixed(LEVEL level,
+                        eastl::u8string_view head,
+                        eastl::u8string_view str)
+{
+  enqueue(level, head, str);
+  wake();
+}
+
+void
+AsyncPipe::enqueue(LEVEL level,
+                   eastl::u8string_view head,
+                   eastl::u8string_view str)
+{
+  while (!push(level, head, str)) {
+    switch (policy) {
+      case OVERFLOW_POLICY::BLOCK:
+        wake();
+        EA::Thread::ThreadSleep();
+        break;
+      case OVERFLOW_POLICY::DROP_NEWEST:
+        drop();
+        return;
+      case OVERFLOW_POLICY::DROP_OLDEST:
+        if (pop(false)) {
+          drop();
+        }
+        break;
+    }
+  }
+}
+
+void
+AsyncPipe::drop()
+{
+  lost.fetch_add(1, eastl::memory_order_relaxed);
+  // The line may describe a site
+  if (sink.format() == FORMAT::BINARY) {
+    describe_sites();
+  }
+}
+
+void
+AsyncPipe::flush()
+{
+  const size_t target = tail.load(eastl::memory_order_acquire);
+  signal.Post();
+  while (flushed.load(eastl::memory_order_acquire) < target) {
+    EA::Thread::ThreadSleep();
+  }
+}
+
+FORMAT
+AsyncPipe::format() const
+{
+  return sink.format();
+}
+
+uint64_t
+AsyncPipe::dropped() const
+{
+  return lost.load(eastl::memory_order_relaxed);
+}
+
+bool
+AsyncPipe::push(LEVEL level,
+                eastl::u8string_view head,
+                eastl::u8string_view str)
+{
+  size_t pos = tail.load(eastl::memory_order_relaxed);
+  Slot* slot = nullptr;
+  for (;;) {
+    slot = &slots[pos & mask];
+    const size_t sequence = slot->sequence.load(eastl::memory_order_acquire);
+    const auto diff =
+      static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+    if (diff == 0) {
+      if (tail.compare_exchange_weak(pos,
+                                     pos + 1,
+                                     eastl::memory_order_relaxed,
+                                     eastl::memory_order_relaxed)) {
+        break;
+      }
+    } else if (diff < 0) {
+      return false;
+    } else {
+      pos = tail.load(eastl::memory_order_relaxed);
+    }
+  }
+
+  slot->level = level;
+  slot->head_size = static_cast<uint32_t>(head.size());
+  slot->line.assign(head.data(), head.size());
+  slot->line.append(str.data(), str.size());
+  slot->sequence.store(pos + 1, eastl::memory_order_release);
+  return true;
+}
+
+bool
+AsyncPipe::pop(bool write)
+{
+  size_t pos = head.load(eastl::memory_order_relaxed);
+  Slot* slot = nullptr;
+  for (;;) {
+    slot = &slots[pos & mask];
+    const size_t sequence = slot->sequence.load(eastl::memory_order_acquire);
+    const auto diff =
+      static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+    if (diff == 0) {
+      if (head.compare_exchange_weak(pos,
+                                     pos + 1,
+                                     eastl::memory_order_relaxed,
+                                     eastl::memory_order_relaxed)) {
+        break;
+      }
+    } else if (diff < 0) {
+      return false;
+    } else {
+      pos = head.load(eastl::memory_order_relaxed);
+    }
+  }
+
+  // Release the slot before the sink is called, so slow sink never holds
+  // a slot and the whole ring stays available to producers
+  const LEVEL level = slot->level;
+  const size_t head_size = slot->head_size;
+  if (write) {
+    current.assign(slot->line.data(), slot->line.size());
+  }
+  slot->sequence.store(pos + mask + 1, eastl::memory_order_release);
+  if (write && head_size != 0) {
+    const eastl::u8string_view line(current.data(), current.size());
+    sink.log_prefixed(
+      level, line.substr(0, head_size), line.substr(head_size));
+  } else if (write) {
+    sink.log(level, current);
+  }
+  return true;
+}
+
+void
+AsyncPipe::wake()
+{
+  if (sleeping.load(eastl::memory_order_relaxed) &&
+      sleeping.exchange(false, eastl::memory_order_acq_rel)) {
+    signal.Post();
+  }
+}
+
+void
+AsyncPipe::report_dropped()
+{
+  const uint64_t count = lost.load(eastl::memory_order_relaxed);
+  if (count != reported) {
+    OStreamFactory factory(LEVEL::WARNING, sink, report_channel);
+    factory << u8"AsyncPipe dropped " << (count - reported) << u8" lines";
+    reported = count;
+  }
+}
+
+intptr_t
+AsyncPipe::run(void* context)
+{
+  AsyncPipe& self = *static_cast<AsyncPipe*>(context);
+  for (;;) {
+    // Producers are gone once running is false, so one more drain is enough
+    const bool stopping = !self.running.load(eastl::memory_order_acquire);
+    while (self.pop(true)) {
+    }
+    self.report_dropped();
+    self.sink.flush();
+    self.flushed.store(self.head.load(eastl::memory_order_acquire),
+                       eastl::memory_order_release);
+    if (stopping) {
+      break;
+    }
+
+    self.sleeping.store(true, eastl::memory_order_seq_cst);
+    if (!self.pop(true)) {
+      self.signal.Wait(EA::Thread::GetThreadTime() + WRITER_POLL_MS);
+    }
+    self.sleeping.store(false, eastl::memory_order_relaxed);
+  }
+  return 0;
+}
+
+}
@@ -0,0 +1,123 @@
+/* extend - expansible programming language
+ * Copyright (C) 2022 Vladimir Liutov vs@lutov.net
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <EASTL/atomic.h>
+#include <EASTL/fixed_string.h>
+#include <EASTL/unique_ptr.h>
+#include <eathread/eathread_semaphore.h>
+#include <eathread/eathread_thread.h>
+
+#include "log.h"
+
+namespace extend::log {
+
+/** What producer does when the ring is full.
+ */
+enum struct OVERFLOW_POLICY
+{
+  BLOCK,
+  DROP_NEWEST,
+  DROP_OLDEST
+};
+
+/** Write logs to another pipe from a dedicated thread.
+ *
+ * Producers only copy the line into a bounded lock-free MPSC ring, the writer
+ * thread drains it into the sink. Lost lines are reported to the sink as a
+ * warning with the count of dropped lines.
+ */
+struct AsyncPipe : IPipe
+{
+  static constexpr size_t DEFAULT_CAPACITY = 1024;
+
+  /** Start writer thread.
+   *
+   * @param sink     Pipe to write lines to, should outlive AsyncPipe.
+   * @param policy   What to do when the ring is full.
+   * @param capacity Count of lines in the ring, rounded up to power of two.
+   */
+  AsyncPipe(IPipe& sink,
+            OVERFLOW_POLICY policy = OVERFLOW_POLICY::BLOCK,
+            size_t capacity = DEFAULT_CAPACITY);
+
+  /** Drain the ring and stop writer thread.
+   */
+  virtual ~AsyncPipe() override;
+
+  virtual void log(LEVEL level, eastl::u8string_view str) override;
+
+  /** Push the lines and wake the writer once.
+   */
+  virtual void log_batch(eastl::span<const Line> lines) override;
+
+  /** Keep the head with the line, the sink gets both in log_prefixed.
+   */
+  virtual void log_prefixed(LEVEL level,
+                            eastl::u8string_view head,
+                            eastl::u8string_view str) override;
+
+  /** Wait until every line logged before the call is written to the sink.
+   */
+  virtual void flush() override;
+
+  virtual FORMAT format() const override;
+
+  /** Count of lines lost because of overflow.
+   */
+  uint64_t dropped() const;
+
+private:
+  struct Slot
+  {
+    eastl::atomic<size_t> sequence;
+    LEVEL level = LEVEL::DEBUG;
+    /** Size of the head at the start of the line, zero without one. */
+    uint32_t head_size = 0;
+    eastl::fixed_string<char8_t, 256> line;
+  };
+
+  void enqueue(LEVEL level,
+               eastl::u8string_view head,
+               eastl::u8string_view str);
+  bool push(LEVEL level, eastl::u8string_view head, eastl::u8string_view str);
+  bool pop(bool write);
+  /** Count a lost line. */
+  void drop();
+  void wake();
+  void report_dropped();
+  static intptr_t run(void* context);
+
+  IPipe& sink;
+  const OVERFLOW_POLICY policy;
+  const size_t mask;
+  eastl::unique_ptr<Slot[]> slots;
+
+  alignas(64) eastl::atomic<size_t> tail{ 0 };
+  alignas(64) eastl::atomic<size_t> head{ 0 };
+  alignas(64) eastl::atomic<size_t> flushed{ 0 };
+  eastl::atomic<uint64_t> lost{ 0 };
+  uint64_t reported = 0;
+  eastl::fixed_string<char8_t, 256> current;
+  eastl::atomic<bool> sleeping{ false };
+  eastl::atomic<bool> running{ true };
+  EA::Thread::Semaphore signal{ 0 };
+  EA::Thread::Thread writer;
+};
+
+}
@@ -0,0 +1,386 @@
+/* extend - expansible programming language
+ * Copyright (C) 2022 Vladimir Liutov vs@lutov.net
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/** Digits are read by blocks: SWAR converts 8 ASCII digits in a 64-bit word
+ * with three multiply-and-add steps, SSE4.1 converts 16 digits of bases up
+ * to 10 the same way with maddubs and madd, and 16 hexadecimal digits by
+ * packing them to bytes. A partial block is shifted so that zero digits
+ * precede it, the text is never read past its end. Numbers of up to 4 digits
+ * in bases up to 10 skip the blocks and are read digit by digit.
+ */
+
+#include "parse.h"
+
+#include <EASTL/numeric_limits.h>
+#include <EASTL/type_traits.h>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define EXTEND_LOG_ATOI_SIMD 1
+#else
+#define EXTEND_LOG_ATOI_SIMD 0
+#endif
+
+namespace extend::log {
+
+namespace {
+constexpr unsigned MIN_BASE = 2;
+constexpr unsigned MAX_BASE = 16;
+constexpr ptrdiff_t MAX_BLOCK = 16;
+constexpr uint64_t ONES = 0x0101010101010101u;
+constexpr uint64_t HIGH_BITS = 0x8080808080808080u;
+// High bits of the first 5 chars, a non-digit among them ends a number of
+// at most 4 digits
+constexpr uint64_t SHORT_BITS = HIGH_BITS >> 24;
+
+struct Powers
+{
+  uint64_t values[MAX_BASE + 1][MAX_BLOCK + 1];
+};
+
+constexpr Powers
+make_powers()
+{
+  Powers powers{};
+  for (unsigned base = MIN_BASE; base <= MAX_BASE; ++base) {
+    uint64_t power = 1;
+    for (unsigned count = 0; count <= MAX_BLOCK; ++count) {
+      powers.values[base][count] = power;
+      power *= base;
+    }
+  }
+  return powers;
+}
+
+// Powers of each base up to the longest block, 16^16 wraps and is unused
+constexpr Powers POWERS = make_powers();
+
+// Number in the digits at the start of a block
+struct Block
+{
+  uint64_t value;
+  /** Count of the digits, zero if the block starts with a non-digit. */
+  uint32_t count;
+  /** The digits fill the block and may continue after it. */
+  bool full;
+};
+
+// High bit of each byte that is not a digit of the base
+template<unsigned BASE>
+uint64_t
+invalid(uint64_t chunk)
+{
+  const uint64_t low = chunk & ~HIGH_BITS;
+  constexpr uint64_t LAST = BASE < 10 ? '0' + BASE - 1 : '9';
+  uint64_t valid = (low + (0x80 - '0') * ONES) & ~(low + (0x7F - LAST) * ONES);
+  if constexpr (BASE > 10) {
+    const uint64_t lower = low | 0x20 * ONES;
+    constexpr uint64_t LAST_LETTER = 'a' + BASE - 11;
+    valid |=
+      (lower + (0x80 - 'a') * ONES) & ~(lower + (0x7F - LAST_LETTER) * ONES);
+  }
+  return (chunk | ~valid) & HIGH_BITS;
+}
+
+// Digit values in the bytes, bytes after the first invalid one are garbage
+template<unsigned BASE>
+uint64_t
+values(uint64_t chunk)
+{
+  if constexpr (BASE <= 10) {
+    return chunk - '0' * ONES;
+  } else {
+    return (chunk & 0x0F * ONES) + ((chunk >> 6) & ONES) * 9;
+  }
+}
+
+// Number in 8 digit bytes, the first digit is in the lowest byte
+template<unsigned BASE>
+uint64_t
+combine(uint64_t chunk)
+{
+  constexpr uint64_t BASE2 = BASE * BASE;
+  chunk = (chunk * BASE + (chunk >> 8)) & 0x00FF00FF00FF00FFu;
+  chunk = (chunk * BASE2 + (chunk >> 16)) & 0x0000FFFF0000FFFFu;
+  return (chunk * BASE2 * BASE2 + (chunk >> 32)) & 0xFFFFFFFFu;
+}
+
+template<typename T>
+uint64_t
+load(const char8_t* str)
+{
+  T value;
+  memcpy(&value, str, sizeof(value));
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  value = __builtin_bswap64(uint64_t(value)) >> (64 - 8 * sizeof(value));
+#endif
+  return value;
+}
+
+// Up to 8 chars in the lowest bytes first, zeros after the end. Short tails
+// are gathered with overlapping loads: a byte-wise copy to the stack and a
+// word load would stall on store forwarding.
+inline uint64_t
+load_chunk(const char8_t* str, size_t size)
+{
+  if (size >= 8) {
+    return load<uint64_t>(str);
+  }
+  if (size >= 4) {
+    return load<uint32_t>(str) | load<uint32_t>(str + size - 4)
+                                   << (8 * (size - 4));
+  }
+  if (size > 0) {
+    return uint64_t(str[0]) | uint64_t(str[size / 2]) << (8 * (size / 2)) |
+           uint64_t(str[size - 1]) << (8 * (size - 1));
+  }
+  return 0;
+}
+
+template<unsigned BASE>
+inline Block
+swar(const char8_t* str, const char8_t* end)
+{
+  const uint64_t chunk = load_chunk(str, static_cast<size_t>(end - str));
+  const uint64_t mask = invalid<BASE>(chunk);
+  if (mask == 0) {
+    return { combine<BASE>(values<BASE>(chunk)), 8, true };
+  }
+  const uint32_t count = __builtin_ctzll(mask) / 8;
+  if (count == 0) {
+    return { 0, 0, false };
+  }
+  const uint64_t block = values<BASE>(chunk) << (8 * (8 - count));
+  return { combine<BASE>(block), count, false };
+}
+
+#if EXTEND_LOG_ATOI_SIMD
+const bool has_sse41 = [] {
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("sse4.1") != 0;
+}();
+
+// Shuffle indices that move the first n bytes to the end, read from n
+alignas(2 * MAX_BLOCK) const int8_t SHIFT[2 * MAX_BLOCK] = {
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  0,  1,  2,  3,  4,  5,  6,  7,  8,  9,  10, 11, 12, 13, 14, 15,
+};
+
+// Hexadecimal digits: pairs are packed to bytes, the first byte is the
+// highest
+__attribute__((target("sse4.1"))) Block
+sse41_hex(const char8_t* str)
+{
+  const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str));
+  const __m128i digits = _mm_sub_epi8(chunk, _mm_set1_epi8('0'));
+  const __m128i letters = _mm_sub_epi8(
+    _mm_or_si128(chunk, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+  const __m128i is_digit =
+    _mm_cmpeq_epi8(_mm_min_epu8(digits, _mm_set1_epi8(9)), digits);
+  const __m128i is_letter =
+    _mm_cmpeq_epi8(_mm_min_epu8(letters, _mm_set1_epi8(5)), letters);
+  const uint32_t mask =
+    ~_mm_movemask_epi8(_mm_or_si128(is_digit, is_letter)) & 0xFFFF;
+  const uint32_t count = mask == 0 ? MAX_BLOCK : __builtin_ctz(mask);
+  if (count == 0) {
+    return { 0, 0, false };
+  }
+  const __m128i values = _mm_blendv_epi8(
+    _mm_add_epi8(letters, _mm_set1_epi8(10)), digits, is_digit);
+  __m128i block = _mm_shuffle_epi8(
+    values, _mm_loadu_si128(reinterpret_cast<const __m128i*>(SHIFT + count)));
+  block = _mm_maddubs_epi16(block, _mm_set1_epi16(0x110));
+  block = _mm_packus_epi16(block, block);
+  const uint64_t bytes = static_cast<uint64_t>(_mm_cvtsi128_si64(block));
+  return { __builtin_bswap64(bytes), count, mask == 0 };
+}
+
+// Bases up to 10, madd takes signed 16-bit weights up to base^4
+template<unsigned BASE>
+__attribute__((target("sse4.1"))) Block
+sse41(const char8_t* str)
+{
+  if constexpr (BASE == 16) {
+    return sse41_hex(str);
+  } else {
+    constexpr int BASE2 = BASE * BASE;
+    const __m128i chunk =
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(str));
+    const __m128i values = _mm_sub_epi8(chunk, _mm_set1_epi8('0'));
+    const __m128i valid =
+      _mm_cmpeq_epi8(_mm_min_epu8(values, _mm_set1_epi8(BASE - 1)), values);
+    const uint32_t mask = ~_mm_movemask_epi8(valid) & 0xFFFF;
+    const uint32_t count = mask == 0 ? MAX_BLOCK : __builtin_ctz(mask);
+    if (count == 0) {
+      return { 0, 0, false };
+    }
+    __m128i block = _mm_shuffle_epi8(
+      values,
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(SHIFT + count)));
+    block = _mm_maddubs_epi16(block, _mm_set1_epi16(0x100 | BASE));
+    block = _mm_madd_epi16(block, _mm_set1_epi32(0x10000 | BASE2));
+    block = _mm_packus_epi32(block, block);
+    block = _mm_madd_epi16(block, _mm_set1_epi32(0x10000 | BASE2 * BASE2));
+    const uint64_t high = static_cast<uint32_t>(_mm_cvtsi128_si32(block));
+    const uint64_t low = static_cast<uint32_t>(_mm_extract_epi32(block, 1));
+    return { high * POWERS.values[BASE][8] + low, count, mask == 0 };
+  }
+}
+#endif
+
+// Unsigned value of the digits at the start of the text, the text is moved
+// past them
+template<unsigned BASE>
+uint64_t
+read(const char8_t*& str, const char8_t* end, bool& overflow)
+{
+  const char8_t* digits = str;
+  uint64_t value = 0;
+  bool wrapped = false;
+  for (;;) {
+#if EXTEND_LOG_ATOI_SIMD
+    Block block;
+    if constexpr (BASE <= 10 || BASE == 16) {
+      block = has_sse41 && end - digits >= MAX_BLOCK ? sse41<BASE>(digits)
+                                                     : swar<BASE>(digits, end);
+    } else {
+      block = swar<BASE>(digits, end);
+    }
+#else
+    const Block block = swar<BASE>(digits, end);
+#endif
+    if (value == 0) {
+      value = block.value;
+    } else if (BASE == 16 && block.count == MAX_BLOCK) {
+      // 16^16 does not fit
+      wrapped = true;
+    } else {
+      uint64_t shifted;
+      wrapped |= __builtin_mul_overflow(
+        value, POWERS.values[BASE][block.count], &shifted);
+      wrapped |= __builtin_add_overflow(shifted, block.value, &value);
+    }
+    digits += block.count;
+    if (!block.full) {
+      break;
+    }
+  }
+  str = digits;
+  overflow = wrapped;
+  return value;
+}
+
+// Same as read, but short numbers and texts of less than 8 chars are read
+// digit by digit: a few multiply-adds cost less than a block. Letters of
+// higher bases take more to check, these bases always use blocks.
+template<unsigned BASE>
+__attribute__((always_inline)) inline uint64_t
+read_number(const char8_t*& str, const char8_t* end, bool& overflow)
+{
+  static_assert(BASE <= 10);
+  uint64_t value = 0;
+  if (end - str >= 8) {
+    if ((invalid<BASE>(load<uint64_t>(str)) & SHORT_BITS) == 0) {
+      return read<BASE>(str, end, overflow);
+    }
+    // A non-digit follows within 5 chars, the end is not checked
+    for (unsigned d; (d = unsigned(*str) - u8'0') < BASE; ++str) {
+      value = value * BASE + d;
+    }
+  } else {
+    for (unsigned d; str != end && (d = unsigned(*str) - u8'0') < BASE;
+         ++str) {
+      value = value * BASE + d;
+    }
+  }
+  overflow = false;
+  return value;
+}
+
+using Reader = uint64_t (*)(const char8_t*& str,
+                            const char8_t* end,
+                            bool& overflow);
+
+// Readers with constant multipliers and masks for each base
+const Reader READERS[MAX_BASE + 1] = {
+  nullptr,        nullptr,        read_number<2>, read_number<3>,
+  read_number<4>, read_number<5>, read_number<6>, read_number<7>,
+  read_number<8>, read_number<9>, read_number<10>, read<11>,
+  read<12>,       read<13>,       read<14>,       read<15>,
+  read<16>,
+};
+}
+
+template<typename T>
+Parsed<T>
+parse_integer(eastl::span<const char8_t> str, unsigned base)
+{
+  if (base < MIN_BASE || base > MAX_BASE) {
+    return { 0, 0, PARSE::INVALID };
+  }
+  const char8_t* const begin = str.data();
+  const char8_t* const end = begin + str.size();
+  const char8_t* start = begin;
+  bool negative = false;
+  if (start != end &&
+      (*start == u8'+' || (eastl::is_signed_v<T> && *start == u8'-'))) {
+    negative = *start == u8'-';
+    ++start;
+  }
+
+  const char8_t* digits_end = start;
+  bool overflow = false;
+  const uint64_t digits = base == 10
+                            ? read_number<10>(digits_end, end, overflow)
+                            : READERS[base](digits_end, end, overflow);
+  if (digits_end == start) {
+    return { 0, 0, PARSE::INVALID };
+  }
+
+  const size_t length = static_cast<size_t>(digits_end - begin);
+  using Unsigned = eastl::make_unsigned_t<T>;
+  const uint64_t max = eastl::numeric_limits<T>::max();
+  if (overflow || digits > max + negative) {
+    return { negative ? eastl::numeric_limits<T>::min()
+                      : eastl::numeric_limits<T>::max(),
+             length,
+             PARSE::OUT_OF_RANGE };
+  }
+  const Unsigned value = static_cast<Unsigned>(digits);
+  return { static_cast<T>(negative ? Unsigned(0) - value : value),
+           length,
+           PARSE::OK };
+}
+
+template Parsed<int8_t>
+parse_integer<int8_t>(eastl::span<const char8_t> str, unsigned base);
+template Parsed<uint8_t>
+parse_integer<uint8_t>(eastl::span<const char8_t> str, unsigned base);
+template Parsed<int16_t>
+parse_integer<int16_t>(eastl::span<const char8_t> str, unsigned base);
+template Parsed<uint16_t>
+parse_integer<uint16_t>(eastl::span<const char8_t> str, unsigned base);
+template Parsed<int32_t>
+parse_integer<int32_t>(eastl::span<const char8_t> str, unsigned base);
+template Parsed<uint32_t>
+parse_integer<uint32_t>(eastl::span<const char8_t> str, unsigned base);
+template Parsed<int64_t>
+parse_integer<int64_t>(eastl::span<const char8_t> str, unsigned base);
+template Parsed<uint64_t>
+parse_integer<uint64_t>(eastl::span<const char8_t> str, unsigned base);
+}
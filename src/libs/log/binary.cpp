@@ -0,0 +1,585 @@
+/* extend - expansible programming language
+ * Copyright (C) 2022 Vladimir Liutov vs@lutov.net
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "binary.h"
+
+#include <EASTL/algorithm.h>
+#include <EASTL/fixed_string.h>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <unistd.h>
+
+namespace extend::log {
+
+namespace {
+// Sites described in an older generation are described again, new sites
+// have none
+eastl::atomic<uint32_t> site_generation{ 1 };
+
+template<typename S, typename T>
+void
+put(S& line, const T& x)
+{
+  line.append(reinterpret_cast<const char8_t*>(&x), sizeof(T));
+}
+
+template<typename S, typename T>
+void
+put(S& line, TAG tag, const T& x)
+{
+  line.push_back(static_cast<char8_t>(tag));
+  put(line, x);
+}
+
+template<typename S, typename T>
+void
+put(S& line, TAG tag, eastl::basic_string_view<T> str)
+{
+  put(line, tag, static_cast<uint32_t>(str.size()));
+  line.append(reinterpret_cast<const char8_t*>(str.data()),
+              str.size() * sizeof(T));
+}
+
+template<typename T>
+T
+get(const char8_t* data)
+{
+  T x;
+  memcpy(&x, data, sizeof(T));
+  return x;
+}
+
+/** Call visit(tag, data, count) for every argument of binary line.
+ *
+ * Data points to the value, for strings to the first of count code units,
+ * for SITE_INFO to site id.
+ */
+template<typename F>
+bool
+walk(eastl::u8string_view line, F&& visit)
+{
+  const char8_t* it = line.data();
+  const char8_t* const end = line.data() + line.size();
+  while (it != end) {
+    const auto tag = static_cast<TAG>(*it++);
+    size_t unit = 0;
+    uint32_t count = 1;
+    switch (tag) {
+      case TAG::CHAR8:
+      case TAG::INT8:
+      case TAG::UINT8:
+        unit = 1;
+        break;
+      case TAG::CHAR16:
+      case TAG::INT16:
+      case TAG::UINT16:
+        unit = 2;
+        break;
+      case TAG::CHAR32:
+      case TAG::INT32:
+      case TAG::UINT32:
+      case TAG::FLOAT:
+      case TAG::SITE:
+        unit = 4;
+        break;
+      case TAG::INT64:
+      case TAG::UINT64:
+      case TAG::DOUBLE:
+        unit = 8;
+        break;
+      case TAG::STR8:
+      case TAG::STR16:
+      case TAG::STR32:
+      case TAG::FIELD:
+        if (end - it < 4) {
+          return false;
+        }
+        unit = tag == TAG::STR16 ? 2 : tag == TAG::STR32 ? 4 : 1;
+        count = get<uint32_t>(it);
+        it += 4;
+        break;
+      case TAG::SITE_INFO: {
+        if (end - it < 12) {
+          return false;
+        }
+        // Sizes from the input are checked before any sum that may wrap
+        const uint32_t file_size = get<uint32_t>(it + 8);
+        if (file_size > static_cast<size_t>(end - it) - 12 ||
+            file_size > UINT32_MAX - 12) {
+          return false;
+        }
+        unit = 1;
+        count = 12 + file_size;
+        break;
+      }
+      case TAG::FLOAT_FORMAT:
+        // Precision sizes the line, it is checked before any float uses it
+        if (end - it < 5 || *it > static_cast<char8_t>(NOTATION::SCIENTIFIC) ||
+            get<uint32_t>(it + 1) > MAX_PRECISION) {
+          return false;
+        }
+        unit = 1;
+        count = 5;
+        break;
+      default:
+        return false;
+    }
+    const size_t size = unit * count;
+    if (static_cast<size_t>(end - it) < size) {
+      return false;
+    }
+    visit(tag, it, count);
+    it += size;
+  }
+  return true;
+}
+
+template<typename T>
+void
+replay_string(OStream& out, const char8_t* data, uint32_t count)
+{
+  eastl::fixed_string<T, 256> str;
+  str.resize(count);
+  memcpy(str.data(), data, count * sizeof(T));
+  out << eastl::basic_string_view<T>(str.data(), str.size());
+}
+void
+replay_arg(OStream& out, TAG tag, const char8_t* data, uint32_t count)
+{
+  switch (tag) {
+    case TAG::CHAR8:
+      out << get<char8_t>(data);
+      break;
+    case TAG::CHAR16:
+      out << get<char16_t>(data);
+      break;
+    case TAG::CHAR32:
+      out << get<char32_t>(data);
+      break;
+    case TAG::STR8:
+      out << eastl::u8string_view(data, count);
+      break;
+    case TAG::STR16:
+      replay_string<char16_t>(out, data, count);
+      break;
+    case TAG::STR32:
+      replay_string<char32_t>(out, data, count);
+      break;
+    case TAG::INT8:
+      out << get<int8_t>(data);
+      break;
+    case TAG::INT16:
+      out << get<int16_t>(data);
+      break;
+    case TAG::INT32:
+      out << get<int32_t>(data);
+      break;
+    case TAG::INT64:
+      out << get<int64_t>(data);
+      break;
+    case TAG::UINT8:
+      out << get<uint8_t>(data);
+      break;
+    case TAG::UINT16:
+      out << get<uint16_t>(data);
+      break;
+    case TAG::UINT32:
+      out << get<uint32_t>(data);
+      break;
+    case TAG::UINT64:
+      out << get<uint64_t>(data);
+      break;
+    case TAG::FLOAT:
+      out << get<float>(data);
+      break;
+    case TAG::DOUBLE:
+      out << get<double>(data);
+      break;
+    case TAG::FIELD:
+      out << FieldKey{ eastl::u8string_view(data, count) };
+      break;
+    case TAG::FLOAT_FORMAT:
+      out << FloatFormat{ static_cast<NOTATION>(data[0]),
+                          get<uint32_t>(data + 1) };
+      break;
+    case TAG::SITE:
+    case TAG::SITE_INFO:
+      break;
+  }
+}
+
+// Names of levels in JSON
+constexpr eastl::u8string_view LEVEL_NAMES[] = { u8"DEBUG",
+                                                 u8"INFO",
+                                                 u8"WARNING",
+                                                 u8"ERROR",
+                                                 u8"FATAL" };
+
+// Members of the JSON object written by to_json itself
+constexpr eastl::u8string_view RESERVED_KEYS[] = {
+  u8"level", u8"site", u8"file", u8"line", u8"msg"
+};
+
+/** Write field value as JSON, numbers as is and the rest as strings.
+ */
+void
+append_json(JsonLine& out, OStream& text, TAG tag, const char8_t* data)
+{
+  bool number = true;
+  switch (tag) {
+    case TAG::FLOAT:
+      number = std::isfinite(get<float>(data));
+      break;
+    case TAG::DOUBLE:
+      number = std::isfinite(get<double>(data));
+      break;
+    case TAG::CHAR8:
+    case TAG::CHAR16:
+    case TAG::CHAR32:
+    case TAG::STR8:
+    case TAG::STR16:
+    case TAG::STR32:
+      number = false;
+      break;
+    default:;
+  }
+  if (number) {
+    out.append(text.line.data(), text.line.size());
+  } else {
+    out.push_back(u8'"');
+    json_escape(text.line, out);
+    out.push_back(u8'"');
+  }
+}
+}
+
+BinaryPipe::BinaryPipe(int f)
+  : fd(f)
+{
+  describe_sites();
+}
+
+void
+BinaryPipe::log(LEVEL level, eastl::u8string_view str)
+{
+  eastl::fixed_string<char8_t, 512> frame;
+  put(frame, static_cast<uint32_t>(str.size()));
+  frame.push_back(static_cast<char8_t>(level));
+  frame.append(str.data(), str.size());
+
+  const char8_t* data = frame.data();
+  size_t size = frame.size();
+  while (size != 0) {
+    const ssize_t written = ::write(fd, data, size);
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return;
+    }
+    data += written;
+    size -= written;
+  }
+}
+
+FORMAT
+BinaryPipe::format() const
+{
+  return FORMAT::BINARY;
+}
+
+bool
+next_record(eastl::u8string_view& data, BinaryRecord& record)
+{
+  constexpr size_t HEADER_SIZE = sizeof(uint32_t) + 1;
+  if (data.size() < HEADER_SIZE) {
+    return false;
+  }
+  const auto size = get<uint32_t>(data.data());
+  if (data.size() - HEADER_SIZE < size ||
+      data[sizeof(uint32_t)] > static_cast<char8_t>(LEVEL::FATAL)) {
+    return false;
+  }
+  record.level = static_cast<LEVEL>(data[sizeof(uint32_t)]);
+  record.line = data.substr(HEADER_SIZE, size);
+  data.remove_prefix(HEADER_SIZE + size);
+  return true;
+}
+
+bool
+replay(eastl::u8string_view line, OStream& out)
+{
+  return walk(line, [&out](TAG tag, const char8_t* data, uint32_t count) {
+    replay_arg(out, tag, data, count);
+  });
+}
+
+namespace {
+// Never registered nor visible, so scratch streams are always enabled
+Channel scratch_channel;
+
+// Stream that formats values for to_json, never published nor counted
+struct ScratchOStream : OStream
+{
+  explicit ScratchOStream(OStreamFactory& f)
+    : OStream(f)
+  {}
+
+  ~ScratchOStream() { enable = false; }
+};
+}
+
+bool
+to_json(LEVEL level, eastl::u8string_view line, JsonLine& out)
+{
+  NullPipe null;
+  OStreamFactory factory(LEVEL::FATAL, null, scratch_channel);
+  ScratchOStream message(factory);
+  ScratchOStream value(factory);
+  JsonLine fields;
+  SiteInfo site;
+  eastl::u8string_view key;
+  bool pending = false;
+  bool has_site = false;
+  const bool valid =
+    walk(line, [&](TAG tag, const char8_t* data, uint32_t count) {
+      if (tag == TAG::SITE || tag == TAG::SITE_INFO) {
+        has_site = true;
+        site.id = get<uint32_t>(data);
+      }
+      if (tag == TAG::SITE_INFO) {
+        site.line = get<uint32_t>(data + 4);
+        site.file = eastl::u8string_view(data + 12, count - 12);
+      }
+      if (tag == TAG::FLOAT_FORMAT) {
+        // Applies to the message and to values of fields
+        replay_arg(message, tag, data, count);
+        replay_arg(value, tag, data, count);
+        return;
+      }
+      if (tag == TAG::FIELD) {
+        key = eastl::u8string_view(data, count);
+        pending = true;
+        return;
+      }
+      if (!pending) {
+        replay_arg(message, tag, data, count);
+        return;
+      }
+      fields.append(u8",\"");
+      if (eastl::find(eastl::begin(RESERVED_KEYS),
+                      eastl::end(RESERVED_KEYS),
+                      key) != eastl::end(RESERVED_KEYS)) {
+        fields.push_back(u8'_');
+      }
+      json_escape(key, fields);
+      fields.append(u8"\":");
+      value.line.clear();
+      replay_arg(value, tag, data, count);
+      append_json(fields, value, tag, data);
+      pending = false;
+    });
+  if (!valid || pending) {
+    return false;
+  }
+
+  const auto index = static_cast<size_t>(level);
+  out.append(u8"{\"level\":\"");
+  out.append(LEVEL_NAMES[index].data(), LEVEL_NAMES[index].size());
+  out.push_back(u8'"');
+  if (has_site) {
+    value.line.clear();
+    value.append(site.id);
+    out.append(u8",\"site\":");
+    out.append(value.line.data(), value.line.size());
+    if (!site.file.empty()) {
+      value.line.clear();
+      value.append(site.line);
+      out.append(u8",\"file\":\"");
+      json_escape(site.file, out);
+      out.append(u8"\",\"line\":");
+      out.append(value.line.data(), value.line.size());
+    }
+  }
+  out.append(u8",\"msg\":\"");
+  json_escape(message.line, out);
+  out.push_back(u8'"');
+  out.append(fields.data(), fields.size());
+  out.push_back(u8'}');
+  return true;
+}
+
+bool
+read_site(eastl::u8string_view line, SiteInfo& site)
+{
+  bool found = false;
+  const bool valid =
+    walk(line, [&](TAG tag, const char8_t* data, uint32_t count) {
+      if (tag == TAG::SITE || tag == TAG::SITE_INFO) {
+        found = true;
+        site.id = get<uint32_t>(data);
+      }
+      if (tag == TAG::SITE_INFO) {
+        site.line = get<uint32_t>(data + 4);
+        site.file = eastl::u8string_view(data + 12, count - 12);
+      }
+    });
+  return valid && found;
+}
+
+void
+OStream::encode(FieldKey key)
+{
+  put(line, TAG::FIELD, key.name);
+}
+
+void
+OStream::encode(char8_t c)
+{
+  put(line, TAG::CHAR8, c);
+}
+
+void
+OStream::encode(char16_t c)
+{
+  put(line, TAG::CHAR16, c);
+}
+
+void
+OStream::encode(char32_t c)
+{
+  put(line, TAG::CHAR32, c);
+}
+
+void
+OStream::encode(eastl::u8string_view str)
+{
+  put(line, TAG::STR8, str);
+}
+
+void
+OStream::encode(eastl::u16string_view str)
+{
+  put(line, TAG::STR16, str);
+}
+
+void
+OStream::encode(eastl::u32string_view str)
+{
+  put(line, TAG::STR32, str);
+}
+
+void
+OStream::encode(int8_t x)
+{
+  put(line, TAG::INT8, x);
+}
+
+void
+OStream::encode(int16_t x)
+{
+  put(line, TAG::INT16, x);
+}
+
+void
+OStream::encode(int32_t x)
+{
+  put(line, TAG::INT32, x);
+}
+
+void
+OStream::encode(int64_t x)
+{
+  put(line, TAG::INT64, x);
+}
+
+void
+OStream::encode(uint8_t x)
+{
+  put(line, TAG::UINT8, x);
+}
+
+void
+OStream::encode(uint16_t x)
+{
+  put(line, TAG::UINT16, x);
+}
+
+void
+OStream::encode(uint32_t x)
+{
+  put(line, TAG::UINT32, x);
+}
+
+void
+OStream::encode(uint64_t x)
+{
+  put(line, TAG::UINT64, x);
+}
+
+void
+OStream::encode(float x)
+{
+  put(line, TAG::FLOAT, x);
+}
+
+void
+OStream::encode(double x)
+{
+  put(line, TAG::DOUBLE, x);
+}
+
+void
+OStream::encode(long double x)
+{
+  encode(static_cast<double>(x));
+}
+
+void
+OStream::encode(FloatFormat f)
+{
+  put(line, TAG::FLOAT_FORMAT, static_cast<uint8_t>(f.notation));
+  put(line, f.precision);
+}
+
+void
+describe_sites()
+{
+  site_generation.fetch_add(1, eastl::memory_order_relaxed);
+}
+
+void
+OStream::encode(const Site& site)
+{
+  const uint32_t generation =
+    site_generation.load(eastl::memory_order_relaxed);
+  if (site.described.exchange(generation, eastl::memory_order_relaxed) ==
+      generation) {
+    put(line, TAG::SITE, site.id);
+    return;
+  }
+
+  const auto file = reinterpret_cast<const char8_t*>(site.file);
+  const size_t size = strlen(site.file);
+  put(line, TAG::SITE_INFO, site.id);
+  put(line, site.line);
+  put(line, static_cast<uint32_t>(size));
+  line.append(file, size);
+}
+
+}
@@ -0,0 +1,131 @@
+/* extend - expansible programming language
+ * Copyright (C) 2022 Vladimir Liutov vs@lutov.net
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/** Binary log format.
+ *
+ * A binary line is a sequence of arguments, each one is a tag followed by
+ * the raw value in host byte order. Strings are a tag, uint32_t count of code
+ * units and the units. Nothing is formatted until logdecode reads the file.
+ */
+
+#pragma once
+
+#include <EASTL/string_view.h>
+
+#include "json.h"
+#include "log.h"
+
+namespace extend::log {
+
+enum struct TAG : uint8_t
+{
+  CHAR8,
+  CHAR16,
+  CHAR32,
+  STR8,
+  STR16,
+  STR32,
+  INT8,
+  INT16,
+  INT32,
+  INT64,
+  UINT8,
+  UINT16,
+  UINT32,
+  UINT64,
+  FLOAT,
+  DOUBLE,
+  /** uint32_t site id. */
+  SITE,
+  /** uint32_t site id, uint32_t line, uint32_t file size and file. */
+  SITE_INFO,
+  /** uint32_t key size and key, the next argument is the value. */
+  FIELD,
+  /** uint8_t notation and uint32_t precision, up to MAX_PRECISION, of the
+   * following floats.
+   */
+  FLOAT_FORMAT
+};
+
+/** Write binary lines to file descriptor.
+ *
+ * Every line is framed as uint32_t size, uint8_t level and the line, and
+ * written with single write call.
+ */
+struct BinaryPipe : IPipe
+{
+  explicit BinaryPipe(int fd);
+
+  virtual void log(LEVEL level, eastl::u8string_view str) override;
+  virtual FORMAT format() const override;
+
+  int fd;
+};
+
+/** Framed line read back from BinaryPipe output.
+ */
+struct BinaryRecord
+{
+  LEVEL level = LEVEL::DEBUG;
+  eastl::u8string_view line;
+};
+
+/** Call site stored in binary line.
+ *
+ * File is empty, if the line refers to site described before.
+ */
+struct SiteInfo
+{
+  uint32_t id = 0;
+  uint32_t line = 0;
+  eastl::u8string_view file;
+};
+
+/** Cut the next record from data.
+ *
+ * @param  data   BinaryPipe output, the record is removed from it.
+ * @param  record Record view into data.
+ * @return        False at the end of data or on truncated record.
+ */
+bool
+next_record(eastl::u8string_view& data, BinaryRecord& record);
+
+/** Format binary line into the stream, the same as text format does.
+ *
+ * @return False if the line is malformed.
+ */
+bool
+replay(eastl::u8string_view line, OStream& out);
+
+/** Write binary line as a JSON object without the newline.
+ *
+ * Fields become members, the other arguments are formatted as text into
+ * "msg" member, e.g. {"level":"INFO","site":1,"msg":"done","op":"parse"}.
+ *
+ * @return False if the line is malformed.
+ */
+bool
+to_json(LEVEL level, eastl::u8string_view line, JsonLine& out);
+
+/** Find site of binary line.
+ *
+ * @return False if the line has no site or is malformed.
+ */
+bool
+read_site(eastl::u8string_view line, SiteInfo& site);
+
+}
@@ -0,0 +1,124 @@
+/* extend - expansible programming language
+ * Copyright (C) 2022 Vladimir Liutov vs@lutov.net
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "clock.h"
+
+#include <EASTL/atomic.h>
+#include <ctime>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#include <x86intrin.h>
+#define EXTEND_LOG_TSC 1
+#else
+#define EXTEND_LOG_TSC 0
+#endif
+
+namespace extend::log {
+
+namespace {
+constexpr int64_t NS_PER_SECOND = 1000000000;
+constexpr int64_t CALIBRATION_NS = NS_PER_SECOND / 10;
+
+// Nanoseconds per tick in 32.32 fixed point, zero until calibrated
+eastl::atomic<uint64_t> ns_per_tick{ 0 };
+
+#if EXTEND_LOG_TSC
+bool
+invariant_tsc()
+{
+  unsigned eax = 0, ebx = 0, ecx = 0, edx = 0;
+  if (__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) == 0) {
+    return false;
+  }
+  return (edx & (1U << 8)) != 0;
+}
+
+const bool has_tsc = invariant_tsc();
+
+/** TSC and system clock read together by the thread.
+ */
+struct Anchor
+{
+  uint64_t tsc = 0;
+  int64_t ns = 0;
+};
+
+thread_local Anchor anchor;
+
+int64_t
+elapsed(uint64_t ticks, uint64_t scale)
+{
+  return static_cast<int64_t>(
+    (static_cast<unsigned __int128>(ticks) * scale) >> 32);
+}
+#endif
+}
+
+int64_t
+Clock::system()
+{
+  timespec time;
+  clock_gettime(CLOCK_REALTIME, &time);
+  return time.tv_sec * NS_PER_SECOND + time.tv_nsec;
+}
+
+int64_t
+Clock::now()
+{
+#if EXTEND_LOG_TSC
+  if (!has_tsc) {
+    return system();
+  }
+
+  const uint64_t tsc = __rdtsc();
+  const uint64_t scale = ns_per_tick.load(eastl::memory_order_relaxed);
+  if (scale != 0 && anchor.tsc != 0) {
+    const int64_t ns = elapsed(tsc - anchor.tsc, scale);
+    if (ns < NS_PER_SECOND) {
+      return anchor.ns + ns;
+    }
+  }
+
+  // Anchor again, the first anchors of the thread measure the frequency
+  const int64_t ns = system();
+  if (scale == 0 && anchor.tsc != 0) {
+    if (ns - anchor.ns < CALIBRATION_NS) {
+      return ns;
+    }
+    const uint64_t ticks = tsc - anchor.tsc;
+    if (ticks != 0) {
+      ns_per_tick.store(
+        (static_cast<unsigned __int128>(ns - anchor.ns) << 32) / ticks,
+        eastl::memory_order_relaxed);
+    }
+  }
+  anchor.tsc = tsc;
+  anchor.ns = ns;
+  return ns;
+#else
+  return system();
+#endif
+}
+
+bool
+Clock::calibrated()
+{
+  return ns_per_tick.load(eastl::memory_order_relaxed) != 0;
+}
+
+}
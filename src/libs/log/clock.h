@@ -0,0 +1,46 @@
+/* extend - expansible programming language
+ * Copyright (C) 2022 Vladimir Liutov vs@lutov.net
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cinttypes>
+
+namespace extend::log {
+
+/** Wall clock for log timestamps.
+ *
+ * Where TSC is invariant, a reading is one rdtsc scaled by the frequency
+ * measured against the system clock during the first 100 ms. Each thread
+ * anchors TSC to the system clock once per second, so drift between them
+ * does not accumulate. Elsewhere it is clock_gettime.
+ */
+struct Clock
+{
+  /** Nanoseconds since the epoch.
+   */
+  static int64_t now();
+
+  /** Nanoseconds since the epoch from the system clock.
+   */
+  static int64_t system();
+
+  /** Whether now() reads TSC, false until calibrated.
+   */
+  static bool calibrated();
+};
+
+}
@@ -0,0 +1,465 @@
+/* extend - expansible programming language
+ * Copyright (C) 2022 Vladimir Liutov vs@lutov.net
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "compress.h"
+
+#include <EASTL/algorithm.h>
+#include <cerrno>
+#include <cstring>
+#include <unistd.h>
+
+#include "clock.h"
+
+namespace extend::log {
+
+namespace {
+constexpr size_t MIN_MATCH = 4;
+constexpr size_t MAX_OFFSET = 65535;
+constexpr unsigned HASH_BITS = 12;
+// Count of a token field that is continued by extra bytes
+constexpr size_t RUN_MASK = 15;
+// Writer thread checks the delay of the filling block at least this often
+constexpr int64_t WRITER_POLL_MS = 50;
+
+uint32_t
+read32(const char8_t* p)
+{
+  uint32_t x;
+  memcpy(&x, p, sizeof(x));
+  return x;
+}
+
+uint64_t
+read64(const char8_t* p)
+{
+  uint64_t x;
+  memcpy(&x, p, sizeof(x));
+  return x;
+}
+
+uint32_t
+hash(uint32_t x)
+{
+  return (x * 2654435761u) >> (32 - HASH_BITS);
+}
+
+// Extra bytes of count beyond the token field
+char8_t*
+put_count(char8_t* op, size_t count)
+{
+  for (; count >= 255; count -= 255) {
+    *op++ = 255;
+  }
+  *op++ = static_cast<char8_t>(count);
+  return op;
+}
+
+bool
+get_count(const char8_t*& ip, const char8_t* end, size_t& count)
+{
+  while (ip != end) {
+    const char8_t c = *ip++;
+    count += c;
+    if (c != 255) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Write literals and the match after them, nullptr if out of space
+char8_t*
+put_sequence(char8_t* op,
+             const char8_t* end,
+             const char8_t* literals,
+             size_t literal_count,
+             size_t offset,
+             size_t match_count)
+{
+  const size_t space = 1 + literal_count / 255 + 1 + literal_count + 2 +
+                       match_count / 255 + 1;
+  if (static_cast<size_t>(end - op) < space) {
+    return nullptr;
+  }
+
+  const size_t extra = match_count - MIN_MATCH;
+  char8_t* token = op++;
+  *token = static_cast<char8_t>(eastl::min(literal_count, RUN_MASK) << 4);
+  if (literal_count >= RUN_MASK) {
+    op = put_count(op, literal_count - RUN_MASK);
+  }
+  memcpy(op, literals, literal_count);
+  op += literal_count;
+  if (match_count == 0) {
+    return op;
+  }
+
+  *op++ = static_cast<char8_t>(offset);
+  *op++ = static_cast<char8_t>(offset >> 8);
+  *token |= static_cast<char8_t>(eastl::min(extra, RUN_MASK));
+  if (extra >= RUN_MASK) {
+    op = put_count(op, extra - RUN_MASK);
+  }
+  return op;
+}
+
+bool
+write_all(int fd, const char8_t* data, size_t size)
+{
+  while (size != 0) {
+    const ssize_t written = ::write(fd, data, size);
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    data += written;
+    size -= written;
+  }
+  return true;
+}
+}
+
+size_t
+lz_compress(eastl::u8string_view src, char8_t* dst, size_t capacity)
+{
+  // Positions are stored plus one, zero is an empty slot
+  uint32_t table[1 << HASH_BITS] = {};
+  const char8_t* const begin = src.data();
+  const size_t size = src.size();
+  char8_t* op = dst;
+  const char8_t* const end = dst + capacity;
+
+  size_t anchor = 0;
+  size_t pos = 0;
+  while (pos + MIN_MATCH <= size) {
+    const uint32_t x = read32(begin + pos);
+    uint32_t& slot = table[hash(x)];
+    const size_t candidate = slot;
+    slot = static_cast<uint32_t>(pos + 1);
+    if (candidate == 0 || pos + 1 - candidate > MAX_OFFSET ||
+        read32(begin + candidate - 1) != x) {
+      // Step faster over data without matches
+      pos += 1 + ((pos - anchor) >> 6);
+      continue;
+    }
+
+    const size_t offset = pos + 1 - candidate;
+    size_t match = pos + MIN_MATCH;
+    while (match + sizeof(uint64_t) <= size &&
+           read64(begin + match) == read64(begin + match - offset)) {
+      match += sizeof(uint64_t);
+    }
+    while (match < size && begin[match] == begin[match - offset]) {
+      ++match;
+    }
+
+    op = put_sequence(
+      op, end, begin + anchor, pos - anchor, offset, match - pos);
+    if (op == nullptr) {
+      return 0;
+    }
+    pos = anchor = match;
+  }
+
+  op = put_sequence(op, end, begin + anchor, size - anchor, 0, 0);
+  return op == nullptr ? 0 : op - dst;
+}
+
+bool
+lz_decompress(eastl::u8string_view src, char8_t* dst, size_t size)
+{
+  const char8_t* ip = src.data();
+  const char8_t* const end = ip + src.size();
+  size_t out = 0;
+  while (ip != end) {
+    const char8_t token = *ip++;
+
+    size_t literals = token >> 4;
+    if (literals == RUN_MASK && !get_count(ip, end, literals)) {
+      return false;
+    }
+    if (literals > static_cast<size_t>(end - ip) || literals > size - out) {
+      return false;
+    }
+    memcpy(dst + out, ip, literals);
+    ip += literals;
+    out += literals;
+    if (ip == end) {
+      return out == size;
+    }
+
+    if (end - ip < 2) {
+      return false;
+    }
+    const size_t offset = ip[0] | (ip[1] << 8);
+    ip += 2;
+    size_t count = token & RUN_MASK;
+    if (count == RUN_MASK && !get_count(ip, end, count)) {
+      return false;
+    }
+    count += MIN_MATCH;
+    if (offset == 0 || offset > out || count > size - out) {
+      return false;
+    }
+
+    char8_t* op = dst + out;
+    if (offset >= count) {
+      memcpy(op, op - offset, count);
+    } else {
+      // Overlapping match repeats the last offset bytes
+      for (size_t i = 0; i < count; ++i) {
+        op[i] = op[i - offset];
+      }
+    }
+    out += count;
+  }
+  return false;
+}
+
+bool
+read_index(eastl::u8string_view data, eastl::vector<BlockIndex>& index)
+{
+  size_t offset = 0;
+  while (offset != data.size()) {
+    BlockIndex block;
+    block.offset = offset;
+    if (data.size() - offset < sizeof(BlockHeader)) {
+      return false;
+    }
+    memcpy(static_cast<void*>(&block.header),
+           data.data() + offset,
+           sizeof(BlockHeader));
+    const BlockHeader& header = block.header;
+    offset += sizeof(BlockHeader);
+    if (header.magic != BlockHeader::MAGIC ||
+        header.size > BlockHeader::MAX_SIZE || header.packed > header.size ||
+        data.size() - offset < header.packed) {
+      return false;
+    }
+    offset += header.packed;
+    index.push_back(block);
+  }
+  return true;
+}
+
+size_t
+find_line(const eastl::vector<BlockIndex>& index, uint64_t line)
+{
+  // The last block starting at or before the line
+  const auto next = eastl::upper_bound(
+    index.begin(), index.end(), line, [](uint64_t l, const BlockIndex& b) {
+      return l < b.header.first_line;
+    });
+  if (next == index.begin()) {
+    return index.size();
+  }
+  const BlockHeader& header = (next - 1)->header;
+  if (line - header.first_line >= header.lines) {
+    return index.size();
+  }
+  return next - 1 - index.begin();
+}
+
+bool
+decode_block(eastl::u8string_view data,
+             const BlockIndex& block,
+             eastl::u8string& out)
+{
+  const BlockHeader& header = block.header;
+  if (block.offset > data.size() ||
+      data.size() - block.offset < sizeof(BlockHeader) + header.packed ||
+      header.size > BlockHeader::MAX_SIZE || header.packed > header.size) {
+    return false;
+  }
+
+  const char8_t* packed = data.data() + block.offset + sizeof(BlockHeader);
+  if (header.packed == header.size) {
+    out.append(packed, header.size);
+    return true;
+  }
+  const size_t start = out.size();
+  out.resize(start + header.size);
+  if (!lz_decompress({ packed, header.packed }, &out[start], header.size)) {
+    out.resize(start);
+    return false;
+  }
+  return true;
+}
+
+bool
+decompress(eastl::u8string_view data, eastl::u8string& out)
+{
+  eastl::vector<BlockIndex> index;
+  const bool complete = read_index(data, index);
+  for (const BlockIndex& block : index) {
+    if (!decode_block(data, block, out)) {
+      return false;
+    }
+  }
+  return complete;
+}
+
+CompressPipe::CompressPipe(int f, size_t size, int64_t delay, Prefix p)
+  : fd(f)
+  , block_size(size)
+  , delay_ms(delay)
+  , prefix(p)
+{
+  for (Block& block : blocks) {
+    block.text.reserve(block_size);
+  }
+
+  EA::Thread::ThreadParameters params;
+  params.mpName = "extend-lz";
+  writer.Begin(&CompressPipe::run, this, &params);
+}
+
+CompressPipe::~CompressPipe()
+{
+  running.store(false, eastl::memory_order_release);
+  signal.Post();
+  writer.WaitForEnd();
+}
+
+void
+CompressPipe::log(LEVEL level, eastl::u8string_view str)
+{
+  char8_t head[Prefix::MAX_SIZE];
+  const size_t head_size = prefix.write(level, head);
+  log_prefixed(level, { head, head_size }, str);
+}
+
+void
+CompressPipe::log_prefixed(LEVEL level,
+                           eastl::u8string_view head,
+                           eastl::u8string_view str)
+{
+  const size_t size = head.size() + str.size() + 1;
+  for (;;) {
+    bool appended = false;
+    bool wake = false;
+    {
+      EA::Thread::AutoFutex guard(lock);
+      Block& block = *filling;
+      if (block.text.empty() || block.text.size() + size <= block_size) {
+        if (block.text.empty()) {
+          block.header.first_line = line_count;
+          block.header.first_time = Clock::now();
+        }
+        block.text.append(head.data(), head.size());
+        block.text.append(str.data(), str.size());
+        block.text.push_back(u8'\n');
+        ++block.header.lines;
+        ++line_count;
+        appended = true;
+        if (level < LEVEL::ERROR && block.text.size() < block_size) {
+          return;
+        }
+      }
+      wake = !ready;
+      ready = true;
+    }
+
+    if (wake) {
+      signal.Post();
+    }
+    if (appended) {
+      return;
+    }
+    // Both blocks are busy, wait for the writer to take the filling one
+    EA::Thread::ThreadSleep();
+  }
+}
+
+void
+CompressPipe::flush()
+{
+  const uint64_t target =
+    requested.fetch_add(1, eastl::memory_order_acq_rel) + 1;
+  signal.Post();
+  while (flushed.load(eastl::memory_order_acquire) < target) {
+    EA::Thread::ThreadSleep();
+  }
+}
+
+CompressPipe::Block*
+CompressPipe::take(bool force)
+{
+  EA::Thread::AutoFutex guard(lock);
+  Block* block = filling;
+  if (block->text.empty() ||
+      !(force || ready ||
+        Clock::now() - block->header.first_time >= delay_ms * 1000000)) {
+    return nullptr;
+  }
+  filling = block == &blocks[0] ? &blocks[1] : &blocks[0];
+  ready = false;
+  return block;
+}
+
+void
+CompressPipe::write_block(Block& block)
+{
+  BlockHeader& header = block.header;
+  const eastl::u8string_view text(block.text.data(), block.text.size());
+  header.size = static_cast<uint32_t>(text.size());
+
+  // Text that does not get smaller is stored as is
+  packed.resize(sizeof(BlockHeader) + text.size());
+  char8_t* body = &packed[sizeof(BlockHeader)];
+  header.packed =
+    static_cast<uint32_t>(lz_compress(text, body, text.size() - 1));
+  if (header.packed == 0) {
+    memcpy(body, text.data(), text.size());
+    header.packed = header.size;
+  }
+  memcpy(packed.data(), &header, sizeof(BlockHeader));
+  write_all(fd, packed.data(), sizeof(BlockHeader) + header.packed);
+
+  header = BlockHeader();
+  block.text.clear();
+}
+
+intptr_t
+CompressPipe::run(void* context)
+{
+  CompressPipe& self = *static_cast<CompressPipe*>(context);
+  const int64_t poll = eastl::clamp<int64_t>(self.delay_ms, 1, WRITER_POLL_MS);
+  for (;;) {
+    // Producers are gone once running is false, so one more block is enough
+    const bool stopping = !self.running.load(eastl::memory_order_acquire);
+    const uint64_t target = self.requested.load(eastl::memory_order_acquire);
+    const bool force =
+      stopping || target != self.flushed.load(eastl::memory_order_relaxed);
+    Block* block = self.take(force);
+    if (block != nullptr) {
+      self.write_block(*block);
+    }
+    self.flushed.store(target, eastl::memory_order_release);
+    if (stopping) {
+      break;
+    }
+    if (block == nullptr) {
+      self.signal.Wait(EA::Thread::GetThreadTime() + poll);
+    }
+  }
+  return 0;
+}
+
+}
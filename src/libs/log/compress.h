@@ -0,0 +1,198 @@
+/* extend - expansible programming language
+ * Copyright (C) 2022 Vladimir Liutov vs@lutov.net
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/** Block compressed text logs.
+ *
+ * CompressPipe output is a sequence of blocks. A block is a BlockHeader
+ * followed by the packed text of whole lines, so every block is decoded on
+ * its own and a reader seeks by the headers without decoding the rest.
+ * Header fields are in host byte order.
+ *
+ * Text is packed with an in-tree LZ77 in the layout of LZ4 blocks: a token
+ * with 4-bit counts of literals and of match bytes, extended by 255-bytes,
+ * the literals and 2-byte little endian offset of the match. The last
+ * sequence has literals only.
+ */
+
+#pragma once
+
+#include <EASTL/atomic.h>
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+#include <eathread/eathread_futex.h>
+#include <eathread/eathread_semaphore.h>
+#include <eathread/eathread_thread.h>
+
+#include "log.h"
+
+namespace extend::log {
+
+/** Size of lz_compress output in the worst case.
+ */
+constexpr size_t
+lz_bound(size_t size)
+{
+  return size + size / 255 + 16;
+}
+
+/** Pack src into dst.
+ *
+ * @return Packed size, zero if it does not fit into capacity.
+ */
+size_t
+lz_compress(eastl::u8string_view src, char8_t* dst, size_t capacity);
+
+/** Unpack src into exactly size chars of dst.
+ *
+ * @return False if src is malformed or does not unpack to size chars.
+ */
+bool
+lz_decompress(eastl::u8string_view src, char8_t* dst, size_t size);
+
+struct BlockHeader
+{
+  /** "XLZ1" */
+  static constexpr uint32_t MAGIC = 0x315a4c58;
+  /** Largest size of unpacked block readers accept. */
+  static constexpr uint32_t MAX_SIZE = 1 << 30;
+
+  uint32_t magic = MAGIC;
+  /** Size of the text. */
+  uint32_t size = 0;
+  /** Size of the packed text after the header, equal to size if stored. */
+  uint32_t packed = 0;
+  /** Count of lines in the block. */
+  uint32_t lines = 0;
+  /** Number of the first line since the pipe was created. */
+  uint64_t first_line = 0;
+  /** Clock::now() of the first line, nanoseconds since the epoch. */
+  int64_t first_time = 0;
+};
+
+/** Header of a block and its offset in the data.
+ */
+struct BlockIndex
+{
+  uint64_t offset = 0;
+  BlockHeader header;
+};
+
+/** Read headers of every block without decoding them.
+ *
+ * @return False on unknown or truncated block, index holds the blocks
+ *         before it.
+ */
+bool
+read_index(eastl::u8string_view data, eastl::vector<BlockIndex>& index);
+
+/** Find the block of the line, e.g. to decode from it on.
+ *
+ * @return Position in index, index.size() if the line is not there.
+ */
+size_t
+find_line(const eastl::vector<BlockIndex>& index, uint64_t line);
+
+/** Append text of the block to out.
+ *
+ * @return False if the block is malformed.
+ */
+bool
+decode_block(eastl::u8string_view data,
+             const BlockIndex& block,
+             eastl::u8string& out);
+
+/** Append text of every block to out.
+ *
+ * @return False on malformed or truncated block.
+ */
+bool
+decompress(eastl::u8string_view data, eastl::u8string& out);
+
+/** Write logs to file descriptor as compressed blocks.
+ *
+ * Producers only append the line to the text of the current block under a
+ * lock. The writer thread packs full blocks and writes each one with single
+ * write call, while producers fill the other block. A block is written when
+ * it is full, when its first line is older than the delay, on flush() and
+ * right away at ERROR and FATAL. When both blocks are busy producers wait
+ * for the writer.
+ */
+struct CompressPipe : IPipe
+{
+  static constexpr size_t DEFAULT_BLOCK_SIZE = 64 << 10;
+  static constexpr int64_t DEFAULT_DELAY_MS = 1000;
+
+  /** Start writer thread.
+   *
+   * @param fd         File descriptor, the pipe does not close it.
+   * @param block_size Size of text to pack at once, longer lines make a
+   *                   block of their own.
+   * @param delay_ms   How long a line may wait in the block.
+   * @param prefix     Fields written before each line.
+   */
+  explicit CompressPipe(int fd,
+                        size_t block_size = DEFAULT_BLOCK_SIZE,
+                        int64_t delay_ms = DEFAULT_DELAY_MS,
+                        Prefix prefix = {});
+
+  /** Write the last block and stop writer thread.
+   */
+  virtual ~CompressPipe() override;
+
+  virtual void log(LEVEL level, eastl::u8string_view str) override;
+
+  virtual void log_prefixed(LEVEL level,
+                            eastl::u8string_view head,
+                            eastl::u8string_view str) override;
+
+  /** Wait until every line logged before the call is written.
+   */
+  virtual void flush() override;
+
+  const int fd;
+  const size_t block_size;
+  const int64_t delay_ms;
+  const Prefix prefix;
+
+private:
+  struct Block
+  {
+    BlockHeader header;
+    eastl::u8string text;
+  };
+
+  Block* take(bool force);
+  void write_block(Block& block);
+  static intptr_t run(void* context);
+
+  EA::Thread::Futex lock;
+  Block blocks[2];
+  /** Block of producers, the other one belongs to the writer. */
+  Block* filling = &blocks[0];
+  /** The filling block should be written without waiting for the delay. */
+  bool ready = false;
+  uint64_t line_count = 0;
+  eastl::u8string packed;
+
+  eastl::atomic<uint64_t> requested{ 0 };
+  eastl::atomic<uint64_t> flushed{ 0 };
+  eastl::atomic<bool> running{ true };
+  EA::Thread::Semaphore signal{ 0 };
+  EA::Thread::Thread writer;
+};
+
+}
@@ -17,9 +17,10 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
-/** This is a C++ header-only implementation of Grisu2 algorithm from the
- * publication: Loitsch, Florian. "Printing floating-point numbers quickly and
- * accurately with integers." ACM Sigplan Notices 45.6 (2010): 233-243.
+/** Float to string conversions. dtoa and ftoa implement the Ryu algorithm
+ * from the publication: Adams, Ulf. "Ryu: fast float-to-string conversion."
+ * ACM SIGPLAN Notices 53.4 (2018): 270-282. dtoa_prettify comes from the
+ * Grisu2 implementation of RapidJSON.
  */
 
 #pragma once
@@ -28,6 +29,12 @@
 
 namespace extend::log {
 
+/** All two-digit numbers, "00" to "99".
+ *
+ * Used to write decimal digits by pairs.
+ */
+extern const char8_t DIGIT_TABLE[200];
+
 /** Prettify print.
  * For example convert 1234e-2 -> 12.34
  *
@@ -56,4 +63,45 @@ dtoa(double x, char8_t* buffer);
 int
 ftoa(float x, char8_t* buffer);
 
+/** Write float with fixed count of digits after the point, as printf "%.*f".
+ * @param  x         Floating point value.
+ * @param  precision Count of digits after the point.
+ * @param  buffer    String should be at least dtoa_fixed_length char length.
+ * @return           Count of written chars.
+ */
+int
+dtoa_fixed(double x, uint32_t precision, char8_t* buffer);
+
+/** Upper bound of chars dtoa_fixed writes for x and precision.
+ */
+uint32_t
+dtoa_fixed_length(double x, uint32_t precision);
+
+/** Write float in scientific notation, as printf "%.*e".
+ * @param  x         Floating point value.
+ * @param  precision Count of digits after the point.
+ * @param  buffer    String should be at least precision + 8 char length.
+ * @return           Count of written chars.
+ */
+int
+dtoa_exp(double x, uint32_t precision, char8_t* buffer);
+
+/** Write integer in decimal.
+ * @param  x      Integer value.
+ * @param  buffer String should be at least 10 char length for 32-bit values
+ *                and 20 char length for 64-bit values, plus one for minus.
+ * @return        Count of written chars.
+ */
+int
+itoa(int32_t x, char8_t* buffer);
+
+int
+itoa(int64_t x, char8_t* buffer);
+
+int
+utoa(uint32_t x, char8_t* buffer);
+
+int
+utoa(uint64_t x, char8_t* buffer);
+
 } // namespace extend::log
@@ -0,0 +1,4722 @@
+/* extend - expansible programming language
+ * Copyright (C) 2022 Vladimir Liutov vs@lutov.net
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/** Fixed and scientific notations with explicit precision, the way of Ryu
+ * printf from the publication: Adams, Ulf. "Ryu revisited: printf floating
+ * point conversion." Proceedings of the ACM on Programming Languages 3.OOPSLA
+ * (2019): 1-23.
+ *
+ * Decimal digits of m * 2^e are computed by blocks of 9: every block is
+ * floor(m * 2^e / 10^(9 * i)) mod 10^9 above the point and
+ * floor(m * 2^e * 10^(9 * (i + 1))) mod 10^9 below it, a multiply of m by a
+ * 192-bit table entry and a shift. Entries are rounded up with 128 extra
+ * bits and reduced modulo 10^9 * 2^143, which keeps the blocks exact: for
+ * every entry and exponent the distance of m * 2^e / 10^(9 * i) to the next
+ * integer over all 53-bit m is above the rounding error, as checked with
+ * Euclid minimum of modular multiples when the tables were generated.
+ */
+
+#include "dtoa.h"
+
+#include <cassert>
+#include <cstring>
+
+namespace extend::log {
+
+namespace {
+constexpr int MANTISSA_BITS = 52;
+constexpr int EXPONENT_BITS = 11;
+constexpr int EXPONENT_BIAS = 1023 + MANTISSA_BITS;
+constexpr uint32_t MAX_EXPONENT = (1u << EXPONENT_BITS) - 1;
+
+constexpr int ADDITIONAL_BITS = 128;
+constexpr int EXPONENT_STEP = 16;
+constexpr uint32_t BLOCK = 1000000000;
+constexpr int BLOCK_DIGITS = 9;
+
+constexpr int POSITIVE_ROWS = 62;
+constexpr int NEGATIVE_ROWS = 68;
+
+// First entry of each row of POSITIVE_SPLIT
+const uint16_t POSITIVE_OFFSET[POSITIVE_ROWS + 1] = {
+  0, 2, 5, 8, 12, 16, 21, 26, 32, 39, 46, 54, 62, 71, 80, 90, 100, 111, 122,
+  134, 146, 159, 173, 187, 202, 217, 233, 249, 266, 283, 301, 319, 338, 357,
+  377, 397, 418, 440, 462, 485, 508, 532, 556, 581, 606, 632, 658, 685, 712,
+  740, 768, 797, 827, 857, 888, 919, 951, 983, 1016, 1049, 1083, 1117, 1152
+};
+
+// floor(2^(16 * row + 128) / 10^(9 * i)) + 1 mod 10^9 * 2^143
+const uint64_t POSITIVE_SPLIT[1152][3] = {
+  { 1u, 0u, 1u },
+  { 13088917067439035464u, 18446744073u, 0u },
+  { 1u, 0u, 65536u },
+  { 3222760116768457898u, 1208925819614629u, 0u },
+  { 15119221303454162919u, 1208925u, 0u },
+  { 1u, 0u, 4294967296u },
+  { 10034112637000319368u, 5441186219426131129u, 4u },
+  { 4876167937165510093u, 79228162514u, 0u },
+  { 1u, 0u, 19330976710656u },
+  { 6073038854834089660u, 18017131505296968512u, 281474u },
+  { 11594341208306763892u, 5192296858534827u, 0u },
+  { 15837172243629846354u, 5192296u, 0u },
+  { 1u, 0u, 31241709551616u },
+  { 14171000123323785969u, 13088917067439035463u, 18446744073u },
+  { 6910287421937809895u, 8240973594166534375u, 18u },
+  { 17311595331398480488u, 340282366920u, 0u },
+  { 1u, 0u, 13733174706176u },
+  { 9333691240261093590u, 3222760116768457897u, 29277819614629u },
+  { 5029474546817063679u, 15119221303454162918u, 1208925u },
+  { 2610873172264200859u, 22300745198530623u, 0u },
+  { 3662243595885988376u, 22300745u, 0u },
+  { 1u, 0u, 11449543950336u },
+  { 17202381616007468624u, 10034112637000319367u, 20946264337593u },
+  { 5220791160816953485u, 4876167937165510092u, 79228162514u },
+  { 12632933850576207590u, 4208855507848340539u, 79u },
+  { 16655901022867661740u, 1461501637330u, 0u },
+  { 1u, 0u, 2880329220096u },
+  { 2517521906216705082u, 6073038854834089659u, 17323628530496u },
+  { 18007180208809742991u, 11594341208306763891u, 14952858534827u },
+  { 3632059203954484473u, 15837172243629846353u, 5192296u },
+  { 11942361039781994868u, 95780971304118053u, 0u },
+  { 5609987903828198365u, 95780971u, 0u },
+  { 1u, 0u, 21575768211456u },
+  { 636650559754554090u, 14171000123323785968u, 8423374607431u },
+  { 6556793060461518626u, 6910287421937809894u, 23496938463463u },
+  { 12293207286749913129u, 17311595331398480487u, 340282366920u },
+  { 14562287877669245910u, 5208750325433214395u, 340u },
+  { 12557876253444324912u, 6277101735386u, 0u },
+  { 1876686641339929939u, 6277u, 0u },
+  { 1u, 0u, 17577505980416u },
+  { 15442733417160581425u, 9333691240261093589u, 24550272648361u },
+  { 7533557415789303170u, 5029474546817063678u, 28735141535718u },
+  { 4532069251349516389u, 2610873172264200858u, 18505198530623u },
+  { 11793697568047102996u, 3662243595885988375u, 22300745u },
+  { 9938041249341630570u, 411376139330301510u, 0u },
+  { 6092987432067857450u, 411376139u, 0u },
+  { 1u, 0u, 391932542976u },
+  { 11257111108733900086u, 17202381616007468623u, 17868283019655u },
+  { 10560412405333068520u, 5220791160816953484u, 9275684832716u },
+  { 2664125644415493072u, 12632933850576207589u, 13010902918203u },
+  { 11633875178438724644u, 16655901022867661739u, 1461501637330u },
+  { 278306389962068585u, 9253575460984883691u, 1461u },
+  { 11802128482151532421u, 26959946667150u, 0u },
+  { 17462926650840139639u, 26959u, 0u },
+  { 1u, 0u, 28347136475136u },
+  { 5397882118778216483u, 2517521906216705081u, 18547976171195u },
+  { 2243238473020964669u, 18007180208809742990u, 12113196894323u },
+  { 16152318826557471254u, 3632059203954484472u, 26405647396689u },
+  { 15264383670780409771u, 11942361039781994867u, 107304118053u },
+  { 13704427729089734299u, 5609987903828198364u, 95780971u },
+  { 10759939715039024913u, 1766847064778384329u, 0u },
+  { 14358656518809075591u, 1766847064u, 0u },
+  { 1u, 0u, 8944034512896u },
+  { 2391434721124085555u, 636650559754554089u, 31206355444464u },
+  { 10773044510523668129u, 6556793060461518625u, 12903666416102u },
+  { 10404691521526147980u, 12293207286749913128u, 9659789423207u },
+  { 18163875069660114338u, 14562287877669245909u, 19930680763835u },
+  { 16746936927887468461u, 12557876253444324911u, 6277101735386u },
+  { 18170203176216613585u, 1876686641339929938u, 6277u },
+  { 3604928599930866897u, 115792089237316u, 0u },
+  { 1646137933681675150u, 115792u, 0u },
+  { 1u, 0u, 2261837152256u },
+  { 1528233351720343106u, 15442733417160581424u, 23294408394965u },
+  { 10009108593445473487u, 7533557415789303169u, 10906245683966u },
+  { 16415614137768065485u, 4532069251349516388u, 18967639337626u },
+  { 874744694177897371u, 11793697568047102995u, 11846538742295u },
+  { 1326352535940547868u, 9938041249341630569u, 6667330301510u },
+  { 9765166359302407610u, 6092987432067857449u, 411376139u },
+  { 5149373071065357655u, 7588550360256754183u, 0u },
+  { 4736278708804760776u, 7588550360u, 0u },
+  { 1u, 0u, 22095610249216u },
+  { 6927362175250037175u, 11257111108733900085u, 26764572481103u },
+  { 9168263004604485131u, 10560412405333068519u, 16101144422540u },
+  { 18020498100598915732u, 2664125644415493071u, 9131630673637u },
+  { 13234440627105184940u, 11633875178438724643u, 2539015087019u },
+  { 2781720080337813460u, 278306389962068584u, 21646639794667u },
+  { 15497118110820412005u, 11802128482151532420u, 26959946667150u },
+  { 4577500896741988948u, 17462926650840139638u, 26959u },
+  { 11845675991886694172u, 497323236409786u, 0u },
+  { 4360990830708119316u, 497323u, 0u },
+  { 1u, 0u, 7225292619776u },
+  { 17235863194371014409u, 5397882118778216482u, 4750121606201u },
+  { 3936300892022257251u, 2243238473020964668u, 9464875618958u },
+  { 12361177891337354103u, 16152318826557471253u, 8563827483896u },
+  { 3288080289702314270u, 15264383670780409770u, 988742918515u },
+  { 12082248621153803145u, 13704427729089734298u, 9161583297500u },
+  { 15190788573447356086u, 10759939715039024912u, 29272778384329u },
+  { 10146642218259313897u, 14358656518809075590u, 1766847064u },
+  { 5444206293619032929u, 14145831547642225764u, 1u },
+  { 6489147305224279243u, 32592575621u, 0u },
+  { 1u, 0u, 19177129639936u },
+  { 1603696768116600036u, 2391434721124085554u, 7969584007913u },
+  { 10146132816281370676u, 10773044510523668128u, 24616564039457u },
+  { 13388289729879258363u, 10404691521526147979u, 21461984665640u },
+  { 11212340929595528955u, 18163875069660114337u, 15919907853269u },
+  { 14203016026849296090u, 16746936927887468460u, 5458985008687u },
+  { 9635779488846778630u, 18170203176216613584u, 18244195423570u },
+  { 2114046760478869415u, 3604928599930866896u, 17488089237316u },
+  { 13026529000504175804u, 1646137933681675149u, 115792u },
+  { 1519919878361453054u, 2135987035920910u, 0u },
+  { 662623835184674049u, 2135987u, 0u },
+  { 1u, 0u, 8496082845696u },
+  { 8770407366184402309u, 1528233351720343105u, 5505542594864u },
+  { 5623366881411048460u, 10009108593445473486u, 4196889892225u },
+  { 14020615445962965313u, 16415614137768065484u, 31763047420004u },
+  { 4371729826306497670u, 874744694177897370u, 26729071901715u },
+  { 4599120285203547521u, 1326352535940547867u, 31785529370729u },
+  { 3054705763403786109u, 9765166359302407609u, 12807279148073u },
+  { 11120501184453323519u, 5149373071065357654u, 5848256754183u },
+  { 9735589837326206270u, 4736278708804760775u, 7588550360u },
+  { 15497894338318159386u, 10856837870145901847u, 7u },
+  { 2080113150513912228u, 139984046386u, 0u },
+  { 1u, 0u, 5429375533056u },
+  { 13765301618780454748u, 6927362175250037174u, 2791497012533u },
+  { 3918835585049683767u, 9168263004604485130u, 25551976893159u },
+  { 4284811082419151689u, 18020498100598915731u, 3107717440463u },
+  { 9303688039585129782u, 13234440627105184939u, 4712150797347u },
+  { 6595590759326472025u, 2781720080337813459u, 1924840100456u },
+  { 9130222534472279499u, 15497118110820412004u, 18294248146820u },
+  { 17647504289754425548u, 4577500896741988947u, 16826642155382u },
+  { 14078301617992317241u, 11845675991886694171u, 5803236409786u },
+  { 10721401644691076271u, 4360990830708119315u, 497323u },
+  { 856727366165267211u, 9173994463960286u, 0u },
+  { 8558556657063816015u, 9173994u, 0u },
+  { 1u, 0u, 24610934358016u },
+  { 3234707703970118100u, 17235863194371014408u, 32572213387298u },
+  { 9237907631697708870u, 3936300892022257250u, 31253670100796u },
+  { 13040807414730386374u, 12361177891337354102u, 14250178247189u },
+  { 6267493929255821153u, 3288080289702314269u, 9882654980010u },
+  { 4528868057457133568u, 12082248621153803144u, 22288823494298u },
+  { 1226500258583449207u, 15190788573447356085u, 16262550050576u },
+  { 9774688051984570139u, 10146642218259313896u, 9316295131014u },
+  { 3223246087569023754u, 5444206293619032928u, 15493351777380u },
+  { 1296418877553432256u, 6489147305224279242u, 32592575621u },
+  { 13042452708786319922u, 10931090831395654627u, 32u },
+  { 1868772121619913533u, 601226901190u, 0u },
+  { 1u, 0u, 28466086936576u },
+  { 18267936389202175370u, 1603696768116600035u, 13984550022962u },
+  { 11820795867273993538u, 10146132816281370675u, 11147725780640u },
+  { 4701796807075008666u, 13388289729879258362u, 11681607822219u },
+  { 11278602492618772206u, 11212340929595528954u, 10156769947041u },
+  { 14231611597729555915u, 14203016026849296089u, 21200522356652u },
+  { 7457017372410806436u, 9635779488846778629u, 3280114602704u },
+  { 12321471222899178553u, 2114046760478869414u, 19341706169552u },
+  { 4989206875465181976u, 13026529000504175803u, 23054082395021u },
+  { 14851099909251089453u, 1519919878361453053u, 6067035920910u },
+  { 1847323614478712721u, 662623835184674048u, 2135987u },
+  { 3915857124940076471u, 39402006196394479u, 0u },
+  { 3622838695518382112u, 39402006u, 0u },
+  { 1u, 0u, 5697475444736u },
+  { 13788819003865145581u, 8770407366184402308u, 3278304843329u },
+  { 16660582235820388093u, 5623366881411048459u, 14796760059086u },
+  { 2542541223417715509u, 14020615445962965312u, 7066236991948u },
+  { 11904666795831562127u, 4371729826306497669u, 17691249318810u },
+  { 15517302049246721722u, 4599120285203547520u, 1465165595931u },
+  { 11946517601169134466u, 3054705763403786108u, 7510602843577u },
+  { 12162981358653152520u, 11120501184453323518u, 13511527767382u },
+  { 4123083984363531839u, 9735589837326206269u, 5399840142535u },
+  { 13019579689745532944u, 15497894338318159385u, 2354112763159u },
+  { 219042721129607157u, 2080113150513912227u, 139984046386u },
+  { 16955730699279030921u, 18152451841280915031u, 139u },
+  { 16760520850760786773u, 2582249878086u, 0u },
+  { 4609437118830906529u, 2582u, 0u },
+  { 1u, 0u, 31158746218496u },
+  { 13390298496375776222u, 13765301618780454747u, 19978212440502u },
+  { 5135683856593854376u, 3918835585049683766u, 17043232280074u },
+  { 16989144158733353631u, 4284811082419151688u, 15531504353939u },
+  { 16096022219189002740u, 9303688039585129781u, 16339357547691u },
+  { 9799803972993234308u, 6595590759326472024u, 10852494950355u },
+  { 10265533839606628792u, 9130222534472279498u, 6739956673124u },
+  { 10888151629568648565u, 17647504289754425547u, 1819763186259u },
+  { 2524807550910488667u, 14078301617992317240u, 22291581208347u },
+  { 15474161801646554592u, 10721401644691076270u, 7390046443283u },
+  { 3616882603903423375u, 856727366165267210u, 31722463960286u },
+  { 15797595834600144255u, 8558556657063816014u, 9173994u },
+  { 6118606423670932450u, 169230328010303641u, 0u },
+  { 190068634672987182u, 169230328u, 0u },
+  { 1u, 0u, 16136175353856u },
+  { 16539928045790514794u, 3234707703970118099u, 13922500787976u },
+  { 11331600904071130598u, 9237907631697708869u, 15222706943586u },
+  { 10419529861656667453u, 13040807414730386373u, 285339761526u },
+  { 10299045763483901717u, 6267493929255821152u, 23432245510429u },
+  { 16558247886564042987u, 4528868057457133567u, 32437066488712u },
+  { 9269344272677015618u, 1226500258583449206u, 29928529886901u },
+  { 8950936178076688077u, 9774688051984570138u, 17248174732520u },
+  { 16940059368816824797u, 3223246087569023753u, 5322070279008u },
+  { 4912380526001627161u, 1296418877553432255u, 3043707032778u },
+  { 13803726320725580786u, 13042452708786319921u, 30406101306339u },
+  { 6176223480178977340u, 1868772121619913532u, 601226901190u },
+  { 12114651473705549733u, 4185588183818917097u, 601u },
+  { 4785792174940605197u, 11090678776483u, 0u },
+  { 12521216069939454385u, 11090u, 0u },
+  { 1u, 0u, 11491990306816u },
+  { 11595893680214968434u, 18267936389202175369u, 51640806627u },
+  { 17220673880195454538u, 11820795867273993537u, 13562254884915u },
+  { 11183637024885969947u, 4701796807075008665u, 22266611414266u },
+  { 10344242722198815011u, 11278602492618772205u, 16089771497210u },
+  { 13166613823037795059u, 14231611597729555914u, 4357404245721u },
+  { 6017162831651209860u, 7457017372410806435u, 1958667948293u },
+  { 2091822470088384891u, 12321471222899178552u, 11451270465446u },
+  { 3332206717484935393u, 4989206875465181975u, 4605805079739u },
+  { 5192577663542779071u, 14851099909251089452u, 13568100143613u },
+  { 12678780355251123684u, 1847323614478712720u, 6639212279040u },
+  { 6523531674477366434u, 3915857124940076470u, 14870196394479u },
+  { 16380792381515243709u, 3622838695518382111u, 39402006u },
+  { 10133235697705611888u, 726838724295606890u, 0u },
+  { 5452984656388447015u, 726838724u, 0u },
+  { 1u, 0u, 32132747493376u },
+  { 16419366029482852751u, 13788819003865145580u, 9227903171972u },
+  { 2280982938940731978u, 16660582235820388092u, 16704137831435u },
+  { 4800526299021627356u, 2542541223417715508u, 7301645353280u },
+  { 2446333195518663312u, 11904666795831562126u, 17792841194629u },
+  { 3855970693240991678u, 15517302049246721721u, 26492647622016u },
+  { 4735271404604469414u, 11946517601169134465u, 11006659356540u },
+  { 11922187976714103483u, 12162981358653152519u, 17725223512830u },
+  { 6943092519053872456u, 4123083984363531838u, 19993705792829u },
+  { 13681830219470475988u, 13019579689745532943u, 6563011874329u },
+  { 1409305564598745286u, 219042721129607156u, 13911919172003u },
+  { 4431166256118348092u, 16955730699279030920u, 12870908589655u },
+  { 4891401381945841576u, 16760520850760786772u, 2582249878086u },
+  { 8948031291122481848u, 4609437118830906528u, 2582u },
+  { 16476245171829617843u, 47634102635436u, 0u },
+  { 1893289637261841140u, 47634u, 0u },
+  { 1u, 0u, 16219725889536u },
+  { 5650056488963455538u, 13390298496375776221u, 26422278405979u },
+  { 12530657151314131395u, 5135683856593854375u, 9032920983350u },
+  { 16518099638677125885u, 16989144158733353630u, 9525872567112u },
+  { 2239556901405695310u, 16096022219189002739u, 22360531248437u },
+  { 2948286494482992322u, 9799803972993234307u, 9674556495704u },
+  { 1171220142720675209u, 10265533839606628791u, 10443590247882u },
+  { 2219255893717561052u, 10888151629568648564u, 14648136870091u },
+  { 15122006594785092175u, 2524807550910488666u, 13486838855992u },
+  { 11536072416938948997u, 15474161801646554591u, 778196071598u },
+  { 15848648553355642633u, 3616882603903423374u, 27470856389386u },
+  { 12266552636298973858u, 15797595834600144254u, 26777331690318u },
+  { 13809198351795034024u, 6118606423670932449u, 16376010303641u },
+  { 14631335850034051051u, 190068634672987181u, 169230328u },
+  { 7039226437231072498u, 3121748550315992231u, 0u },
+  { 5829027821576736099u, 3121748550u, 0u },
+  { 1u, 0u, 14803896631296u },
+  { 608269137192507522u, 16539928045790514793u, 18245614287315u },
+  { 15441139194805768361u, 11331600904071130597u, 27589564843845u },
+  { 1448698772794901746u, 10419529861656667452u, 24416558312389u },
+  { 9305240090455147173u, 10299045763483901716u, 2047897624416u },
+  { 7706274403541160891u, 16558247886564042986u, 3702502492159u },
+  { 181182636726164460u, 9269344272677015617u, 5914485231222u },
+  { 7023973547976131805u, 8950936178076688076u, 8969918322458u },
+  { 2945579863849705787u, 16940059368816824796u, 22207266300681u },
+  { 6682799598697977199u, 4912380526001627160u, 12849748301503u },
+  { 13106522499091830869u, 13803726320725580785u, 23356334813745u },
+  { 10133584301000846969u, 6176223480178977339u, 21737656736572u },
+  { 2358927048747495567u, 12114651473705549732u, 675259438313u },
+  { 17469316409076630457u, 4785792174940605196u, 11090678776483u },
+  { 6567995047100385338u, 12521216069939454384u, 11090u },
+  { 15991036475582079341u, 204586912993508u, 0u },
+  { 16841757599025330579u, 204586u, 0u },
+  { 1u, 0u, 25993628614656u },
+  { 112231761831879989u, 11595893680214968433u, 7489933534601u },
+  { 17458619305962287664u, 17220673880195454537u, 4249606266177u },
+  { 14977770577328172844u, 11183637024885969946u, 3821560762521u },
+  { 15748979378167794410u, 10344242722198815010u, 26058713763565u },
+  { 3440060453415982507u, 13166613823037795058u, 163326191050u },
+  { 12728841090672351308u, 6017162831651209859u, 31800113397923u },
+  { 3078824815622905859u, 2091822470088384890u, 27415180639288u },
+  { 14791969957570331774u, 3332206717484935392u, 17452281490199u },
+  { 1356702258459228582u, 5192577663542779070u, 16272687318060u },
+  { 13314196344375925283u, 12678780355251123683u, 21942353641360u },
+  { 13347352773939177875u, 6523531674477366433u, 10271888004534u },
+  { 10927729029826890973u, 16380792381515243708u, 17002549323807u },
+  { 8842738610151648683u, 10133235697705611887u, 11716295606890u },
+  { 3797190832176052334u, 5452984656388447014u, 726838724u },
+  { 10588892233814828052u, 13407807929942597099u, 0u },
+  { 17387847460462957756u, 13407807929u, 0u },
+  { 1u, 0u, 8428890095616u },
+  { 13416602077685360146u, 16419366029482852750u, 28412123652332u },
+  { 8773663709545360039u, 2280982938940731977u, 6964260237052u },
+  { 13473649620184406550u, 4800526299021627355u, 3982132615988u },
+  { 11334859481451984818u, 2446333195518663311u, 14009209032590u },
+  { 10142550265399234184u, 3855970693240991677u, 21377256699577u },
+  { 17115961083581651444u, 4735271404604469413u, 7431646303105u },
+  { 3376438427682735138u, 11922187976714103482u, 11838376385799u },
+  { 11695321818616142081u, 6943092519053872455u, 18447741693502u },
+  { 17979519177675062841u, 13681830219470475987u, 12276076398607u },
+  { 9730194485138313472u, 1409305564598745285u, 23176240214004u },
+  { 5954161644733106217u, 4431166256118348091u, 25428265163400u },
+  { 1704525109204411825u, 4891401381945841575u, 3232485073748u },
+  { 13252479312884011045u, 8948031291122481847u, 19372893179040u },
+  { 6120823147914409532u, 16476245171829617842u, 14866102635436u },
+  { 5576126408948916641u, 1893289637261841139u, 47634u },
+  { 802759566557947311u, 878694100496718u, 0u },
+  { 1853837237996519590u, 878694u, 0u },
+  { 1u, 0u, 25565306290176u },
+  { 6377489821984695687u, 5650056488963455537u, 8103679288285u },
+  { 5812091237991628238u, 12530657151314131394u, 17054895447975u },
+  { 356188076450884528u, 16518099638677125884u, 8691121406622u },
+  { 9413872227342949078u, 2239556901405695309u, 13699159826931u },
+  { 10644985227938053967u, 2948286494482992321u, 16823063491971u },
+  { 2011939476694306580u, 1171220142720675208u, 9588120306103u },
+  { 9573632469658350895u, 2219255893717561051u, 24666819765620u },
+  { 2394442195617775261u, 15122006594785092174u, 15839625371738u },
+  { 1544375841599271498u, 11536072416938948996u, 5006859156959u },
+  { 10976638032731416819u, 15848648553355642632u, 15742664971150u },
+  { 7960158050703667815u, 12266552636298973857u, 17377748598142u },
+  { 12722190508998298474u, 13809198351795034023u, 31789793166305u },
+  { 4879770773438624177u, 14631335850034051050u, 25767381597229u },
+  { 9815938904543142911u, 7039226437231072497u, 6726315992231u },
+  { 7020236689983412287u, 5829027821576736098u, 3121748550u },
+  { 17983599795703267076u, 2245864349024258851u, 3u },
+  { 2820759888800855985u, 57586096570u, 0u },
+  { 1u, 0u, 20073032974336u },
+  { 7292495551705518143u, 608269137192507521u, 11749837065833u },
+  { 12839739064526416825u, 15441139194805768360u, 25916078534117u },
+  { 8010525042585625406u, 1448698772794901745u, 7956504438076u },
+  { 14621490005266499711u, 9305240090455147172u, 10474417757972u },
+  { 10784518600481755565u, 7706274403541160890u, 4161009821930u },
+  { 15585649835910581808u, 181182636726164459u, 7884380770369u },
+  { 6918096520414671219u, 7023973547976131804u, 20956159680204u },
+  { 14158641033073425974u, 2945579863849705786u, 8216362275292u },
+  { 13377166679256713047u, 6682799598697977198u, 23537710506008u },
+  { 15718214708457796965u, 13106522499091830868u, 10811549342705u },
+  { 2995606409454179124u, 10133584301000846968u, 16292127877691u },
+  { 5538554188174832730u, 2358927048747495566u, 19212947013540u },
+  { 7902146244887236256u, 17469316409076630456u, 25008356051724u },
+  { 4065965666220303207u, 6567995047100385337u, 20708866875824u },
+  { 16434516436690276441u, 15991036475582079340u, 7978912993508u },
+  { 10717341906058293166u, 16841757599025330578u, 204586u },
+  { 6497709809481084912u, 3773962424821541u, 0u },
+  { 7836574250323619114u, 3773962u, 0u },
+  { 1u, 0u, 2161006084096u },
+  { 2743014905773730641u, 112231761831879988u, 22089946433649u },
+  { 16908410542056057079u, 17458619305962287663u, 5146811946569u },
+  { 1879597191417158195u, 14977770577328172843u, 290853753882u },
+  { 17848076302666310445u, 15748979378167794409u, 27378186486050u },
+  { 5658561064572066376u, 3440060453415982506u, 643690031858u },
+  { 6481540864306816175u, 12728841090672351307u, 24954166903427u },
+  { 297718262533380306u, 3078824815622905858u, 10464801874298u },
+  { 11025091835888755087u, 14791969957570331773u, 23742073546976u },
+  { 4483388721505644998u, 1356702258459228581u, 13795721764030u },
+  { 5836569401400553059u, 13314196344375925282u, 3233723561443u },
+  { 9811217572034740022u, 13347352773939177874u, 8380592393377u },
+  { 16550881916700141834u, 10927729029826890972u, 29295479365820u },
+  { 1163179607963166185u, 8842738610151648682u, 23334205846127u },
+  { 3907756679317820684u, 3797190832176052333u, 24043574024998u },
+  { 2422963254366584020u, 10588892233814828051u, 27065942597099u },
+  { 11938548945123090545u, 17387847460462957755u, 13407807929u },
+  { 9269876641091283934u, 7522728514880363052u, 13u },
+  { 1928313061075675333u, 247330401473u, 0u },
+  { 1u, 0u, 398727315456u },
+  { 2703866487630741282u, 13416602077685360145u, 29257475621262u },
+  { 13676776452991096120u, 8773663709545360038u, 20443730408009u },
+  { 12371356556203285563u, 13473649620184406549u, 23183614463963u },
+  { 1933601690362855555u, 11334859481451984817u, 12221549828751u },
+  { 4561814011825862884u, 10142550265399234183u, 12453927858109u },
+  { 1086297901659734191u, 17115961083581651443u, 10938183037093u },
+  { 13055567476615634973u, 3376438427682735137u, 19783634004666u },
+  { 18346677749735665743u, 11695321818616142080u, 4819974671687u },
+  { 3623646548212422700u, 17979519177675062840u, 14533527474899u },
+  { 12173921819092493423u, 9730194485138313471u, 14651322775749u },
+  { 8243367648590913301u, 5954161644733106216u, 6055092402491u },
+  { 10045758738860206511u, 1704525109204411824u, 31415718418343u },
+  { 8192274906191801706u, 13252479312884011044u, 13490331810487u },
+  { 2593760462991214194u, 6120823147914409531u, 4851302282418u },
+  { 1746851676629971273u, 5576126408948916640u, 29006043517683u },
+  { 4540525269939687256u, 802759566557947310u, 26726100496718u },
+  { 4012971081720478336u, 1853837237996519589u, 878694u },
+  { 13727865745030007445u, 16209045190941378u, 0u },
+  { 3522246746775301103u, 16209045u, 0u },
+  { 1u, 0u, 14897345724416u },
+  { 1170561314307796177u, 6377489821984695686u, 31170315074097u },
+  { 12373825751071800890u, 5812091237991628237u, 15100019308994u },
+  { 16374483730019537635u, 356188076450884527u, 7501510327036u },
+  { 9835337309191584022u, 9413872227342949077u, 3265577065805u },
+  { 15108620482756413296u, 10644985227938053966u, 28040109067457u },
+  { 5633902727180216714u, 2011939476694306579u, 11995518987656u },
+  { 12786520685830517861u, 9573632469658350894u, 8782129802971u },
+  { 9094282288015799263u, 2394442195617775260u, 31108083720782u },
+  { 14363722786276053976u, 1544375841599271497u, 1800595044740u },
+  { 8459148107541538421u, 10976638032731416818u, 21153431521032u },
+  { 5995275396165406288u, 7960158050703667814u, 6055689671329u },
+  { 12995463322306216100u, 12722190508998298473u, 14314264532903u },
+  { 14888730943126320058u, 4879770773438624176u, 21745532123114u },
+  { 16385807432404786099u, 9815938904543142910u, 19810380567793u },
+  { 1177758180320008802u, 7020236689983412286u, 2851974892898u },
+  { 3435437758566865990u, 17983599795703267075u, 6586152913699u },
+  { 17289296829900354424u, 2820759888800855984u, 57586096570u },
+  { 3254247398026003625u, 10811573432089755267u, 57u },
+  { 9854202338513672679u, 1062275985633u, 0u },
+  { 1u, 0u, 22657395326976u },
+  { 12344435991414635896u, 7292495551705518142u, 20648696043649u },
+  { 12174941969654047152u, 12839739064526416824u, 1265434251432u },
+  { 15722730654672257091u, 8010525042585625405u, 676792632561u },
+  { 2534471620497843389u, 14621490005266499710u, 5050584629924u },
+  { 11117057490409177056u, 10784518600481755564u, 7147844899770u },
+  { 11866493186006920142u, 15585649835910581807u, 1244375030763u },
+  { 15623374258726775744u, 6918096520414671218u, 8506767541468u },
+  { 7029749921517332615u, 14158641033073425973u, 5486725177658u },
+  { 3586439989054400843u, 13377166679256713046u, 6228852086126u },
+  { 17177472722816761574u, 15718214708457796964u, 28280162392148u },
+  { 9166337156326556327u, 2995606409454179123u, 12430300245624u },
+  { 2957151563889739618u, 5538554188174832729u, 17336428376206u },
+  { 7343309859778569650u, 7902146244887236255u, 2105220416440u },
+  { 1516383152223957876u, 4065965666220303206u, 24940890916921u },
+  { 4382901051332839439u, 16434516436690276440u, 31122580988268u },
+  { 2337525813052025223u, 10717341906058293165u, 10021352241554u },
+  { 16995804887838586559u, 6497709809481084911u, 5642424821541u },
+  { 7549240876047330649u, 7836574250323619113u, 3773962u },
+  { 2941180334360137461u, 69617318994479297u, 0u },
+  { 18344905081302771408u, 69617318u, 0u },
+  { 1u, 0u, 25908148699136u },
+  { 4549036743482397756u, 2743014905773730640u, 12847916606772u },
+  { 1528759014688504277u, 16908410542056057078u, 28459101893167u },
+  { 6645715332906526943u, 1879597191417158194u, 19177967546155u },
+  { 4648481265861585764u, 17848076302666310444u, 5546306751209u },
+  { 13322500297086437235u, 5658561064572066375u, 22603351365034u },
+  { 4660778702241388832u, 6481540864306816174u, 24578016139339u },
+  { 6925608669312657195u, 297718262533380305u, 17533597671426u },
+  { 12704359737568148851u, 11025091835888755086u, 14757243044989u },
+  { 10964879535816496035u, 4483388721505644997u, 23074316401061u },
+  { 11848520320189542161u, 5836569401400553058u, 10642531867170u },
+  { 6851116665647063427u, 9811217572034740021u, 19676897225106u },
+  { 16838396759135877552u, 16550881916700141833u, 28074063056092u },
+  { 12495575513557972314u, 1163179607963166184u, 14445211839914u },
+  { 5075939075948779035u, 3907756679317820683u, 25619131349101u },
+  { 3551328417537203090u, 2422963254366584019u, 5307647190035u },
+  { 10328896093408336332u, 11938548945123090544u, 23084502521019u },
+  { 4215214733172574885u, 9269876641091283933u, 27841104534060u },
+  { 5373995747687033971u, 1928313061075675332u, 247330401473u },
+  { 3165566434863774950u, 6094831415935969489u, 247u },
+  { 3601148312109948931u, 4562440617622u, 0u },
+  { 8127960511001643664u, 4562u, 0u },
+  { 1u, 0u, 9745146576896u },
+  { 7841045642355656131u, 2703866487630741281u, 27302741419537u },
+  { 4483722309241427768u, 13676776452991096119u, 6677670652582u },
+  { 5972477079636026928u, 12371356556203285562u, 30641104820757u },
+  { 13336606265349181711u, 1933601690362855554u, 20103247296433u },
+  { 535717109963034140u, 4561814011825862883u, 23027058888327u },
+  { 7604657608902789273u, 1086297901659734190u, 1057707743731u },
+  { 12998562524493934107u, 13055567476615634972u, 6400994575393u },
+  { 17572738459300400008u, 18346677749735665742u, 15928196438272u },
+  { 1429867914300944605u, 3623646548212422699u, 20735659949624u },
+  { 7382665211969294233u, 12173921819092493422u, 2088446873855u },
+  { 1031045755462408699u, 8243367648590913300u, 26032544581672u },
+  { 46029276074457662u, 10045758738860206510u, 4132444104112u },
+  { 3727192347148642892u, 8192274906191801705u, 13883140608036u },
+  { 6607400174838524450u, 2593760462991214193u, 8608094697019u },
+  { 15735937798438472461u, 1746851676629971272u, 9646246142368u },
+  { 11260592836733286120u, 4540525269939687255u, 165217543598u },
+  { 8320249397332180629u, 4012971081720478335u, 6850744189093u },
+  { 4947465154698856481u, 13727865745030007444u, 21653190941378u },
+  { 6478022294737612758u, 3522246746775301102u, 16209045u },
+  { 15658847471319256836u, 299004108316488185u, 0u },
+  { 5838176566706689680u, 299004108u, 0u },
+  { 1u, 0u, 9606063456256u },
+  { 18264300167010365743u, 1170561314307796176u, 15821670786438u },
+  { 7038908326762485694u, 12373825751071800889u, 11183887662541u },
+  { 9242135057394537437u, 16374483730019537634u, 6869533174703u },
+  { 2647249491707429952u, 9835337309191584021u, 16206819039957u },
+  { 4602546268128668746u, 15108620482756413295u, 3859305414478u },
+  { 3156417642241760702u, 5633902727180216713u, 13614693158675u },
+  { 3152281327371984184u, 12786520685830517860u, 32412493002030u },
+  { 16755147023707504703u, 9094282288015799262u, 12873778658972u },
+  { 16810481255892931025u, 14363722786276053975u, 10482458571337u },
+  { 9143766365547016433u, 8459148107541538420u, 29286325004530u },
+  { 191087986328916240u, 5995275396165406287u, 2921704485478u },
+  { 9755352801000394021u, 12995463322306216099u, 29104807119721u },
+  { 11939382745287611763u, 14888730943126320057u, 9214888276400u },
+  { 3707471959523717534u, 16385807432404786098u, 6206063846398u },
+  { 5192117731248054512u, 1177758180320008801u, 16131186235454u },
+  { 12215479402026724506u, 3435437758566865989u, 14256937254659u },
+  { 8556428781153433433u, 17289296829900354423u, 16003176413104u },
+  { 17102538825179129268u, 3254247398026003624u, 12513534197379u },
+  { 10300995572568757706u, 9854202338513672678u, 1062275985633u },
+  { 7408315842750028718u, 5091036349825931599u, 1062u },
+  { 6820642879804763729u, 19595533242629u, 0u },
+  { 9836590313175693966u, 19595u, 0u },
+  { 1u, 0u, 4158669193216u },
+  { 15293034399653613671u, 12344435991414635895u, 11192660004926u },
+  { 4167051451505134196u, 12174941969654047151u, 25405852330936u },
+  { 12168205228987687957u, 15722730654672257090u, 2174137393981u },
+  { 16961419373505876201u, 2534471620497843388u, 20908602656894u },
+  { 9759878855556418562u, 11117057490409177055u, 20015643283884u },
+  { 15645303450827082149u, 11866493186006920141u, 12658846944815u },
+  { 2822189177086878804u, 15623374258726775743u, 32309381083506u },
+  { 4427614060258677825u, 7029749921517332614u, 18262194421301u },
+  { 15250016117285991141u, 3586439989054400842u, 30052931192662u },
+  { 3391298034484670238u, 17177472722816761573u, 21299496908132u },
+  { 16249790076778694706u, 9166337156326556326u, 13401160307507u },
+  { 17991803809892162048u, 2957151563889739617u, 20127398081625u },
+  { 3844220630873599298u, 7343309859778569649u, 25446082203295u },
+  { 10816144517847937163u, 1516383152223957875u, 4184237597542u },
+  { 1986451426111380645u, 4382901051332839438u, 12205126717528u },
+  { 1858780376296155250u, 2337525813052025222u, 28655921344429u },
+  { 9990249048463429487u, 16995804887838586558u, 11561409245167u },
+  { 7814528347059483257u, 7549240876047330648u, 2241159441705u },
+  { 8999722391354076245u, 2941180334360137460u, 18086994479297u },
+  { 11529794504193035516u, 18344905081302771407u, 69617318u },
+  { 14596120828850494932u, 1284212866588958375u, 0u },
+  { 10864364428288978571u, 1284212866u, 0u },
+  { 1u, 0u, 11088246603776u },
+  { 14250146985576681222u, 4549036743482397755u, 10486082874192u },
+  { 6284658644272491535u, 1528759014688504276u, 23090360264950u },
+  { 2751580473201575578u, 6645715332906526942u, 9004251994674u },
+  { 1228924417231864090u, 4648481265861585763u, 6727722214188u },
+  { 1016665940454145024u, 13322500297086437234u, 9390252661319u },
+  { 5231104405648199567u, 4660778702241388831u, 22737375437998u },
+  { 7933826553724766741u, 6925608669312657194u, 24974688704721u },
+  { 830773661462954245u, 12704359737568148850u, 12741594407310u },
+  { 17355837018627915810u, 10964879535816496034u, 28258642309573u },
+  { 5735387934670804117u, 11848520320189542160u, 32565371399778u },
+  { 15707096516121400147u, 6851116665647063426u, 10505912811317u },
+  { 13420037651902232476u, 16838396759135877551u, 26088677386505u },
+  { 7659450280857154476u, 12495575513557972313u, 5387275167208u },
+  { 12259345319179480600u, 5075939075948779034u, 15571192517899u },
+  { 5407733467136173799u, 3551328417537203089u, 8304559930579u },
+  { 13179622240661136895u, 10328896093408336331u, 27613228507248u },
+  { 9120975999908899625u, 4215214733172574884u, 26820291324893u },
+  { 14420778565722731331u, 5373995747687033970u, 10449171605700u },
+  { 8058371065246920173u, 3165566434863774949u, 32406195218641u },
+  { 1081879504122268185u, 3601148312109948930u, 4562440617622u },
+  { 15460697337236785207u, 8127960511001643663u, 4562u },
+  { 18006159378935879335u, 84162174424773u, 0u },
+  { 3217569165652043188u, 84162u, 0u },
+  { 1u, 0u, 16161425063936u },
+  { 12767371133620441322u, 7841045642355656130u, 5431243063073u },
+  { 10933977328846300306u, 4483722309241427767u, 23610323768631u },
+  { 10654571227590014827u, 5972477079636026927u, 16514722978874u },
+  { 305981891542598484u, 13336606265349181710u, 14563029041282u },
+  { 17026223437657381172u, 535717109963034139u, 16558412249315u },
+  { 11366462742099543018u, 7604657608902789272u, 24604704653486u },
+  { 11328563328891279764u, 12998562524493934106u, 12366952620060u },
+  { 9240916119282545786u, 17572738459300400007u, 6187077513294u },
+  { 5895267868137827936u, 1429867914300944604u, 9326400215083u },
+  { 3526440679994837387u, 7382665211969294232u, 24340055893102u },
+  { 15064479391680745596u, 1031045755462408698u, 27054002495252u },
+  { 10170352814415123582u, 46029276074457661u, 11625202051502u },
+  { 15380616543866655422u, 3727192347148642891u, 18033358187881u },
+  { 17410195474339052303u, 6607400174838524449u, 12616853046897u },
+  { 2373358128380410459u, 15735937798438472460u, 3927610437960u },
+  { 7825400665932196009u, 11260592836733286119u, 14975451041623u },
+  { 3988165545335251687u, 8320249397332180628u, 19092268202623u },
+  { 16551698917172114404u, 4947465154698856480u, 11246351174292u },
+  { 1570045791407180221u, 6478022294737612757u, 12793848867822u },
+  { 11217706891160886388u, 15658847471319256835u, 28876316488185u },
+  { 7948956505413649506u, 5838176566706689679u, 299004108u },
+  { 13442662741771193894u, 5515652263101987298u, 0u },
+  { 1881333598417812748u, 5515652263u, 0u },
+  { 1u, 0u, 27856990109696u },
+  { 15016917631400225516u, 18264300167010365742u, 15929381579984u },
+  { 5364680023604305030u, 7038908326762485693u, 21218501017145u },
+  { 11823293285263900414u, 9242135057394537436u, 14613143507682u },
+  { 1218436013451635272u, 2647249491707429951u, 1903249504533u },
+  { 5476935697064767001u, 4602546268128668745u, 27017171109743u },
+  { 14529825770247406168u, 3156417642241760701u, 13412170885513u },
+  { 2617587630586685696u, 3152281327371984183u, 29662908298340u },
+  { 6070853416341032699u, 16755147023707504702u, 5079911298014u },
+  { 3667126507842511760u, 16810481255892931024u, 26228495684567u },
+  { 8006648708400339819u, 9143766365547016432u, 3663010358900u },
+  { 14425332327850439980u, 191087986328916239u, 163528838735u },
+  { 6485174236020065640u, 9755352801000394020u, 13241647235235u },
+  { 17096143207810311105u, 11939382745287611762u, 23474200982457u },
+  { 8109415127235622810u, 3707471959523717533u, 23137281465266u },
+  { 15899016093350164114u, 5192117731248054511u, 7237662202465u },
+  { 7526049333153169027u, 12215479402026724505u, 29559463844933u },
+  { 14947142774127236249u, 8556428781153433432u, 17576927130487u },
+  { 8248469448925856033u, 17102538825179129267u, 23014558418088u },
+  { 17029286582793540422u, 10300995572568757705u, 22863401605606u },
+  { 5547249573089745890u, 7408315842750028717u, 20741369747791u },
+  { 6760897231196373637u, 6820642879804763728u, 19595533242629u },
+  { 17188716569906466999u, 9836590313175693965u, 19595u },
+  { 15488061308842795242u, 361473786714651u, 0u },
+  { 14512323841522789484u, 361473u, 0u },
+  { 1u, 0u, 32119829037056u },
+  { 14917559040600648180u, 15293034399653613670u, 25007225896311u },
+  { 3174726101390162426u, 4167051451505134195u, 66659639727u },
+  { 14310670958971433173u, 12168205228987687956u, 9404919480386u },
+  { 13914226551429784313u, 16961419373505876200u, 16351529084092u },
+  { 18158400669824382732u, 9759878855556418561u, 11213848133599u },
+  { 5732594046956195940u, 15645303450827082148u, 11199152991181u },
+  { 9949816703913235467u, 2822189177086878803u, 26758240021439u },
+  { 73311558309643195u, 4427614060258677824u, 26954826705030u },
+  { 4621025678812194904u, 15250016117285991140u, 32485183842634u },
+  { 6094577056474649726u, 3391298034484670237u, 678880902885u },
+  { 1392404465623718695u, 16249790076778694705u, 1889975337638u },
+  { 17842017616662060406u, 17991803809892162047u, 9649208395617u },
+  { 12946462159512063290u, 3844220630873599297u, 13171586344369u },
+  { 7933014941594369422u, 10816144517847937162u, 18446107685747u },
+  { 12026434386041891101u, 1986451426111380644u, 10630100764686u },
+  { 16572798753803749999u, 1858780376296155249u, 30398541572486u },
+  { 16945043077944849261u, 9990249048463429486u, 27992423626430u },
+  { 8305468820200362576u, 7814528347059483256u, 3828487875928u },
+  { 3309030529592278242u, 8999722391354076244u, 26319625031412u },
+  { 14562561415452938192u, 11529794504193035515u, 24231791257295u },
+  { 9815037255822354704u, 14596120828850494931u, 2178588958375u },
+  { 10855520242742219396u, 10864364428288978570u, 1284212866u },
+  { 11940024527060847634u, 5242802012421871344u, 1u },
+  { 2424325720469391981u, 23689546086u, 0u },
+  { 1u, 0u, 21563772502016u },
+  { 15053610418972122659u, 14250146985576681221u, 14804340692027u },
+  { 16470117409361583616u, 6284658644272491534u, 10462149163476u },
+  { 13216515684530707719u, 2751580473201575577u, 27491066620126u },
+  { 4851478818079660276u, 1228924417231864089u, 1906055113571u },
+  { 11039358533862378536u, 1016665940454145023u, 22815283578738u },
+  { 4893656152528907446u, 5231104405648199566u, 10026430093599u },
+  { 15677990172569013159u, 7933826553724766740u, 15730045036330u },
+  { 8392826216292948603u, 830773661462954244u, 21410940861810u },
+  { 3341428546296291724u, 17355837018627915809u, 12048310916002u },
+  { 5299289163432847009u, 5735387934670804116u, 24962851483408u },
+  { 15022870548586053341u, 15707096516121400146u, 31151727501698u },
+  { 10699925337442478110u, 13420037651902232475u, 13657415219631u },
+  { 1350415511753143378u, 7659450280857154475u, 5658664580441u },
+  { 13478982972301237405u, 12259345319179480599u, 7057293153818u },
+  { 8816630327072827064u, 5407733467136173798u, 6603714468753u },
+  { 7541557411579830512u, 13179622240661136894u, 2724494449099u },
+  { 16349918878633841013u, 9120975999908899624u, 27762781751972u },
+  { 17573961776931748485u, 14420778565722731330u, 31973436845170u },
+  { 701456830058044873u, 8058371065246920172u, 8194058648805u },
+  { 11273525686394930329u, 1081879504122268184u, 19087838126082u },
+  { 315747321773013674u, 15460697337236785206u, 5829976115855u },
+  { 10242681671522667421u, 18006159378935879334u, 18626174424773u },
+  { 9010542774240521676u, 3217569165652043187u, 84162u },
+  { 17250453895414330711u, 1552518092300708u, 0u },
+  { 1702647555548649696u, 1552518u, 0u },
+  { 1u, 0u, 17858692120576u },
+  { 3092611696500570476u, 12767371133620441321u, 22327592732098u },
+  { 11278554953750109146u, 10933977328846300305u, 9775577585463u },
+  { 9150664446174477523u, 10654571227590014826u, 4366016587311u },
+  { 16881711284493741625u, 305981891542598483u, 3611922993422u },
+  { 12545048389934890697u, 17026223437657381171u, 18584616177179u },
+  { 14003890693923473982u, 11366462742099543017u, 28186614122648u },
+  { 7565787934530927250u, 11328563328891279763u, 2951500951066u },
+  { 5690865176979098912u, 9240916119282545785u, 28892319583111u },
+  { 2562311067687138893u, 5895267868137827935u, 20376191168732u },
+  { 15810683079042850771u, 3526440679994837386u, 23034816647064u },
+  { 17666314183112430691u, 15064479391680745595u, 14909551335930u },
+  { 14224440709059774123u, 10170352814415123581u, 27211833784893u },
+  { 11799656669285277808u, 15380616543866655421u, 10785943808587u },
+  { 17841359078305881179u, 17410195474339052302u, 19212128660001u },
+  { 17767238314218731607u, 2373358128380410458u, 14055424215820u },
+  { 18339302469465506397u, 7825400665932196008u, 32404216198887u },
+  { 10707364654389420061u, 3988165545335251686u, 18464897269396u },
+  { 4692770943213519886u, 16551698917172114403u, 28629085112352u },
+  { 1388582999826114763u, 1570045791407180220u, 3843608113109u },
+  { 11232487436902203743u, 11217706891160886387u, 22159430913795u },
+  { 14016373087816758219u, 7948956505413649505u, 31202728728207u },
+  { 5815926692658317194u, 13442662741771193893u, 11431101987298u },
+  { 16206709110371724308u, 1881333598417812747u, 5515652263u },
+  { 17035932583706656160u, 9512105328471502693u, 5u },
+  { 355298567228747526u, 101745825697u, 0u },
+  { 1u, 0u, 12590814068736u },
+  { 3023004014543071905u, 15016917631400225515u, 6077290819886u },
+  { 8789159499129256137u, 5364680023604305029u, 5084640942013u },
+  { 12742052266745415587u, 11823293285263900413u, 1087066051548u },
+  { 16354919851492950749u, 1218436013451635271u, 27721296905279u },
+  { 17801405685700266465u, 5476935697064767000u, 7613787663433u },
+  { 15016105844888435391u, 14529825770247406167u, 7479141899709u },
+  { 1444120179810309243u, 2617587630586685695u, 62329101623u },
+  { 268556242511689960u, 6070853416341032698u, 20944198795326u },
+  { 2906828966286087564u, 3667126507842511759u, 12528434041296u },
+  { 15311647886753834450u, 8006648708400339818u, 20751781998832u },
+  { 6568006223669625483u, 14425332327850439979u, 3364351561999u },
+  { 6734544029165988085u, 6485174236020065639u, 21874926783780u },
+  { 14787908375562645692u, 17096143207810311104u, 29085439612274u },
+  { 4435443774299738968u, 8109415127235622809u, 8431861887389u },
+  { 16797484018187029426u, 15899016093350164113u, 27801407987951u },
+  { 5363260419301190951u, 7526049333153169026u, 14168810286233u },
+  { 3705426153689588598u, 14947142774127236248u, 26035447150424u },
+  { 1319337555594646838u, 8248469448925856032u, 5577923159475u },
+  { 4386960995038976577u, 17029286582793540421u, 7085300717001u },
+  { 14974403443167252181u, 5547249573089745889u, 28240366508973u },
+  { 2958788718234347628u, 6760897231196373636u, 14989931802192u },
+  { 5945679068720101776u, 17188716569906466998u, 6683839609485u },
+  { 14704725346470813754u, 15488061308842795241u, 1025786714651u },
+  { 14586232676225642654u, 14512323841522789483u, 361473u },
+  { 5055880881743679601u, 6668014432879854u, 0u },
+  { 7985223886458636824u, 6668014u, 0u },
+  { 1u, 0u, 20582808682496u },
+  { 16006489527885559670u, 14917559040600648179u, 19059172102246u },
+  { 6773233354180954264u, 3174726101390162425u, 9236775783027u },
+  { 15926624743573293069u, 14310670958971433172u, 4328754291732u },
+  { 6409728622233132255u, 13914226551429784312u, 19457984368872u },
+  { 5487564439490169948u, 18158400669824382731u, 18852310764545u },
+  { 17056550425051720361u, 5732594046956195939u, 9299539380644u },
+  { 10063005918426729580u, 9949816703913235466u, 21568003974227u },
+  { 1908062927200961065u, 73311558309643194u, 13028250506304u },
+  { 2417085326495011235u, 4621025678812194903u, 28445330387684u },
+  { 16618528720815216908u, 6094577056474649725u, 18481075482397u },
+  { 4529658473898238667u, 1392404465623718694u, 23039967217713u },
+  { 16725531921172673734u, 17842017616662060405u, 27969701829119u },
+  { 3769900394834806407u, 12946462159512063289u, 28810430049601u },
+  { 15896823066288190496u, 7933014941594369421u, 23716651954314u },
+  { 12013273213958173746u, 12026434386041891100u, 26737898413220u },
+  { 2373258861053627568u, 16572798753803749998u, 20334918592625u },
+  { 5869421888340823266u, 16945043077944849260u, 29304450240366u },
+  { 4216569974106707973u, 8305468820200362575u, 27732179382904u },
+  { 11369382111006994828u, 3309030529592278241u, 19707789438036u },
+  { 14166074134602468755u, 14562561415452938191u, 24019532074235u },
+  { 13450479445109081503u, 9815037255822354703u, 28298588478931u },
+  { 5448378673731182150u, 10855520242742219395u, 22256647270026u },
+  { 12523151650564207079u, 11940024527060847633u, 18790131422960u },
+  { 13066769494752177732u, 2424325720469391980u, 23689546086u },
+  { 1792413982820166254u, 12719880177894442538u, 23u },
+  { 3949995886953082600u, 436994993873u, 0u },
+  { 1u, 0u, 20229816057856u },
+  { 8749203940676317602u, 15053610418972122658u, 11278892846853u },
+  { 6618453930078104650u, 16470117409361583615u, 18073716468750u },
+  { 13606016185484971472u, 13216515684530707718u, 16665262999193u },
+  { 17165684230355569239u, 4851478818079660275u, 31743598444825u },
+  { 13747389460068941456u, 11039358533862378535u, 20366265285631u },
+  { 738021611846242229u, 4893656152528907445u, 2580849905550u },
+  { 18055234897679459764u, 15677990172569013158u, 260454976020u },
+  { 14780665438843491169u, 8392826216292948602u, 16417181139204u },
+  { 3912596233136532363u, 3341428546296291723u, 21652287275041u },
+  { 16128135534127821340u, 5299289163432847008u, 4946814391444u },
+  { 10692111260864631582u, 15022870548586053340u, 30619580044114u },
+  { 480382077079239267u, 10699925337442478109u, 13227073206171u },
+  { 6948896701847882972u, 1350415511753143377u, 28183730697131u },
+  { 15878165442215226603u, 13478982972301237404u, 9958477950487u },
+  { 13283028112921150302u, 8816630327072827063u, 26110408828646u },
+  { 9393432565306588204u, 7541557411579830511u, 27432886330878u },
+  { 6925449312623258281u, 16349918878633841012u, 29506952686376u },
+  { 4903598888130495451u, 17573961776931748484u, 11756038026050u },
+  { 2939401678204164324u, 701456830058044872u, 18968611139052u },
+  { 98743653078537832u, 11273525686394930328u, 2102017116696u },
+  { 12955352457841393276u, 315747321773013673u, 5798555256886u },
+  { 9766470924672300271u, 10242681671522667420u, 9651488462502u },
+  { 3175987964214180486u, 9010542774240521675u, 8612935148979u },
+  { 9052218333914683315u, 17250453895414330710u, 12422092300708u },
+  { 17223260793700443999u, 1702647555548649695u, 1552518u },
+  { 3770860991083429631u, 28638903918474961u, 0u },
+  { 16942872547448222537u, 28638903u, 0u },
+  { 1u, 0u, 20713167650816u },
+  { 7683413049157467374u, 3092611696500570475u, 25745611411689u },
+  { 8703356465979165153u, 11278554953750109145u, 14186496058513u },
+  { 5161696970784311639u, 9150664446174477522u, 17235915159402u },
+  { 14041129479289857436u, 16881711284493741624u, 6451680068435u },
+  { 9935095103646306255u, 12545048389934890696u, 17385759152435u },
+  { 18068136762595870527u, 14003890693923473981u, 22931410142185u },
+  { 1475646221886631996u, 7565787934530927249u, 29817308502419u },
+  { 8712145484772293536u, 5690865176979098911u, 11871138903161u },
+  { 6164110273017442537u, 2562311067687138892u, 18826857098847u },
+  { 11948429191010813063u, 15810683079042850770u, 20603957692810u },
+  { 183208093467612557u, 17666314183112430690u, 5245771108475u },
+  { 12174413716529524507u, 14224440709059774122u, 4797639660669u },
+  { 8123304635157681073u, 11799656669285277807u, 15118967182013u },
+  { 10617223061283994237u, 17841359078305881178u, 31322963163918u },
+  { 14677570046765402506u, 17767238314218731606u, 26792994175578u },
+  { 3253372097407979324u, 18339302469465506396u, 25318580447400u },
+  { 2554962528046722508u, 10707364654389420060u, 29667254395622u },
+  { 1528224426051173959u, 4692770943213519885u, 2492075275235u },
+  { 15726765112975156490u, 1388582999826114762u, 7283608914364u },
+  { 14903622356712284990u, 11232487436902203742u, 1121759829107u },
+  { 12135940537727023476u, 14016373087816758218u, 3621315282017u },
+  { 8759393823558110854u, 5815926692658317193u, 32011878567461u },
+  { 6933839075661383381u, 16206709110371724307u, 28517923519755u },
+  { 17338065007215255747u, 17035932583706656159u, 6049019260773u },
+  { 5796249738544023872u, 355298567228747525u, 101745825697u },
+  { 14562300230490817748u, 13758055756510344276u, 101u },
+  { 3229240767671757473u, 1876879207201u, 0u },
+  { 1u, 0u, 10987163877376u },
+  { 17831353607860876670u, 3023004014543071904u, 7301476461291u },
+  { 9842595311231463439u, 8789159499129256136u, 32509690748037u },
+  { 579853634890008050u, 12742052266745415586u, 27207886601981u },
+  { 2080181812824057945u, 16354919851492950748u, 11800965016135u },
+  { 10113886911992831444u, 17801405685700266464u, 16983814024728u },
+  { 16908782066852573595u, 15016105844888435390u, 26879078285911u },
+  { 10118363176844869911u, 1444120179810309242u, 20218014558463u },
+  { 13990664652697100127u, 268556242511689959u, 9103157579514u },
+  { 5882382305643256283u, 2906828966286087563u, 23402830046095u },
+  { 6416277187888312634u, 15311647886753834449u, 29995356052330u },
+  { 16341965582247924990u, 6568006223669625482u, 17767365080363u },
+  { 3802650393391566606u, 6734544029165988084u, 9152801654119u },
+  { 14305346509836666014u, 14787908375562645691u, 30617240445888u },
+  { 17590828057268882454u, 4435443774299738967u, 30353910593433u },
+  { 3760861232849567831u, 16797484018187029425u, 32386290742929u },
+  { 5525771794335371625u, 5363260419301190950u, 5272200871554u },
+  { 928281008406215625u, 3705426153689588597u, 16672071521432u },
+  { 6342409520580794725u, 1319337555594646837u, 4933237817632u },
+  { 12793557639787798932u, 4386960995038976576u, 7137811764037u },
+  { 5589554722970108001u, 14974403443167252180u, 17028160396257u },
+  { 9628342490892560583u, 2958788718234347627u, 20662322315908u },
+  { 11404790936816158009u, 5945679068720101775u, 24809797144758u },
+  { 17430894857036241364u, 14704725346470813753u, 27755790721257u },
+  { 3333604571749681269u, 14586232676225642653u, 1262274079851u },
+  { 7668899394061550229u, 5055880881743679600u, 16110432879854u },
+  { 12603252082579025321u, 7985223886458636823u, 6668014u },
+  { 10474936540321600788u, 123003155723136208u, 0u },
+  { 13339508569883734190u, 123003155u, 0u },
+  { 1u, 0u, 10739867713536u },
+  { 12799719344028098391u, 16006489527885559669u, 31225367177715u },
+  { 17026291463296518392u, 6773233354180954263u, 12500863384057u },
+  { 995024309891212319u, 15926624743573293068u, 25336347472084u },
+  { 5356580523874991761u, 6409728622233132254u, 30475297481464u },
+  { 13731351904302386887u, 5487564439490169947u, 20579924637451u },
+  { 1131537370078424041u, 17056550425051720360u, 5130545516643u },
+  { 11939940068142495319u, 10063005918426729579u, 954103436298u },
+  { 15231239497600337449u, 1908062927200961064u, 10327131030458u },
+  { 7749130254234083803u, 2417085326495011234u, 21629900892247u },
+  { 3610625239227660664u, 16618528720815216907u, 23334245553277u },
+  { 5988966770864371416u, 4529658473898238666u, 23925906692902u },
+  { 13430489567376266563u, 16725531921172673733u, 19769204366709u },
+  { 14761554588911638669u, 3769900394834806406u, 15757861768505u },
+  { 3236674695052252339u, 15896823066288190495u, 26908651240845u },
+  { 4854187195958209471u, 12013273213958173745u, 19054128654620u },
+  { 8947402570707003420u, 2373258861053627567u, 13164318181998u },
+  { 16908955889355495819u, 5869421888340823265u, 4687228580716u },
+  { 14112871959346033110u, 4216569974106707972u, 15585616335439u },
+  { 15628586960360247436u, 11369382111006994827u, 20431767944417u },
+  { 1614508844721901860u, 14166074134602468754u, 10511729151951u },
+  { 13725697825927770640u, 13450479445109081502u, 21123295357199u },
+  { 17649200693828407317u, 5448378673731182149u, 19473678881411u },
+  { 18051842189420602185u, 12523151650564207078u, 19052708350993u },
+  { 6319149244891820363u, 13066769494752177731u, 17962097166956u },
+  { 7448401001021978794u, 1792413982820166253u, 28369214129706u },
+  { 13762583553829826868u, 3949995886953082599u, 436994993873u },
+  { 8307147489175354695u, 18354397334090060126u, 436u },
+  { 8385238731043195855u, 8061134813471u, 0u },
+  { 2486869605610703231u, 8061u, 0u },
+  { 1u, 0u, 24098474295296u },
+  { 13613666431015510440u, 8749203940676317601u, 24063358787106u },
+  { 9935063983561590858u, 6618453930078104649u, 23814737583615u },
+  { 672872467225545633u, 13606016185484971471u, 22771930553606u },
+  { 7321489978692750620u, 17165684230355569238u, 19495745247475u },
+  { 10362252588170479853u, 13747389460068941455u, 27829040008231u },
+  { 521909147200442579u, 738021611846242228u, 2982978776245u },
+  { 3475443101103206419u, 18055234897679459763u, 6778801261478u },
+  { 4296398164457986902u, 14780665438843491168u, 8587212102266u },
+  { 8135992260960074803u, 3912596233136532362u, 26272874307979u },
+  { 9549444551550633504u, 16128135534127821339u, 16092579620512u },
+  { 1552639049315347974u, 10692111260864631581u, 26653026041564u },
+  { 12617554593459619014u, 480382077079239266u, 13393376700445u },
+  { 10642081363136397050u, 6948896701847882971u, 23708860757073u },
+  { 18049455431984761870u, 15878165442215226602u, 9911720074396u },
+  { 9910523195998223694u, 13283028112921150301u, 8431509218999u },
+  { 10321002848658855236u, 9393432565306588203u, 20852375429359u },
+  { 12523168921589284247u, 6925449312623258280u, 14980265824628u },
+  { 18322360052126938466u, 4903598888130495450u, 7624159345284u },
+  { 16503829593741544477u, 2939401678204164323u, 17560005352904u },
+  { 16374384970281770837u, 98743653078537831u, 15017702311064u },
+  { 8751453703511188116u, 12955352457841393275u, 19356529441449u },
+  { 10269761002196489434u, 9766470924672300270u, 11723172170652u },
+  { 492046653910970359u, 3175987964214180485u, 13654490721739u },
+  { 2360458450905469139u, 9052218333914683314u, 6367933674838u },
+  { 666324474247327642u, 17223260793700443998u, 14033204418783u },
+  { 9571043836716872231u, 3770860991083429630u, 32439918474961u },
+  { 16906747279757935914u, 16942872547448222536u, 28638903u },
+  { 6499521839340850775u, 528294531135665246u, 0u },
+  { 2502582079158370292u, 528294531u, 0u },
+  { 1u, 0u, 31083416518656u },
+  { 8466098070028282372u, 7683413049157467373u, 23513471809899u },
+  { 8074401040084620319u, 8703356465979165152u, 15570279816153u },
+  { 9651675927530194702u, 5161696970784311638u, 28216761171154u },
+  { 2907142348957531427u, 14041129479289857435u, 16072538582584u },
+  { 2149288797134452531u, 9935095103646306254u, 2621979475656u },
+  { 3574358270696119574u, 18068136762595870526u, 31377079994941u },
+  { 4689995807902064637u, 1475646221886631995u, 19743472286353u },
+  { 16095308889743268114u, 8712145484772293535u, 13900334157087u },
+  { 15698107778582339838u, 6164110273017442536u, 24530647725644u },
+  { 8158685752069167087u, 11948429191010813062u, 5218009931730u },
+  { 1512425348758087163u, 183208093467612556u, 1706659976290u },
+  { 10307988865230940111u, 12174413716529524506u, 24687440365226u },
+  { 4944275696189507494u, 8123304635157681072u, 23642575560815u },
+  { 10094208002066068273u, 10617223061283994236u, 14422795672666u },
+  { 4636081699985124199u, 14677570046765402505u, 604176365654u },
+  { 10477738998607596508u, 3253372097407979323u, 24604138504796u },
+  { 4307861863671401453u, 2554962528046722507u, 17421082845212u },
+  { 1829642141486407038u, 1528224426051173958u, 10442852549645u },
+  { 7030981633718890232u, 15726765112975156489u, 350807926986u },
+  { 9250412480387365694u, 14903622356712284989u, 13258657890654u },
+  { 7549917605555026350u, 12135940537727023475u, 1929474847690u },
+  { 9599510656140829132u, 8759393823558110853u, 11283375884169u },
+  { 1860869865057187635u, 6933839075661383380u, 32159939898387u },
+  { 609236412525626421u, 17338065007215255746u, 28421314215327u },
+  { 4797521802355619460u, 5796249738544023871u, 13396789423877u },
+  { 3290144731054923312u, 14562300230490817747u, 27425175057492u },
+  { 15353682925579769939u, 3229240767671757472u, 1876879207201u },
+  { 17342601088449568849u, 16218510227838753330u, 1876u },
+  { 17664324445041582093u, 34622310392506u, 0u },
+  { 5725731138243680888u, 34622u, 0u },
+  { 1u, 0u, 27296966639616u },
+  { 11481612411329523019u, 17831353607860876669u, 30920533568160u },
+  { 646064553479534918u, 9842595311231463438u, 18338031433928u },
+  { 11826043192024585048u, 579853634890008049u, 17116112766882u },
+  { 4508188008530457412u, 2080181812824057944u, 2528548274908u },
+  { 14899606231054444284u, 10113886911992831443u, 31422916626912u },
+  { 12387380377005975364u, 16908782066852573594u, 5242548517566u },
+  { 3915510521158988231u, 10118363176844869910u, 30951758435450u },
+  { 443775355238589313u, 13990664652697100126u, 21899318884583u },
+  { 16274386390529990057u, 5882382305643256282u, 9681347827083u },
+  { 8752471133580574986u, 6416277187888312633u, 650885899729u },
+  { 3951748168579445495u, 16341965582247924989u, 10484206142090u },
+  { 6143548457401332280u, 3802650393391566605u, 28859775494388u },
+  { 10992370767288966321u, 14305346509836666013u, 4951953600699u },
+  { 15326396103619795185u, 17590828057268882453u, 19377203876695u },
+  { 12375396228784350942u, 3760861232849567830u, 11558299552689u },
+  { 7501612983095338340u, 5525771794335371624u, 9077050322214u },
+  { 11063793517987662069u, 928281008406215624u, 5429343822709u },
+  { 3590905341086135090u, 6342409520580794724u, 23104693540149u },
+  { 1192130210300374559u, 12793557639787798931u, 20180303010368u },
+  { 1235076275693787446u, 5589554722970108000u, 10347521953492u },
+  { 12830652616613401919u, 9628342490892560582u, 31119618254955u },
+  { 5770471054829644963u, 11404790936816158008u, 24633944930703u },
+  { 2542405094003084425u, 17430894857036241363u, 28829180715065u },
+  { 8163355771983396933u, 3333604571749681268u, 20592415731869u },
+  { 4082846872279174703u, 7668899394061550228u, 18967683223664u },
+  { 17380360898214829594u, 12603252082579025320u, 11472567847447u },
+  { 4415222160890685901u, 10474936540321600787u, 24851723136208u },
+  { 5462319164340332354u, 13339508569883734189u, 123003155u },
+  { 5295740528502789974u, 2269007733883335972u, 0u },
+  { 16294672611881206951u, 2269007733u, 0u },
+  { 1u, 0u, 30581693874176u },
+  { 16260222279010145708u, 12799719344028098390u, 2199922997109u },
+  { 5208927671379365988u, 17026291463296518391u, 2060053940375u },
+  { 10061119690104081877u, 995024309891212318u, 7390290380812u },
+  { 5556242519878209067u, 5356580523874991760u, 3163744378078u },
+  { 643160642655337595u, 13731351904302386886u, 27304061340763u },
+  { 15047191653653907179u, 1131537370078424040u, 3179647265448u },
+  { 12687449375589689331u, 11939940068142495318u, 16936825687147u },
+  { 11193020749935832976u, 15231239497600337448u, 20898420081192u },
+  { 4337636034573038917u, 7749130254234083802u, 22795195732386u },
+  { 441238338054769404u, 3610625239227660663u, 25290324662539u },
+  { 7927925214144792104u, 5988966770864371415u, 13509728068298u },
+  { 4955551469038683617u, 13430489567376266562u, 18054800225477u },
+  { 13761038544287083792u, 14761554588911638668u, 29727175460486u },
+  { 5480233341811706220u, 3236674695052252338u, 13361263146015u },
+  { 4417304897076944596u, 4854187195958209470u, 19631485039665u },
+  { 1532151702833320944u, 8947402570707003419u, 3297916636335u },
+  { 9049433611785479859u, 16908955889355495818u, 22532765060321u },
+  { 8458285108199248893u, 14112871959346033109u, 12683847227396u },
+  { 5484310085395986669u, 15628586960360247435u, 19858087522699u },
+  { 16092552504251112416u, 1614508844721901859u, 1438744071570u },
+  { 11714770473416841097u, 13725697825927770639u, 7749956765086u },
+  { 15337538269804108787u, 17649200693828407316u, 29158978592325u },
+  { 8067766841470647542u, 18051842189420602184u, 11843342561766u },
+  { 1212246979485426684u, 6319149244891820362u, 27245403778627u },
+  { 3429832530947117405u, 7448401001021978793u, 12007746071149u },
+  { 8225506063388620675u, 13762583553829826867u, 4446450331367u },
+  { 371995923964544385u, 8307147489175354694u, 14623454564702u },
+  { 1033259800462442327u, 8385238731043195854u, 8061134813471u },
+  { 4608273187339570701u, 2486869605610703230u, 8061u },
+  { 5649865200835684357u, 148701690847778u, 0u },
+  { 12743892160306777153u, 148701u, 0u },
+  { 1u, 0u, 12705737998336u },
+  { 16862371229240854169u, 13613666431015510439u, 27721538580897u },
+  { 15284787522876671940u, 9935063983561590857u, 3535036476489u },
+  { 5119839986896922416u, 672872467225545632u, 19030396898767u },
+  { 13628511785470061516u, 7321489978692750619u, 16015561738838u },
+  { 17812412707588688299u, 10362252588170479852u, 4020028292751u },
+  { 6707521497250537815u, 521909147200442578u, 9651188404148u },
+  { 16139900261550404124u, 3475443101103206418u, 21344232908211u },
+  { 11029776734429848954u, 4296398164457986901u, 27530441053024u },
+  { 6988985914488026175u, 8135992260960074802u, 12827517676426u },
+  { 10947759254500264967u, 9549444551550633503u, 21277084168731u },
+  { 11959998163574009358u, 1552639049315347973u, 14946683999005u },
+  { 12091657262513308059u, 12617554593459619013u, 19675576908386u },
+  { 551018812054435727u, 10642081363136397049u, 11498978462939u },
+  { 12911917920718408588u, 18049455431984761869u, 17245537250538u },
+  { 7738986110647468238u, 9910523195998223693u, 31787559502685u },
+  { 5466003683431890902u, 10321002848658855235u, 27304678882347u },
+  { 859212211123574221u, 12523168921589284246u, 17370993257128u },
+  { 15960180047658880327u, 18322360052126938465u, 22755894674394u },
+  { 3384224354478609135u, 16503829593741544476u, 5735887657187u },
+  { 4268736478418245513u, 16374384970281770836u, 15995474417255u },
+  { 4156142128269364814u, 8751453703511188115u, 29934556724859u },
+  { 16270217522315418840u, 10269761002196489433u, 31365026673902u },
+  { 8589081957188855190u, 492046653910970358u, 22450127960709u },
+  { 14138066163593894283u, 2360458450905469138u, 26462036121522u },
+  { 3928209999399778621u, 666324474247327641u, 16126518847326u },
+  { 16010048296127213790u, 9571043836716872230u, 29512916516606u },
+  { 10975951570063130246u, 16906747279757935913u, 29790352339784u },
+  { 16163532592565848314u, 6499521839340850774u, 8835135665246u },
+  { 16144374787035910503u, 2502582079158370291u, 528294531u },
+  { 6518754469289960082u, 9745314011399999080u, 0u },
+  { 7378680664998027303u, 9745314011u, 0u },
+  { 1u, 0u, 15597458948096u },
+  { 3263655810510109026u, 8466098070028282371u, 2528437714157u },
+  { 8738408669500365625u, 8074401040084620318u, 2390523218400u },
+  { 6005424573673092960u, 9651675927530194701u, 26011157596502u },
+  { 3693811696881319670u, 2907142348957531426u, 4046116513179u },
+  { 7420732044430953562u, 2149288797134452530u, 1854193766350u },
+  { 16664311386340754109u, 3574358270696119573u, 12347254245182u },
+  { 8198354461594959031u, 4689995807902064636u, 15263872528443u },
+  { 11781539285800918093u, 16095308889743268113u, 28904850996127u },
+  { 15972285752826323369u, 15698107778582339837u, 1158442283240u },
+  { 4686500070064303790u, 8158685752069167086u, 5516081988742u },
+  { 8283956067429106899u, 1512425348758087162u, 12058558797196u },
+  { 3618437657238631356u, 10307988865230940110u, 5040268029722u },
+  { 11290714549907234453u, 4944275696189507493u, 31356547208112u },
+  { 6408702997073467884u, 10094208002066068272u, 2441251322492u },
+  { 7412184822066267836u, 4636081699985124198u, 3899567999369u },
+  { 2694230026619284676u, 10477738998607596507u, 11723233529659u },
+  { 9868555233008574646u, 4307861863671401452u, 32326099185099u },
+  { 17523879967094907829u, 1829642141486407037u, 25865381150278u },
+  { 3323296900189158956u, 7030981633718890231u, 25405501465865u },
+  { 11039971812787671166u, 9250412480387365693u, 31091409281853u },
+  { 10754269939562817703u, 7549917605555026349u, 3717520390515u },
+  { 7827849830077030164u, 9599510656140829131u, 1748100877957u },
+  { 10126481155555663552u, 1860869865057187634u, 8386033026772u },
+  { 9242763006097123413u, 609236412525626420u, 2367260074178u },
+  { 14856972047098885471u, 4797521802355619459u, 1235178359103u },
+  { 2168966467496542272u, 3290144731054923311u, 27296832324819u },
+  { 7623685427048070033u, 15353682925579769938u, 23090940144288u },
+  { 7440297698143071770u, 17342601088449568848u, 8890957584946u },
+  { 6292951500388186893u, 17664324445041582092u, 1854310392506u },
+  { 4946896347318045750u, 5725731138243680887u, 34622u },
+  { 6266913088531261193u, 638668899051110u, 0u },
+  { 16584565741621407287u, 638668u, 0u },
+  { 1u, 0u, 30077622419456u },
+  { 15396407001963630205u, 11481612411329523018u, 28686035023229u },
+  { 1180796062931643155u, 646064553479534917u, 1521641091086u },
+  { 10220047646536483058u, 11826043192024585047u, 10328244389361u },
+  { 1020887523720024832u, 4508188008530457411u, 7635807709272u },
+  { 13581248622063350788u, 14899606231054444283u, 12698671521235u },
+  { 9721619401076914589u, 12387380377005975363u, 16662212260250u },
+  { 7490104222834670787u, 3915510521158988230u, 24414024057110u },
+  { 8038685061975664470u, 443775355238589312u, 23002882236254u },
+  { 17673378651131364926u, 16274386390529990056u, 28985474472410u },
+  { 14626508543888326371u, 8752471133580574985u, 5373214224697u },
+  { 9666745761845646266u, 3951748168579445494u, 3853333042429u },
+  { 5035237254658512843u, 6143548457401332279u, 17565595897613u },
+  { 12470458082982656557u, 10992370767288966320u, 3093830845597u },
+  { 5290545987720004504u, 15326396103619795184u, 16470670871573u },
+  { 6832805941306179077u, 12375396228784350941u, 4456406663254u },
+  { 15271495047322008581u, 7501612983095338339u, 15304599769448u },
+  { 2788526193068303756u, 11063793517987662068u, 6500194663368u },
+  { 6051726596324496259u, 3590905341086135089u, 24979064625508u },
+  { 13325116581754912717u, 1192130210300374558u, 96066953619u },
+  { 15843407890493578135u, 1235076275693787445u, 26822695551072u },
+  { 15530679041691906624u, 12830652616613401918u, 1336312817862u },
+  { 2013774065618363030u, 5770471054829644962u, 6611137824056u },
+  { 9004214721137592450u, 2542405094003084424u, 2164442536403u },
+  { 16427963254243084251u, 8163355771983396932u, 17044221331572u },
+  { 10474380135004816658u, 4082846872279174702u, 11688942191252u },
+  { 13223325921299078832u, 17380360898214829593u, 21779239349672u },
+  { 14231654672821691456u, 4415222160890685900u, 28845296112915u },
+  { 4563845139773639804u, 5462319164340332353u, 29988287082669u },
+  { 1012273515770698470u, 5295740528502789973u, 20341883335972u },
+  { 16718666463786167776u, 16294672611881206950u, 2269007733u },
+  { 10106112915276332679u, 4962316820794463992u, 2u },
+  { 3939619933766713237u, 41855804968u, 0u },
+  { 1u, 0u, 8022881468416u },
+  { 475192849705240920u, 16260222279010145707u, 2295282376534u },
+  { 559391076596753278u, 5208927671379365987u, 9246545414391u },
+  { 16658735168553603702u, 10061119690104081876u, 16016301204510u },
+  { 16990743244713178530u, 5556242519878209066u, 20166034865808u },
+  { 5308139057891756086u, 643160642655337594u, 11240815709894u },
+  { 2402251196180773093u, 15047191653653907178u, 13910687788008u },
+  { 3610546281816146129u, 12687449375589689330u, 1576606774870u },
+  { 2700220566062095166u, 11193020749935832975u, 25050235143720u },
+  { 8376380469804865089u, 4337636034573038916u, 31095023919578u },
+  { 14701630095926411135u, 441238338054769403u, 14039429773687u },
+  { 3318524909142481161u, 7927925214144792103u, 21826268640983u },
+  { 13950730783838358021u, 4955551469038683616u, 6284745987394u },
+  { 17838228797114855299u, 13761038544287083791u, 21682297084044u },
+  { 14666985847192491838u, 5480233341811706219u, 11198239462578u },
+  { 57780142386511844u, 4417304897076944595u, 26651083058110u },
+  { 4599702183431403005u, 1532151702833320943u, 6538490570779u },
+  { 15405794757536627990u, 9049433611785479858u, 12757458524554u },
+  { 956631966827075388u, 8458285108199248892u, 4235297305045u },
+  { 5975852479786288033u, 5484310085395986668u, 4387872379019u },
+  { 1695834497604840690u, 16092552504251112415u, 12815635058979u },
+  { 1030665322572545873u, 11714770473416841096u, 20500831449615u },
+  { 6690061046907213981u, 15337538269804108786u, 9032437354516u },
+  { 7319790578412148707u, 8067766841470647541u, 29002065716040u },
+  { 15675456164208486178u, 1212246979485426683u, 14505185931594u },
+  { 8736056795829744306u, 3429832530947117404u, 28979445905577u },
+  { 12744483529114483728u, 8225506063388620674u, 15686020165939u },
+  { 18340271287441502837u, 371995923964544384u, 19406056013126u },
+  { 646669078588233329u, 1033259800462442326u, 18814249814990u },
+  { 5865440488947316604u, 4608273187339570700u, 25122306279806u },
+  { 11714368637763571466u, 5649865200835684356u, 17629690847778u },
+  { 2316793081997192875u, 12743892160306777152u, 148701u },
+  { 6301923696434229423u, 2743062034396844u, 0u },
+  { 634509784513235645u, 2743062u, 0u },
+  { 1u, 0u, 24999914110976u },
+  { 4134601860945757692u, 16862371229240854168u, 18505828589991u },
+  { 6573121383943754674u, 15284787522876671939u, 2976277547081u },
+  { 13213491976578869593u, 5119839986896922415u, 19739738803104u },
+  { 4536764193203882989u, 13628511785470061515u, 2284965612827u },
+  { 5501555979402464961u, 17812412707588688298u, 20690363615468u },
+  { 9420467865831871831u, 6707521497250537814u, 12306874945746u },
+  { 4374891630534072055u, 16139900261550404123u, 6997597925394u },
+  { 2039118349740094424u, 11029776734429848953u, 15410378873685u },
+  { 16260323682801437239u, 6988985914488026174u, 1567593479218u },
+  { 12586996783399208606u, 10947759254500264966u, 28165648352799u },
+  { 14182560599741312086u, 11959998163574009357u, 17605655490053u },
+  { 17562868437834039419u, 12091657262513308058u, 16121029870789u },
+  { 2203520450032709552u, 551018812054435726u, 19469699956473u },
+  { 11091032823539036450u, 12911917920718408587u, 15693419531277u },
+  { 5096876331982081497u, 7738986110647468237u, 5443296312653u },
+  { 7837384872644360729u, 5466003683431890901u, 32150046577987u },
+  { 6968587649272878881u, 859212211123574220u, 30049865203094u },
+  { 11796215514156194600u, 15960180047658880326u, 19484183459169u },
+  { 9091430420391698595u, 3384224354478609134u, 24404231408668u },
+  { 15023335004500482457u, 4268736478418245512u, 8851225304916u },
+  { 12152526263697825413u, 4156142128269364813u, 21721882010259u },
+  { 16074370256262147890u, 16270217522315418839u, 28662465615065u },
+  { 2215710001687886421u, 8589081957188855189u, 4306766426102u },
+  { 7517712682420631377u, 14138066163593894282u, 12185212948690u },
+  { 13069099848478826418u, 3928209999399778620u, 29222867906457u },
+  { 9241138699437075685u, 16010048296127213789u, 1321595007526u },
+  { 13515483073075263766u, 10975951570063130245u, 3670876226857u },
+  { 7933597047619380315u, 16163532592565848313u, 16371875188310u },
+  { 4254875691704353218u, 16144374787035910502u, 20072353382387u },
+  { 14714928903009965784u, 6518754469289960081u, 12507399999080u },
+  { 16647695138422419688u, 7378680664998027302u, 9745314011u },
+  { 17165047304217871148u, 13748616822845626228u, 9u },
+  { 4272095718081867267u, 179769313486u, 0u },
+  { 1u, 0u, 27139176923136u },
+  { 1043860221572403596u, 3263655810510109025u, 21534473710083u },
+  { 7715408872456944592u, 8738408669500365624u, 18189325554718u },
+  { 13903124925316082344u, 6005424573673092959u, 15650200241933u },
+  { 15203929832832158263u, 3693811696881319669u, 30514402278690u },
+  { 8359745466757320114u, 7420732044430953561u, 23829903374130u },
+  { 4151396246278810178u, 16664311386340754108u, 24572444433685u },
+  { 13601505087094920338u, 8198354461594959030u, 6417638678524u },
+  { 7446098614836262726u, 11781539285800918092u, 24829865859345u },
+  { 5061226021613087693u, 15972285752826323368u, 6126254055677u },
+  { 18366452780515549444u, 4686500070064303789u, 9722449074158u },
+  { 10644566717161090198u, 8283956067429106898u, 10190196155898u },
+  { 15549462784134257603u, 3618437657238631355u, 1957612070862u },
+  { 8803604345283097613u, 11290714549907234452u, 13104347416485u },
+  { 4870387076830438628u, 6408702997073467883u, 27494401815344u },
+  { 13692350118841845998u, 7412184822066267835u, 19419146054502u },
+  { 18159769325779055179u, 2694230026619284675u, 3052534975451u },
+  { 7317149920020961390u, 9868555233008574645u, 23933949971436u },
+  { 10629294720480139495u, 17523879967094907828u, 12023180156285u },
+  { 4597194045551447517u, 3323296900189158955u, 15165598478071u },
+  { 11211408843719876875u, 11039971812787671165u, 14765582990141u },
+  { 8232579364504796473u, 10754269939562817702u, 25035424348589u },
+  { 11715297064759940143u, 7827849830077030163u, 30514548957643u },
+  { 14448066449443665388u, 10126481155555663551u, 17460501051186u },
+  { 5177634483793360759u, 9242763006097123412u, 13955805398068u },
+  { 14200327573886543141u, 14856972047098885470u, 24111117579907u },
+  { 2211122349902944394u, 2168966467496542271u, 6226413280815u },
+  { 11835233822655766786u, 7623685427048070032u, 24656403339346u },
+  { 14734395279995963688u, 7440297698143071769u, 24588341141584u },
+  { 6549913342910229295u, 6292951500388186892u, 23159268171788u },
+  { 17140646346887755980u, 4946896347318045749u, 26214339730039u },
+  { 9117096173975876696u, 6266913088531261192u, 16076899051110u },
+  { 9193026266526904232u, 16584565741621407286u, 638668u },
+  { 9830173523388317117u, 11781361728633673u, 0u },
+  { 13440918899148146853u, 11781361u, 0u },
+};
+
+// Blocks before it are zero for every double of the row
+const uint8_t NEGATIVE_MIN_BLOCK[NEGATIVE_ROWS] = {
+  0, 0, 0, 0, 0, 0, 1, 1, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 10, 10, 11,
+  11, 12, 12, 13, 13, 14, 14, 15, 15, 16, 16, 17, 18, 18, 19, 19, 20, 20, 21,
+  21, 22, 22, 23, 23, 24, 24, 25, 26, 26, 27, 27, 28, 28, 29, 29, 30, 30, 31,
+  31, 32, 33, 33, 34
+};
+
+// First entry of each row of NEGATIVE_SPLIT
+const uint16_t NEGATIVE_OFFSET[NEGATIVE_ROWS + 1] = {
+  0, 2, 6, 12, 19, 28, 39, 51, 65, 79, 94, 111, 129, 148, 168, 190, 213, 238,
+  263, 290, 318, 348, 378, 409, 442, 476, 512, 548, 586, 625, 666, 707, 750,
+  794, 840, 887, 935, 984, 1034, 1086, 1138, 1192, 1247, 1304, 1362, 1421, 1481,
+  1543, 1606, 1670, 1735, 1802, 1870, 1939, 2009, 2080, 2153, 2227, 2302, 2378,
+  2456, 2535, 2616, 2697, 2780, 2864, 2949, 3035, 3121
+};
+
+// floor(10^(9 * (i + 1)) * 2^(128 - 16 * row)) + 1 mod 10^9 * 2^143
+const uint64_t NEGATIVE_SPLIT[3121][3] = {
+  { 1u, 0u, 1000000000u },
+  { 1u, 0u, 18944000000000u },
+  { 1u, 14555633995661443072u, 15258u },
+  { 1u, 0u, 15258789062500u },
+  { 1u, 0u, 10084000000000u },
+  { 1u, 0u, 26624000000000u },
+  { 1u, 4294967296000000000u, 0u },
+  { 1u, 12061765702005030912u, 232830643u },
+  { 1u, 16717361816799281152u, 14003653869628u },
+  { 1u, 0u, 60906250000u },
+  { 1u, 0u, 7952000000000u },
+  { 1u, 0u, 8192000000000u },
+  { 1u, 65536000000000u, 0u },
+  { 1u, 13165050183672659968u, 3552u },
+  { 1u, 9240515622155059200u, 3552713678800u },
+  { 1u, 11461661051657912320u, 8144500929355u },
+  { 1u, 11529215046068469760u, 13131621337890u },
+  { 1u, 0u, 2850625000000u },
+  { 1u, 0u, 4672000000000u },
+  { 1u, 1000000000u, 0u },
+  { 1u, 1000000000000000000u, 0u },
+  { 1u, 11515845246265065472u, 54210108u },
+  { 1u, 12919594847110692864u, 11836624275221u },
+  { 1u, 802379605485813760u, 1813700372640u },
+  { 1u, 10538423128046960640u, 26784043497085u },
+  { 1u, 9223372036854775808u, 30333571289062u },
+  { 1u, 0u, 20454500000000u },
+  { 1u, 0u, 24832000000000u },
+  { 14555633995661443073u, 15258u, 0u },
+  { 1u, 15258789062500u, 0u },
+  { 1u, 3331713542200813568u, 827u },
+  { 1u, 510511270148964352u, 827180612553u },
+  { 1u, 7539038019559358464u, 31689027674871u },
+  { 1u, 17761513308994666496u, 25335408692069u },
+  { 1u, 14980801947982888960u, 2917962853565u },
+  { 1u, 16212958658533785600u, 11453812110900u },
+  { 1u, 0u, 30260878906250u },
+  { 1u, 0u, 5002000000000u },
+  { 1u, 0u, 25600000000000u },
+  { 12061765702005030913u, 232830643u, 0u },
+  { 16717361816799281153u, 232830643653869628u, 0u },
+  { 1u, 8919668326767763216u, 12621774u },
+  { 1u, 16354655608410120192u, 6094483536188u },
+  { 1u, 821333526249996288u, 14652886587657u },
+  { 1u, 12447333534018830336u, 6409044524579u },
+  { 1u, 17741052222235475968u, 32291674771302u },
+  { 1u, 1407937833506701312u, 20326961744368u },
+  { 1u, 16429131440647569408u, 2544076324462u },
+  { 1u, 0u, 32366890625000u },
+  { 1u, 0u, 10216000000000u },
+  { 1u, 0u, 4096000000000u },
+  { 13165050183672659969u, 3552u, 0u },
+  { 9240515622155059201u, 3552713678800u, 0u },
+  { 11461661051657912321u, 10938816648267019083u, 192u },
+  { 11529215046068469761u, 13347792947859426082u, 192592994438u },
+  { 1u, 11027357695148397120u, 24710723585305u },
+  { 1u, 9089298404200579072u, 17689597794258u },
+  { 1u, 14944903120449175552u, 22482492731853u },
+  { 1u, 9939465861033099264u, 12749810164821u },
+  { 1u, 18333841821723000832u, 25685538819523u },
+  { 1u, 12098920398930837504u, 19907993879556u },
+  { 1u, 1152921504606846976u, 17412655883789u },
+  { 1u, 0u, 9741062500000u },
+  { 1u, 0u, 28320000000000u },
+  { 1u, 0u, 16384000000000u },
+  { 11515845246265065473u, 54210108u, 0u },
+  { 12919594847110692865u, 54210108624275221u, 0u },
+  { 802379605485813761u, 16178822382532126880u, 2938735u },
+  { 10538423128046960641u, 14202551164014556797u, 22383877055718u },
+  { 9223372036854775809u, 6328259118096044006u, 25830769921841u },
+  { 1u, 3588752519208427776u, 3889343055614u },
+  { 1u, 16453208477880942592u, 18174194546663u },
+  { 1u, 14826974150458867712u, 30695891930218u },
+  { 1u, 4901226909360193536u, 3178803771879u },
+  { 1u, 2741865340324544512u, 14823265696043u },
+  { 1u, 17194743377300553728u, 31019148636817u },
+  { 1u, 4611686018427387904u, 29329932128906u },
+  { 1u, 0u, 4746250000000u },
+  { 1u, 0u, 5760000000000u },
+  { 510511270148964353u, 827180612553u, 0u },
+  { 7539038019559358465u, 15523873309807403767u, 44u },
+  { 17761513308994666497u, 7270715362168605541u, 44841550858u },
+  { 14980801947982888961u, 10318124782853532861u, 17418394146269u },
+  { 16212958658533785601u, 5115580986757150260u, 5597559346665u },
+  { 1u, 17863497503025927050u, 21993277316200u },
+  { 1u, 894753717657461760u, 23656968382140u },
+  { 1u, 4172378366569611264u, 26300048504696u },
+  { 1u, 8731114140132704256u, 30584226185084u },
+  { 1u, 17479013999763783680u, 32636473314645u },
+  { 1u, 10559322645067726848u, 3413947539247u },
+  { 1u, 10844667902708154368u, 24367572422027u },
+  { 1u, 0u, 3467587890625u },
+  { 1u, 0u, 11713000000000u },
+  { 1u, 0u, 18944000000000u },
+  { 8919668326767763217u, 12621774u, 0u },
+  { 16354655608410120193u, 12621774483536188u, 0u },
+  { 821333526249996289u, 14126214123513026825u, 684227u },
+  { 12447333534018830337u, 1575572886739123747u, 28867765783602u },
+  { 17741052222235475969u, 6190557220368666470u, 19506085411977u },
+  { 1407937833506701313u, 6658844624407595504u, 15497335590779u },
+  { 16429131440647569409u, 7402805540348493422u, 20347360976690u },
+  { 1u, 8608694353160087528u, 7986401306892u },
+  { 1u, 18409722603012689920u, 26892466678255u },
+  { 1u, 960940804101111808u, 27119997993062u },
+  { 1u, 6858861879985438720u, 16486052092705u },
+  { 1u, 10199411257610600448u, 23329371819647u },
+  { 1u, 3296916402211913728u, 3711552911192u },
+  { 1u, 5332261958806667264u, 30552178726196u },
+  { 1u, 0u, 5428289062500u },
+  { 1u, 0u, 18020000000000u },
+  { 1u, 0u, 26624000000000u },
+  { 13347792947859426083u, 192592994438u, 0u },
+  { 11027357695148397121u, 8125553701628069145u, 10u },
+  { 9089298404200579073u, 14713846973907163090u, 10440487148u },
+  { 14944903120449175553u, 13585484211346616781u, 12524797639242u },
+  { 9939465861033099265u, 14950644993892017237u, 14922736470574u },
+  { 18333841821723000833u, 2247972121859509699u, 2606810476089u },
+  { 12098920398930837505u, 16792928468808975364u, 11833121862812u },
+  { 1152921504606846977u, 7633600803490178573u, 29852910346476u },
+  { 1u, 13863783165699681952u, 24812413818328u },
+  { 1u, 6566634389609529344u, 5592751557191u },
+  { 1u, 10268081306092961792u, 19015355977963u },
+  { 1u, 17823045832270675968u, 20715556633802u },
+  { 1u, 10751299574300672000u, 31946966189250u },
+  { 1u, 14295551117180796928u, 17602582829117u },
+  { 1u, 16717361816799281152u, 22589774963378u },
+  { 1u, 0u, 8882906250000u },
+  { 1u, 0u, 15120000000000u },
+  { 1u, 0u, 8192000000000u },
+  { 16178822382532126881u, 2938735u, 0u },
+  { 14202551164014556798u, 2938735877055718u, 0u },
+  { 6328259118096044007u, 3525417123811528497u, 159309u },
+  { 3588752519208427777u, 4200376900514301694u, 28237191113245u },
+  { 16453208477880942593u, 733751918046279655u, 27165227702888u },
+  { 14826974150458867713u, 3330727700749618282u, 23144039776771u },
+  { 4901226909360193537u, 8402847244519750119u, 515180559110u },
+  { 2741865340324544513u, 16207445638504020267u, 31494455519261u },
+  { 17194743377300553729u, 10797591651163697809u, 26653878607388u },
+  { 4611686018427387905u, 5352346881042125450u, 24092585338616u },
+  { 1u, 15054282857902741120u, 9976290151305u },
+  { 1u, 18215643600950198272u, 2953816094308u },
+  { 1u, 4954686591873318912u, 13924987472018u },
+  { 1u, 6358456381716037632u, 2194268594098u },
+  { 1u, 2500315829841690624u, 8114344692611u },
+  { 1u, 13479273684719894528u, 2947135542392u },
+  { 1u, 11529215046068469760u, 5240730712890u },
+  { 1u, 0u, 31546625000000u },
+  { 1u, 0u, 576000000000u },
+  { 7270715362168605542u, 44841550858u, 0u },
+  { 10318124782853532862u, 7948062710975043037u, 2u },
+  { 5115580986757150261u, 16869703871864853993u, 2430865342u },
+  { 17863497503025927051u, 6514468057157164136u, 4030914508479u },
+  { 894753717657461761u, 145010435877398204u, 14015353150021u },
+  { 4172378366569611265u, 8864901133799028600u, 23109007861031u },
+  { 8731114140132704257u, 7502399860263354236u, 25895480567253u },
+  { 17479013999763783681u, 6781459897086512469u, 9685406705911u },
+  { 10559322645067726849u, 12031448074852327215u, 26871367623677u },
+  { 10844667902708154369u, 831425316353183115u, 25597652226107u },
+  { 1u, 13142907561237294529u, 20539045071656u },
+  { 1u, 9841003738275531264u, 19240712478446u },
+  { 1u, 11507357020229730304u, 7918533481881u },
+  { 1u, 829544908158140416u, 5529623815074u },
+  { 1u, 10698506592212484096u, 25506044969719u },
+  { 1u, 8879585537174798336u, 759579967204u },
+  { 1u, 9385501623440113664u, 32484481363296u },
+  { 1u, 9223372036854775808u, 28000508789062u },
+  { 1u, 0u, 16710500000000u },
+  { 1u, 0u, 8448000000000u },
+  { 14126214123513026826u, 684227u, 0u },
+  { 1575572886739123748u, 684227765783602u, 0u },
+  { 6190557220368666471u, 1134601567396871305u, 37092u },
+  { 6658844624407595505u, 3944971201493782395u, 4324061506874u },
+  { 7402805540348493423u, 6504607449490202418u, 27962213857317u },
+  { 8608694353160087529u, 7288929789578897676u, 30757352615476u },
+  { 18409722603012689921u, 11949571663834409455u, 11828395133675u },
+  { 960940804101111809u, 16786989612912918630u, 19179647787577u },
+  { 6858861879985438721u, 7205098564190952225u, 25145910024530u },
+  { 10199411257610600449u, 15004599270058462847u, 22866390589175u },
+  { 3296916402211913729u, 5415779096767166296u, 7927813400956u },
+  { 5332261958806667265u, 2228869027395179828u, 27004293589973u },
+  { 1u, 1556450734566655588u, 11221120827232u },
+  { 1u, 7179313413832763392u, 16224084375363u },
+  { 1u, 213802753578762240u, 14147389191360u },
+  { 1u, 9143568635191623680u, 29888011590270u },
+  { 1u, 17104814596142661632u, 23166495673848u },
+  { 1u, 4703587598323417088u, 19960927253857u },
+  { 1u, 11601272640106397696u, 30049254981994u },
+  { 1u, 0u, 16746628906250u },
+  { 1u, 0u, 32010000000000u },
+  { 1u, 0u, 25600000000000u },
+  { 14713846973907163091u, 10440487148u, 0u },
+  { 13585484211346616782u, 10440487148797639242u, 0u },
+  { 14950644993892017238u, 7870663494266784302u, 565979942u },
+  { 2247972121859509700u, 17880797147977428537u, 11046426669522u },
+  { 16792928468808975365u, 12552769281630565532u, 29138969319955u },
+  { 7633600803490178574u, 5398590914327077100u, 23059680486986u },
+  { 13863783165699681953u, 16301316475377718744u, 26186292658199u },
+  { 6566634389609529345u, 15659688795399801415u, 23883696136u },
+  { 10268081306092961793u, 11454853129255375083u, 18440848913430u },
+  { 17823045832270675969u, 7601032909325401290u, 13334620968832u },
+  { 10751299574300672001u, 12381836760367383746u, 6016412052819u },
+  { 14295551117180796929u, 13790045808561903677u, 27987671220715u },
+  { 16717361816799281153u, 3982136043154645682u, 491747559881u },
+  { 1u, 8412727366299204368u, 18889215872027u },
+  { 1u, 6520788830264139776u, 3099456054864u },
+  { 1u, 14841873570757345280u, 9808353492670u },
+  { 1u, 8458113346229501952u, 32446804579578u },
+  { 1u, 4713756981368717312u, 21754458515243u },
+  { 1u, 18233386041362874368u, 10027255533277u },
+  { 1u, 16429131440647569408u, 3805988433837u },
+  { 1u, 0u, 12205890625000u },
+  { 1u, 0u, 24040000000000u },
+  { 1u, 0u, 4096000000000u },
+  { 3525417123811528498u, 159309u, 0u },
+  { 4200376900514301695u, 159309191113245u, 0u },
+  { 733751918046279656u, 3109292689539947112u, 8636u },
+  { 3330727700749618283u, 8201890710707044867u, 8636168555094u },
+  { 8402847244519750120u, 6490723028029635334u, 19030444625386u },
+  { 16207445638504020268u, 7370786116105234461u, 19946351862800u },
+  { 10797591651163697810u, 6722662813883932u, 9232399571116u },
+  { 5352346881042125451u, 5190637518432610040u, 6316000364436u },
+  { 15054282857902741121u, 12976734163502304137u, 18324281385023u },
+  { 18215643600950198273u, 10916841479303902820u, 24639703470168u },
+  { 4954686591873318913u, 7877829105036462226u, 20568591803162u },
+  { 6358456381716037633u, 9361786669819862962u, 8986427057971u },
+  { 2500315829841690625u, 5316841597661481859u, 26419507503472u },
+  { 13479273684719894529u, 10095791357713421432u, 8560288226560u },
+  { 11529215046068469761u, 2760806070919396154u, 23808547293946u },
+  { 1u, 18356335600226828864u, 2810149663596u },
+  { 1u, 15346707740785803264u, 29548995098946u },
+  { 1u, 12045793554555994112u, 14658831946693u },
+  { 1u, 1071290505775546368u, 5061653003777u },
+  { 1u, 12659024816259465216u, 32257058074774u },
+  { 1u, 6766658440124170240u, 28822686247110u },
+  { 1u, 1152921504606846976u, 10438366821289u },
+  { 1u, 0u, 31657062500000u },
+  { 1u, 0u, 1696000000000u },
+  { 1u, 0u, 16384000000000u },
+  { 16869703871864853994u, 2430865342u, 0u },
+  { 6514468057157164137u, 2430865342914508479u, 0u },
+  { 145010435877398205u, 5356593957724052037u, 131777474u },
+  { 8864901133799028601u, 5614398926044292391u, 17346290381540u },
+  { 7502399860263354237u, 11822061491118122453u, 29412304357175u },
+  { 6781459897086512470u, 11001168092338972919u, 1847640875237u },
+  { 12031448074852327216u, 5157826676089054205u, 24805596374517u },
+  { 831425316353183116u, 6935459960423174203u, 9717279606344u },
+  { 13142907561237294530u, 15012915935620909864u, 17992375972037u },
+  { 9841003738275531265u, 11752826383709314798u, 12485813851803u },
+  { 11507357020229730305u, 16659802296101639577u, 22171637121994u },
+  { 829544908158140417u, 2409506929207632802u, 970903129692u },
+  { 10698506592212484097u, 6701510295078044407u, 3676130619632u },
+  { 8879585537174798337u, 790986811114421988u, 12528363289601u },
+  { 9385501623440113665u, 17540674744154123616u, 15361042879480u },
+  { 9223372036854775809u, 4126094380801016134u, 5112950881883u },
+  { 1u, 10648100698210345216u, 32347223676024u },
+  { 1u, 9079554670351482880u, 21624577234695u },
+  { 1u, 17336236976998711296u, 5895492203644u },
+  { 1u, 12161511094774398976u, 29820939799289u },
+  { 1u, 8910670929915281408u, 2809659276837u },
+  { 1u, 477381560501272576u, 15909483048439u },
+  { 1u, 4611686018427387904u, 28151025878906u },
+  { 1u, 0u, 18298250000000u },
+  { 1u, 0u, 30336000000000u },
+  { 1134601567396871306u, 37092u, 0u },
+  { 3944971201493782396u, 37092061506874u, 0u },
+  { 6504607449490202419u, 14105918718015109157u, 2010u },
+  { 7288929789578897677u, 17502199720797515316u, 2010764683385u },
+  { 11949571663834409456u, 520064672327158507u, 10361948796148u },
+  { 16786989612912918631u, 6982154661811184185u, 29940028192762u },
+  { 7205098564190952226u, 11958543087741491538u, 14330378503362u },
+  { 15004599270058462848u, 14287775644553486071u, 17602648273919u },
+  { 5415779096767166297u, 12737816200004790652u, 29695774541869u },
+  { 2228869027395179829u, 15464133079405407189u, 18477690518399u },
+  { 1556450734566655589u, 273284935818395488u, 31615838312334u },
+  { 7179313413832763393u, 1034738780546348867u, 22414014814806u },
+  { 213802753578762241u, 12749792802017866944u, 6742056093301u },
+  { 9143568635191623681u, 13547121223608064638u, 18037691167652u },
+  { 17104814596142661633u, 1439167730400808440u, 13220734390913u },
+  { 4703587598323417089u, 18328306067718174049u, 21121078017438u },
+  { 11601272640106397697u, 15310149410368471402u, 15774993579462u },
+  { 1u, 10882805567573589258u, 32198829964862u },
+  { 1u, 17617220372349707264u, 32318589958071u },
+  { 1u, 790848779512709120u, 30647955031430u },
+  { 1u, 4478121370537951232u, 1414042871998u },
+  { 1u, 17147181390500986880u, 26814242759445u },
+  { 1u, 14373871529450536960u, 8981929550565u },
+  { 1u, 17762196930349236224u, 25317779209136u },
+  { 1u, 0u, 31664962890625u },
+  { 1u, 0u, 27521000000000u },
+  { 1u, 0u, 18944000000000u },
+  { 7870663494266784303u, 565979942u, 0u },
+  { 17880797147977428538u, 565979942426669522u, 0u },
+  { 12552769281630565533u, 2916629296072776211u, 30681834u },
+  { 5398590914327077101u, 17650740775128950346u, 10986158110790u },
+  { 16301316475377718745u, 13257014992343662615u, 14406956848574u },
+  { 15659688795399801416u, 14178077049802213384u, 5566718664222u },
+  { 11454853129255375084u, 17581989484432438294u, 24094768595096u },
+  { 7601032909325401291u, 14424379545188079488u, 152953121559u },
+  { 12381836760367383747u, 18122439389506858323u, 27415781947181u },
+  { 13790045808561903678u, 15532356334844609003u, 14125982419407u },
+  { 3982136043154645683u, 1897720081844029897u, 2511842010724u },
+  { 8412727366299204369u, 14300530738183834651u, 26212102875611u },
+  { 6520788830264139777u, 12944677941634803280u, 10715775233324u },
+  { 14841873570757345281u, 5945054943062589118u, 27948701732397u },
+  { 8458113346229501953u, 4440265950390047994u, 20013322282074u },
+  { 4713756981368717313u, 9063164914470070059u, 9306240707299u },
+  { 18233386041362874369u, 9096874355769544413u, 27363491315154u },
+  { 16429131440647569409u, 17850004465555779501u, 32210493142546u },
+  { 1u, 398017684463574504u, 30226967650681u },
+  { 1u, 16770910393083695104u, 24953021576581u },
+  { 1u, 2528188411062255616u, 13701909152874u },
+  { 1u, 7126321313257357312u, 1130137053368u },
+  { 1u, 8912894692182458368u, 26808386318652u },
+  { 1u, 7746472834053963776u, 28988483168989u },
+  { 1u, 14555633995661443072u, 27357419937133u },
+  { 1u, 0u, 7533789062500u },
+  { 1u, 0u, 9572000000000u },
+  { 1u, 0u, 26624000000000u },
+  { 3109292689539947113u, 8636u, 0u },
+  { 8201890710707044868u, 8636168555094u, 0u },
+  { 6490723028029635335u, 3092328598374469098u, 468u },
+  { 7370786116105234462u, 4055197843423994896u, 468167635469u },
+  { 6722662813883933u, 10790264043221653676u, 12813219832715u },
+  { 5190637518432610041u, 16005446466008336276u, 9099584941385u },
+  { 12976734163502304138u, 9266424513183637567u, 11593867656991u },
+  { 10916841479303902821u, 7716856585087471704u, 32543502333879u },
+  { 7877829105036462227u, 13199482609372734234u, 30647418331633u },
+  { 9361786669819862963u, 707020671469414195u, 8689715545386u },
+  { 5316841597661481860u, 7378051046450143600u, 1322038327667u },
+  { 10095791357713421433u, 12239594621091470592u, 31091399964948u },
+  { 2760806070919396155u, 17090232206074383098u, 14612663509753u },
+  { 18356335600226828865u, 5633249423249699692u, 8953926463344u },
+  { 15346707740785803265u, 2619473886350883138u, 12144305379063u },
+  { 12045793554555994113u, 16925510117510124485u, 5879142001963u },
+  { 1071290505775546369u, 18289819843991928321u, 11563917533741u },
+  { 12659024816259465217u, 8508135015509192854u, 25133991493120u },
+  { 6766658440124170241u, 7023651167128889542u, 32256461226923u },
+  { 1152921504606846977u, 13080116596551547817u, 17323380752892u },
+  { 1u, 9541477337631491744u, 16892709074541u },
+  { 1u, 16769261951547752448u, 30317517244522u },
+  { 1u, 17382904661723316224u, 2154909063511u },
+  { 1u, 16923801176523145216u, 22871942329149u },
+  { 1u, 2120573100910182400u, 29501917441100u },
+  { 1u, 2694278477074399232u, 11340114956498u },
+  { 1u, 16717361816799281152u, 4306146057128u },
+  { 1u, 0u, 23464906250000u },
+  { 1u, 0u, 22288000000000u },
+  { 1u, 0u, 8192000000000u },
+  { 5356593957724052038u, 131777474u, 0u },
+  { 5614398926044292392u, 131777474290381540u, 0u },
+  { 11822061491118122454u, 3606600754002134839u, 7143671u },
+  { 11001168092338972920u, 11784677496307998949u, 247195514218u },
+  { 5157826676089054206u, 3263383628738110965u, 13674638848647u },
+  { 6935459960423174204u, 18383553598366664264u, 12935176908380u },
+  { 15012915935620909865u, 8626481361138331845u, 28252996574437u },
+  { 11752826383709314799u, 11669309517614536347u, 7397467642491u },
+  { 16659802296101639578u, 9595492744345551818u, 23163632594536u },
+  { 2409506929207632803u, 17974823117890391644u, 11880520172703u },
+  { 6701510295078044408u, 13336471157943415024u, 17567974417113u },
+  { 790986811114421989u, 2520306242738764801u, 25305722971550u },
+  { 17540674744154123617u, 3418318073738892280u, 26014136626075u },
+  { 4126094380801016135u, 1654831358081433179u, 27547185307394u },
+  { 10648100698210345217u, 12478325455348749432u, 24322089708587u },
+  { 9079554670351482881u, 7074589670171907847u, 27691676451378u },
+  { 17336236976998711297u, 9079386672616436860u, 16946383514274u },
+  { 12161511094774398977u, 14099470230825077497u, 27298492194537u },
+  { 8910670929915281409u, 13978246930191236645u, 7913764333812u },
+  { 477381560501272577u, 8533622460326997495u, 10484757762284u },
+  { 4611686018427387905u, 9829925015320381306u, 4332462608600u },
+  { 1u, 15661251471279715968u, 4312532881302u },
+  { 1u, 8304051524653350912u, 3990848998143u },
+  { 1u, 3191958593276477440u, 2815450163535u },
+  { 1u, 1212072361143042048u, 10575173036422u },
+  { 1u, 6604783940236476416u, 10630065706574u },
+  { 1u, 15496886317781876736u, 22094358046054u },
+  { 1u, 11529215046068469760u, 25958840087890u },
+  { 1u, 0u, 13650625000000u },
+  { 1u, 0u, 29248000000000u },
+  { 17502199720797515317u, 2010764683385u, 0u },
+  { 520064672327158508u, 69579351607670004u, 109u },
+  { 6982154661811184186u, 3849068651449595898u, 109003771904u },
+  { 11958543087741491539u, 12864300655889532098u, 4096208658429u },
+  { 14287775644553486072u, 17175883589650805759u, 24573697375135u },
+  { 12737816200004790653u, 2082202032388163629u, 15263931106515u },
+  { 15464133079405407190u, 6519982945081359231u, 1235112876398u },
+  { 273284935818395489u, 12567441175777105806u, 22894353448983u },
+  { 1034738780546348868u, 4944945189910485590u, 23681282351u },
+  { 12749792802017866945u, 16346299820918163061u, 12591268066015u },
+  { 13547121223608064639u, 16545700537827111844u, 29407886134688u },
+  { 1439167730400808441u, 7753843342842876545u, 19872896944223u },
+  { 18328306067718174050u, 16069431671133978014u, 2143420336689u },
+  { 15310149410368471403u, 7794513984230751686u, 18993871125636u },
+  { 10882805567573589259u, 13993354941865033278u, 31876422541449u },
+  { 17617220372349707265u, 7683842454693541815u, 8329758581291u },
+  { 790848779512709121u, 2227526631553566086u, 8747416541934u },
+  { 4478121370537951233u, 12174568983810664638u, 23278120754460u },
+  { 17147181390500986881u, 1219479811855622933u, 23836659984707u },
+  { 14373871529450536961u, 1213870092328657637u, 10563066108133u },
+  { 17762196930349236225u, 10346696165662948272u, 6373065804029u },
+  { 1u, 792478769211075457u, 18685560895523u },
+  { 1u, 2976646584138058240u, 14371042960360u },
+  { 1u, 12215469534045536256u, 9192161364334u },
+  { 1u, 6219008916450181120u, 18798662201930u },
+  { 1u, 16530135946029432832u, 12874337133148u },
+  { 1u, 3842309353960898560u, 8796896100465u },
+  { 1u, 8232580118833266688u, 113208292007u },
+  { 1u, 9223372036854775808u, 29351446289062u },
+  { 1u, 0u, 6822500000000u },
+  { 1u, 0u, 24832000000000u },
+  { 2916629296072776212u, 30681834u, 0u },
+  { 17650740775128950347u, 30681834158110790u, 0u },
+  { 13257014992343662616u, 10376352273588262334u, 1663265u },
+  { 14178077049802213385u, 16140252933215870494u, 24865562503183u },
+  { 17581989484432438295u, 13519786689574174872u, 10255874964864u },
+  { 14424379545188079489u, 347653368119257879u, 15744732909105u },
+  { 18122439389506858324u, 15667559640712984365u, 20017018846326u },
+  { 15532356334844609004u, 6665688398301647u, 15478849340110u },
+  { 1897720081844029898u, 12767498922494223972u, 718000361347u },
+  { 14300530738183834652u, 8277584064871180763u, 3971692127503u },
+  { 12944677941634803281u, 5593723204548554028u, 25871448728731u },
+  { 5945054943062589119u, 9826691226205703725u, 25755303236342u },
+  { 4440265950390047995u, 14569671469588489306u, 21238532705998u },
+  { 9063164914470070060u, 18195787329328376547u, 3790789823472u },
+  { 9096874355769544414u, 11567990639529164242u, 19440986395607u },
+  { 17850004465555779502u, 2462178867419313682u, 5079627102029u },
+  { 398017684463574505u, 15775580534084428153u, 30541133474983u },
+  { 16770910393083695105u, 6709423314055247237u, 27815855195934u },
+  { 2528188411062255617u, 12196610823634650218u, 1822363718566u },
+  { 7126321313257357313u, 11017230585619474616u, 5030661179597u },
+  { 8912894692182458369u, 14482889854747668796u, 18637597245266u },
+  { 7746472834053963777u, 4045088982575213277u, 32594785119032u },
+  { 14555633995661443073u, 2587363405946690925u, 11064219284713u },
+  { 1u, 5291353005479830884u, 13545140261251u },
+  { 1u, 3623803744718219264u, 4483286844821u },
+  { 1u, 11699478161859280896u, 17813196446794u },
+  { 1u, 31865301356249088u, 7242634229982u },
+  { 1u, 8261697660637937664u, 30942001727421u },
+  { 1u, 11143735065463226368u, 1981447867527u },
+  { 1u, 6989586621679009792u, 3207604103088u },
+  { 1u, 0u, 26544378906250u },
+  { 1u, 0u, 1674000000000u },
+  { 1u, 0u, 25600000000000u },
+  { 4055197843423994897u, 468167635469u, 0u },
+  { 10790264043221653677u, 6999033626481042315u, 25u },
+  { 16005446466008336277u, 2886772166882700617u, 25379418373u },
+  { 9266424513183637568u, 13655120365760610079u, 12549156492232u },
+  { 7716856585087471705u, 5634289913586612151u, 21448740245558u },
+  { 13199482609372734235u, 4356908757515215345u, 4150305435468u },
+  { 707020671469414196u, 202099134988584234u, 12108236188497u },
+  { 7378051046450143601u, 1117931949090929011u, 27473010955816u },
+  { 12239594621091470593u, 7282165428390574356u, 5672060603212u },
+  { 17090232206074383099u, 16472845415480173305u, 19276394766978u },
+  { 5633249423249699693u, 5978115498789515120u, 8834892994739u },
+  { 2619473886350883139u, 10290384514131826423u, 6323324074290u },
+  { 16925510117510124486u, 5472151192935836971u, 14642557842862u },
+  { 18289819843991928322u, 10653159957097243181u, 30126296645910u },
+  { 8508135015509192855u, 8596564833588116992u, 16662577508958u },
+  { 7023651167128889543u, 7829467193462604715u, 29278466020713u },
+  { 13080116596551547818u, 512949785241895420u, 5481424436267u },
+  { 9541477337631491745u, 10639377275221210733u, 15403027807063u },
+  { 16769261951547752449u, 14469389287408830570u, 15191576761797u },
+  { 17382904661723316225u, 18397988419123206487u, 21957784387164u },
+  { 16923801176523145217u, 12337672902340997949u, 15964997356950u },
+  { 2120573100910182401u, 3812618039578274892u, 3478668826588u },
+  { 2694278477074399233u, 1261933060233236690u, 22492206682438u },
+  { 16717361816799281153u, 5013969055003859880u, 20806068409528u },
+  { 1u, 2038620301207983888u, 5304271807807u },
+  { 1u, 17932771252461805568u, 9535110513827u },
+  { 1u, 9781100029220487168u, 1187972137477u },
+  { 1u, 902860290213806080u, 16901530234495u },
+  { 1u, 7471578434435547136u, 11903048944154u },
+  { 1u, 9694561147868413952u, 2586405035078u },
+  { 1u, 16429131440647569408u, 23622525543212u },
+  { 1u, 0u, 25388890625000u },
+  { 1u, 0u, 5096000000000u },
+  { 1u, 0u, 4096000000000u },
+  { 3606600754002134840u, 7143671u, 0u },
+  { 11784677496307998950u, 7143671195514218u, 0u },
+  { 3263383628738110966u, 3532273531389588103u, 387259u },
+  { 18383553598366664265u, 15260655697946209884u, 26811191484931u },
+  { 8626481361138331846u, 1168207125790530789u, 25091827281803u },
+  { 11669309517614536348u, 3408165499164318331u, 12171063328635u },
+  { 9595492744345551819u, 16956337155814698600u, 32635184757021u },
+  { 17974823117890391645u, 1596543126190638239u, 14621919204879u },
+  { 13336471157943415025u, 5425822768100795097u, 22031086548776u },
+  { 2520306242738764802u, 11710173336790164894u, 30504294134441u },
+  { 3418318073738892281u, 11003229533399640987u, 12969634809768u },
+  { 1654831358081433180u, 4121513627804098306u, 18344596486268u },
+  { 12478325455348749433u, 8479798646785993771u, 14460223427701u },
+  { 7074589670171907848u, 13913470653128360498u, 5237459690805u },
+  { 9079386672616436861u, 8241155541304044194u, 9525754250755u },
+  { 14099470230825077498u, 1542883815539482345u, 17923446753937u },
+  { 13978246930191236646u, 4335566893266807028u, 19089083639899u },
+  { 8533622460326997496u, 4276048715225174252u, 10331235031552u },
+  { 9829925015320381307u, 6180566848994873560u, 6656231805065u },
+  { 15661251471279715969u, 4493747259233374102u, 4233335049200u },
+  { 8304051524653350913u, 979158226948000511u, 3056243606527u },
+  { 3191958593276477441u, 15554365388965292367u, 1023053080273u },
+  { 1212072361143042049u, 5856387621012285830u, 9937843203837u },
+  { 6604783940236476417u, 1493019783569495630u, 12029317475409u },
+  { 15496886317781876737u, 11907267046668035430u, 27729080936764u },
+  { 11529215046068469761u, 334384429729396050u, 26940645494240u },
+  { 1u, 4757357829128942144u, 19936018127016u },
+  { 1u, 12573782461196435456u, 22696257896884u },
+  { 1u, 728008297013051392u, 16820681626113u },
+  { 1u, 15872521863977500672u, 20993039465408u },
+  { 1u, 7146337397381267456u, 31680860451134u },
+  { 1u, 10657768518172278784u, 28990387403726u },
+  { 1u, 1152921504606846976u, 15310577758789u },
+  { 1u, 0u, 29253062500000u },
+  { 1u, 0u, 7840000000000u },
+  { 1u, 0u, 16384000000000u },
+  { 3849068651449595899u, 109003771904u, 0u },
+  { 12864300655889532099u, 16770051535660900349u, 5u },
+  { 17175883589650805760u, 7062721499773320095u, 5909106315u },
+  { 2082202032388163630u, 12649221803826283731u, 20107382870899u },
+  { 6519982945081359232u, 18409359906285476206u, 21363685715687u },
+  { 12567441175777105807u, 4115704367658434583u, 28391997973400u },
+  { 4944945189910485591u, 15424571610082029871u, 9112223112780u },
+  { 16346299820918163062u, 8586195481066959583u, 24140836167702u },
+  { 16545700537827111845u, 12873999692880104864u, 24598465458589u },
+  { 7753843342842876546u, 14386916905593505887u, 12701697900921u },
+  { 16069431671133978015u, 4070191052543150641u, 377779916328u },
+  { 7794513984230751687u, 1474213844492549252u, 3624220645499u },
+  { 13993354941865033279u, 11904633492737597577u, 22651079917292u },
+  { 7683842454693541816u, 14268373794493899307u, 32492645351474u },
+  { 2227526631553566087u, 5373099372968401646u, 50773490093u },
+  { 12174568983810664639u, 12131356176753253660u, 31149291276300u },
+  { 1219479811855622934u, 1873562692311492931u, 2060657642136u },
+  { 1213870092328657638u, 1191577884382042341u, 19096101566037u },
+  { 10346696165662948273u, 10083628134824069373u, 13909064595566u },
+  { 792478769211075458u, 9511335878798620707u, 14446546634576u },
+  { 2976646584138058241u, 2797254184354259944u, 18256515610551u },
+  { 12215469534045536257u, 3385951856235858286u, 14263151639453u },
+  { 6219008916450181121u, 17028414447738499658u, 15261183552817u },
+  { 16530135946029432833u, 16806489599916024412u, 11569923112196u },
+  { 3842309353960898561u, 14834862274859892849u, 15620911081626u },
+  { 8232580118833266689u, 6388428662944658087u, 10394804199495u },
+  { 9223372036854775809u, 13957973005822302886u, 8263346317411u },
+  { 1u, 15132387331466617088u, 26723756663232u },
+  { 1u, 18140741494511370240u, 25024820328360u },
+  { 1u, 17383440656151609344u, 14248983411566u },
+  { 1u, 4309544518081839104u, 15214942358206u },
+  { 1u, 8234005085902864384u, 2750233620876u },
+  { 1u, 2206763817411543040u, 12684446366310u },
+  { 1u, 4611686018427387904u, 31334119628906u },
+  { 1u, 0u, 24682250000000u },
+  { 1u, 0u, 22144000000000u },
+  { 10376352273588262335u, 1663265u, 0u },
+  { 16140252933215870495u, 1663265562503183u, 0u },
+  { 13519786689574174873u, 14883097162153508224u, 90165u },
+  { 347653368119257880u, 15236714976131829297u, 24629806814313u },
+  { 15667559640712984366u, 17215009005186595958u, 21609825983973u },
+  { 6665688398301648u, 2564862788452287182u, 24037933227508u },
+  { 12767498922494223973u, 6795041298079813507u, 7668139041490u },
+  { 8277584064871180764u, 16147224528929187087u, 8914368359926u },
+  { 5593723204548554029u, 12798582157702522011u, 28150875342795u },
+  { 9826691226205703726u, 106335593150239478u, 18379693812529u },
+  { 14569671469588489307u, 1020127421786132174u, 27441005764464u },
+  { 18195787329328376548u, 6375712192191155184u, 8048055301218u },
+  { 11567990639529164243u, 9145866593573966807u, 13410345628050u },
+  { 2462178867419313683u, 9237663503796303693u, 12690495798421u },
+  { 15775580534084428154u, 17991118073404943527u, 31893500774741u },
+  { 6709423314055247238u, 580023561828894494u, 18773975300465u },
+  { 12196610823634650219u, 5375074743564604326u, 31089031443140u },
+  { 11017230585619474617u, 13138425669958879437u, 29380291383385u },
+  { 14482889854747668797u, 13289713414371606354u, 20569712235482u },
+  { 4045088982575213278u, 14362124343152388920u, 5082720436807u },
+  { 2587363405946690926u, 13238092312390415593u, 583778572320u },
+  { 5291353005479830885u, 4295641285106471299u, 6176717638422u },
+  { 3623803744718219265u, 12480015875404481941u, 2838232867180u },
+  { 11699478161859280897u, 4396895582900132938u, 8556676543016u },
+  { 31865301356249089u, 2925877269964781790u, 29224238356187u },
+  { 8261697660637937665u, 11549297249100335037u, 5851158612124u },
+  { 11143735065463226369u, 7522068784404696199u, 2204626088658u },
+  { 6989586621679009793u, 16267232755968534448u, 29394407772165u },
+  { 1u, 13234104310776104586u, 20485881848454u },
+  { 1u, 4282625545930073088u, 25222717422232u },
+  { 1u, 774121944385060864u, 15000232161596u },
+  { 1u, 12793726282399481856u, 28988041965234u },
+  { 1u, 8819770592795295744u, 11954693549291u },
+  { 1u, 16170807780771364864u, 11499478120721u },
+  { 1u, 6232981884280766464u, 30993876621246u },
+  { 1u, 0u, 6078337890625u },
+  { 1u, 0u, 14657000000000u },
+  { 1u, 0u, 18944000000000u },
+  { 2886772166882700618u, 25379418373u, 0u },
+  { 13655120365760610080u, 6932674299446940616u, 1u },
+  { 5634289913586612152u, 15305997302415167542u, 1375821026u },
+  { 4356908757515215346u, 6766076695385157452u, 23778829739776u },
+  { 202099134988584235u, 11381761294972349265u, 9984366789752u },
+  { 1117931949090929012u, 2509171626500625960u, 17528617006516u },
+  { 7282165428390574357u, 7923766981497998156u, 30132136022466u },
+  { 16472845415480173306u, 14396795924685365890u, 4546429548268u },
+  { 5978115498789515121u, 16947328495324272819u, 30444780451870u },
+  { 10290384514131826424u, 11488698215331281202u, 30750918716518u },
+  { 5472151192935836972u, 3774676723337360814u, 11366622803578u },
+  { 10653159957097243182u, 3572057009307369750u, 13946204625635u },
+  { 8596564833588116993u, 8977222387791786590u, 6883193641598u },
+  { 7829467193462604716u, 14507776297319601513u, 23166486656200u },
+  { 512949785241895421u, 17974156438269541419u, 13512786468128u },
+  { 10639377275221210734u, 17493188869745556311u, 23840974380972u },
+  { 14469389287408830571u, 15013231309282170309u, 8108948307668u },
+  { 18397988419123206488u, 1430658616577244764u, 16084813868900u },
+  { 12337672902340997950u, 164319060048154006u, 28516077556159u },
+  { 3812618039578274893u, 1738591453423196124u, 20927008907754u },
+  { 1261933060233236691u, 10022263567043875142u, 8682094249231u },
+  { 5013969055003859881u, 11631862367520887992u, 17679543307996u },
+  { 2038620301207983889u, 8225891810694440255u, 3804630564522u },
+  { 17932771252461805569u, 10870326770932909219u, 16042445926488u },
+  { 9781100029220487169u, 620547076960829957u, 28760589281595u },
+  { 902860290213806081u, 8273790243093917311u, 10555033639924u },
+  { 7471578434435547137u, 14989635153045817882u, 23540448523067u },
+  { 9694561147868413953u, 16322935835857050694u, 29499812589749u },
+  { 16429131440647569409u, 13445562035194454828u, 12469884868124u },
+  { 1u, 8159408437051954152u, 22044728885378u },
+  { 1u, 12588319125224624128u, 130442322417u },
+  { 1u, 3236815336214888448u, 25073682414147u },
+  { 1u, 17947372736993034240u, 31299175468110u },
+  { 1u, 10934272053057945600u, 19534972929025u },
+  { 1u, 13348950770502860800u, 17409592748075u },
+  { 1u, 5332261958806667264u, 26667723648071u },
+  { 1u, 0u, 27719289062500u },
+  { 1u, 0u, 17508000000000u },
+  { 1u, 0u, 26624000000000u },
+  { 3532273531389588104u, 387259u, 0u },
+  { 15260655697946209885u, 387259191484931u, 0u },
+  { 1168207125790530790u, 6693145547210207115u, 20993u },
+  { 3408165499164318332u, 2810349409616265083u, 20993362836147u },
+  { 16956337155814698601u, 14157239100533913885u, 15027152349346u },
+  { 1596543126190638240u, 8481442285166056975u, 26786767465469u },
+  { 5425822768100795098u, 10503078188070369064u, 27645459779907u },
+  { 11710173336790164895u, 8569443868651401897u, 20803569373009u },
+  { 11003229533399640988u, 17878986166418130856u, 20305464550482u },
+  { 4121513627804098307u, 3199419888915986556u, 25682969221782u },
+  { 8479798646785993772u, 13148879659057484917u, 23190173440899u },
+  { 13913470653128360499u, 11160818806818645301u, 23427712802194u },
+  { 8241155541304044195u, 15744158328876615171u, 23954605029199u },
+  { 1542883815539482346u, 3803511256412670609u, 14159853492533u },
+  { 4335566893266807029u, 6710637708643706971u, 6453206188758u },
+  { 4276048715225174253u, 2282466036048992768u, 726363784399u },
+  { 6180566848994873561u, 13750844645998661769u, 17615123732731u },
+  { 4493747259233374103u, 17249934302853893104u, 22779745434781u },
+  { 979158226948000512u, 5890429344933774335u, 31901935120812u },
+  { 15554365388965292368u, 11667164313456944849u, 12716319320814u },
+  { 5856387621012285831u, 14199721077728161533u, 10990632478244u },
+  { 1493019783569495631u, 1070908299541605457u, 9764769768422u },
+  { 11907267046668035431u, 4515547093540333884u, 9190058054055u },
+  { 334384429729396051u, 8095386198221704672u, 20903244788298u },
+  { 4757357829128942145u, 2970977847977924776u, 29258438851765u },
+  { 12573782461196435457u, 15849419236643684788u, 15541161057031u },
+  { 728008297013051393u, 8303459061668565505u, 23303859198738u },
+  { 15872521863977500673u, 12733332589694745536u, 23314450131417u },
+  { 7146337397381267457u, 15428411586459398462u, 10713690275342u },
+  { 10657768518172278785u, 36716249664601038u, 32270836375868u },
+  { 1152921504606846977u, 16280986210427236933u, 8508001990391u },
+  { 1u, 18033306722804047520u, 14071882594030u },
+  { 1u, 5498606050240774144u, 14062977587516u },
+  { 1u, 4900364713306619904u, 6460298080031u },
+  { 1u, 7506296892767076352u, 12063265649303u },
+  { 1u, 17025658280157904896u, 29335406917169u },
+  { 1u, 14151435929104941056u, 13873922962784u },
+  { 1u, 16717361816799281152u, 30048767150878u },
+  { 1u, 0u, 2846906250000u },
+  { 1u, 0u, 29456000000000u },
+  { 1u, 0u, 8192000000000u },
+  { 7062721499773320096u, 5909106315u, 0u },
+  { 12649221803826283732u, 5909106315382870899u, 0u },
+  { 18409359906285476207u, 4229767357559860967u, 320333295u },
+  { 4115704367658434584u, 16763176785351549848u, 26095229296147u },
+  { 15424571610082029872u, 7781505147704860236u, 24083908733634u },
+  { 8586195481066959584u, 5855684204766355478u, 10946421836239u },
+  { 12873999692880104865u, 14938852198301020573u, 18895317437276u },
+  { 14386916905593505888u, 7229113163561632121u, 2908809836800u },
+  { 4070191052543150642u, 15750825566048095784u, 14592391891009u },
+  { 1474213844492549253u, 15817686952236439675u, 18497853853964u },
+  { 11904633492737597578u, 15965993929561767660u, 4364857478527u },
+  { 14268373794493899308u, 3985644432037085234u, 3455865518265u },
+  { 5373099372968401647u, 11039788098544597421u, 30905216062217u },
+  { 12131356176753253661u, 204453229297207308u, 21257598468112u },
+  { 1873562692311492932u, 14181588579280767640u, 16011083431u },
+  { 1191577884382042342u, 6411928315729917525u, 16039768785457u },
+  { 10083628134824069374u, 8979596445155506286u, 561347591330u },
+  { 9511335878798620708u, 12802697721526339408u, 31906486784898u },
+  { 2797254184354259945u, 3093588020849326007u, 4994694035634u },
+  { 3385951856235858287u, 11971910380006292381u, 14514167703742u },
+  { 17028414447738499659u, 2586771376734776625u, 26814648998562u },
+  { 16806489599916024413u, 5883740339963444484u, 23202140229157u },
+  { 14834862274859892850u, 17458890431245527194u, 3621318958202u },
+  { 6388428662944658088u, 13597819983439372359u, 7290946448346u },
+  { 13957973005822302887u, 6559453225233311843u, 27610737139298u },
+  { 15132387331466617089u, 15785806344617320896u, 24162355588671u },
+  { 18140741494511370241u, 12239007757592082344u, 11839855750276u },
+  { 17383440656151609345u, 18306804954185612142u, 27780663477939u },
+  { 4309544518081839105u, 2394789662099770046u, 1715992413885u },
+  { 8234005085902864385u, 13184254862284730764u, 18109129821807u },
+  { 2206763817411543041u, 3958376288928627302u, 3695714719888u },
+  { 4611686018427387905u, 11041784288475471978u, 22672214584008u },
+  { 1u, 12618879454546908800u, 27336598576325u },
+  { 1u, 17480555015662796800u, 23749684070825u },
+  { 1u, 3905162142835277824u, 2473947622786u },
+  { 1u, 17681348070832340992u, 28034211699263u },
+  { 1u, 10024704907270946816u, 23103958507799u },
+  { 1u, 17514498950843858944u, 24855543440341u },
+  { 1u, 11529215046068469760u, 25557949462890u },
+  { 1u, 0u, 14698625000000u },
+  { 1u, 0u, 25152000000000u },
+  { 14883097162153508225u, 90165u, 0u },
+  { 15236714976131829298u, 90165806814313u, 0u },
+  { 17215009005186595959u, 16568526095247236581u, 4887u },
+  { 2564862788452287183u, 6779017649901313524u, 4887898181599u },
+  { 6795041298079813508u, 3081143831420478162u, 20447367491283u },
+  { 16147224528929187088u, 14541931072452718070u, 28371167029141u },
+  { 12798582157702522012u, 818757181069117387u, 10133788319663u },
+  { 106335593150239479u, 13330765204529539889u, 24495044384915u },
+  { 1020127421786132175u, 14430055019596652400u, 22675722662229u },
+  { 6375712192191155185u, 1228598157113963618u, 29013782254850u },
+  { 9145866593573966808u, 10196111703123636626u, 21762066602439u },
+  { 9237663503796303694u, 17922417008205266069u, 22983552732322u },
+  { 17991118073404943528u, 15206854070591080789u, 3234971576172u },
+  { 580023561828894495u, 4506719336069489u, 26476824365211u },
+  { 5375074743564604327u, 13738165582185689796u, 2203000244309u },
+  { 13138425669958879438u, 9381377337051107417u, 2133744747448u },
+  { 13289713414371606355u, 8980877624698213338u, 952508565484u },
+  { 14362124343152388921u, 10629253424211755591u, 18412486854351u },
+  { 13238092312390415594u, 13308747053240293408u, 1743576212982u },
+  { 4295641285106471300u, 7547652702374693654u, 9718721468623u },
+  { 12480015875404481942u, 15754193917494206828u, 22735409159072u },
+  { 4396895582900132939u, 10242682706276807208u, 7072854036563u },
+  { 2925877269964781791u, 2052218981747037915u, 20563555256942u },
+  { 11549297249100335038u, 16995103630102825116u, 2670111251013u },
+  { 7522068784404696200u, 16024470513450775250u, 23109921306413u },
+  { 16267232755968534449u, 3332623121566650373u, 30509868688287u },
+  { 13234104310776104587u, 7819561605459731078u, 9119180661861u },
+  { 4282625545930073089u, 483008924733979288u, 9317423899284u },
+  { 774121944385060865u, 5097266894843572540u, 25236026183966u },
+  { 12793726282399481857u, 1040251214709763762u, 20766276323392u },
+  { 8819770592795295745u, 6381661072012815595u, 2112056392131u },
+  { 16170807780771364865u, 16917940484474599697u, 31171345950539u },
+  { 6232981884280766465u, 6684941770721171390u, 10059917123391u },
+  { 1u, 9919726386361907521u, 24383362391419u },
+  { 1u, 17114301122006698496u, 23931537749444u },
+  { 1u, 15726558219761614848u, 30148927768122u },
+  { 1u, 6996213511000948736u, 17978852538429u },
+  { 1u, 7193923229839261696u, 30781379265494u },
+  { 1u, 13360667166408441856u, 17366389983359u },
+  { 1u, 7079658614226419712u, 2175724283218u },
+  { 1u, 9223372036854775808u, 25938383789062u },
+  { 1u, 0u, 23558500000000u },
+  { 1u, 0u, 8448000000000u },
+  { 15305997302415167543u, 1375821026u, 0u },
+  { 6766076695385157453u, 1375821026829739776u, 0u },
+  { 11381761294972349266u, 5755422288403154040u, 74583407u },
+  { 2509171626500625961u, 7985773578781816244u, 3439312002067u },
+  { 7923766981497998157u, 2852407831267873218u, 23571432909653u },
+  { 14396795924685365891u, 6894742047770638060u, 11093154629338u },
+  { 16947328495324272820u, 6382648508248422430u, 1754373764715u },
+  { 11488698215331281203u, 17390025721326742630u, 13931346004068u },
+  { 3774676723337360815u, 6125477190097417850u, 2148942715183u },
+  { 3572057009307369751u, 15692667006913518307u, 6447332062783u },
+  { 8977222387791786591u, 910563549062879870u, 30271850701183u },
+  { 14507776297319601514u, 16675935558424671432u, 24959049361748u },
+  { 17974156438269541420u, 620089442460654880u, 26964904004278u },
+  { 17493188869745556312u, 600595753094553516u, 19126033615116u },
+  { 15013231309282170310u, 268107326286446292u, 2316032558361u },
+  { 1430658616577244765u, 5182654308513869668u, 17689014534127u },
+  { 164319060048154007u, 490773073942565311u, 32751280952253u },
+  { 1738591453423196125u, 11958948935892902378u, 5053026604861u },
+  { 10022263567043875143u, 15622820800412042511u, 5949648295920u },
+  { 11631862367520887993u, 11214203462074371804u, 22512846914812u },
+  { 8225891810694440256u, 15011498273890844330u, 17660607923187u },
+  { 10870326770932909220u, 751569502194004056u, 1011813774952u },
+  { 620547076960829958u, 6504864561507936571u, 30312040742664u },
+  { 8273790243093917312u, 8587764578480806900u, 16136352629414u },
+  { 14989635153045817883u, 11790193201272484667u, 678465543650u },
+  { 16322935835857050695u, 2622621675054280885u, 7650639147654u },
+  { 13445562035194454829u, 16326681919256188444u, 29318142172605u },
+  { 8159408437051954153u, 5845187144493826178u, 7613885071200u },
+  { 12588319125224624129u, 594491023786762737u, 16224316868230u },
+  { 3236815336214888449u, 17997325912322800195u, 18054032227422u },
+  { 17947372736993034241u, 12054986974872489038u, 31838975636992u },
+  { 10934272053057945601u, 6863306361252299777u, 13824653502153u },
+  { 13348950770502860801u, 6736129030675195947u, 9929372060583u },
+  { 5332261958806667265u, 8486168741383629895u, 19367365166286u },
+  { 1u, 5060597099538728036u, 17614460036129u },
+  { 1u, 8664188011876902912u, 9249274335518u },
+  { 1u, 4888204216114348032u, 4382469686573u },
+  { 1u, 9835783978802479104u, 1325264990081u },
+  { 1u, 16524378009793200128u, 28545533198917u },
+  { 1u, 15854500275692765184u, 16965895788326u },
+  { 1u, 2377900603251621888u, 5926859474182u },
+  { 1u, 0u, 1286128906250u },
+  { 1u, 0u, 12298000000000u },
+  { 1u, 0u, 25600000000000u },
+  { 6693145547210207116u, 20993u, 0u },
+  { 2810349409616265084u, 20993362836147u, 0u },
+  { 14157239100533913886u, 968080265682610338u, 1138u },
+  { 8481442285166056976u, 6634768529281412093u, 1138052479736u },
+  { 10503078188070369065u, 12345817477795500355u, 15096359671522u },
+  { 8569443868651401898u, 9717184351419813713u, 22242669268106u },
+  { 17878986166418130857u, 3921325292043396178u, 3210526769619u },
+  { 3199419888915986557u, 604873600708762262u, 16851212575470u },
+  { 13148879659057484918u, 11038134679072725891u, 8942032790263u },
+  { 11160818806818645302u, 17744140507958730130u, 8951598378479u },
+  { 15744158328876615172u, 7025347837818386255u, 28143961911784u },
+  { 3803511256412670610u, 7589945726609234229u, 12776380844869u },
+  { 6710637708643706972u, 5383499866382009046u, 19269411451782u },
+  { 2282466036048992769u, 9875277247280563407u, 13190291840112u },
+  { 13750844645998661770u, 4979014954027931899u, 23664535339852u },
+  { 17249934302853893105u, 9218666043279572125u, 844269912941u },
+  { 5890429344933774336u, 10645672582776533420u, 877499744887u },
+  { 11667164313456944850u, 1674677115530914542u, 631577103067u },
+  { 14199721077728161534u, 6336803061037442596u, 19163090784428u },
+  { 1070908299541605458u, 4971019203875316710u, 4268343518782u },
+  { 4515547093540333885u, 284800258740146599u, 26174269479491u },
+  { 8095386198221704673u, 17755452998948680266u, 23107015439052u },
+  { 2970977847977924777u, 13765351517414145205u, 29388962525035u },
+  { 15849419236643684789u, 190971073098046215u, 28523746221201u },
+  { 8303459061668565506u, 11376835512762358546u, 23697010352562u },
+  { 12733332589694745537u, 17475695422088718809u, 25010616739488u },
+  { 15428411586459398463u, 2143118123093720590u, 9888947359347u },
+  { 36716249664601039u, 4566739212631351612u, 20083116178666u },
+  { 16280986210427236934u, 14305130337602090743u, 31978247563428u },
+  { 18033306722804047521u, 8961874925913650926u, 10404775482669u },
+  { 5498606050240774145u, 3891294022551509308u, 21805485824213u },
+  { 4900364713306619905u, 12018241806358916895u, 6357210947471u },
+  { 7506296892767076353u, 14674800695982027415u, 24463651510193u },
+  { 17025658280157904897u, 14181401765295044145u, 6065795522539u },
+  { 14151435929104941057u, 2603439278180529504u, 24555768775330u },
+  { 16717361816799281153u, 1233555552963365662u, 674141132726u },
+  { 1u, 9596400969073423120u, 22454066871180u },
+  { 1u, 17258225329213448192u, 31628520221938u },
+  { 1u, 13998847158749495296u, 27890935570269u },
+  { 1u, 1668262632462745600u, 8029758879025u },
+  { 1u, 9585385140788396032u, 30001090436698u },
+  { 1u, 12684951300442423296u, 7770519624769u },
+  { 1u, 16429131440647569408u, 23617687652587u },
+  { 1u, 0u, 2283890625000u },
+  { 1u, 0u, 18920000000000u },
+  { 1u, 0u, 4096000000000u },
+  { 4229767357559860968u, 320333295u, 0u },
+  { 16763176785351549849u, 320333295229296147u, 0u },
+  { 7781505147704860237u, 13472619523812305602u, 17365302u },
+  { 5855684204766355479u, 15484126851077884367u, 31030730352167u },
+  { 14938852198301020574u, 10127054984562281308u, 26151839396198u },
+  { 7229113163561632122u, 13966566704081516800u, 29030548988750u },
+  { 15750825566048095785u, 2516958471385368641u, 25422757129098u },
+  { 15817686952236439676u, 2519650945105793292u, 27530136444592u },
+  { 15965993929561767661u, 7921821023665098111u, 24240136590551u },
+  { 3985644432037085235u, 3596231500756089017u, 5335429442778u },
+  { 11039788098544597422u, 5423857139618468617u, 27866194952100u },
+  { 204453229297207309u, 12936109125357207568u, 16292294027884u },
+  { 14181588579280767641u, 15884346570508189351u, 27244701267880u },
+  { 6411928315729917526u, 237640854082716209u, 14248861092153u },
+  { 8979596445155506287u, 9470366257110613154u, 18745012882536u },
+  { 12802697721526339409u, 9401145187231568770u, 3176513389583u },
+  { 3093588020849326008u, 14617302569105930418u, 17423509637101u },
+  { 11971910380006292382u, 1201431892542318782u, 18413792405560u },
+  { 2586771376734776626u, 7367401892158167714u, 10296065129753u },
+  { 5883740339963444485u, 15727418669414977061u, 32025399387656u },
+  { 17458890431245527195u, 8272257542284778618u, 26120852585074u },
+  { 13597819983439372360u, 17252092840167992282u, 14962448439979u },
+  { 6559453225233311844u, 15893487473954512482u, 6827935237826u },
+  { 15785806344617320897u, 7039862764266794559u, 1730861587682u },
+  { 12239007757592082345u, 2783491227665132676u, 23778381631725u },
+  { 18306804954185612143u, 14876266695522256563u, 4333150893361u },
+  { 2394789662099770047u, 9001076488163706557u, 30001806444033u },
+  { 13184254862284730765u, 2928683936663998063u, 1537487949334u },
+  { 3958376288928627303u, 6137698614534953104u, 19990158764274u },
+  { 11041784288475471979u, 11012767840239086280u, 26866332725308u },
+  { 12618879454546908801u, 16109277775944178885u, 28732597003340u },
+  { 17480555015662796801u, 1707369653438482857u, 25676873285698u },
+  { 3905162142835277825u, 6911834444148305282u, 16450092556694u },
+  { 17681348070832340993u, 189753859633764927u, 24982374691296u },
+  { 10024704907270946817u, 6320257949625049367u, 12768010286577u },
+  { 17514498950843858945u, 18126009029717550037u, 13809342621869u },
+  { 11529215046068469761u, 7850600440080087402u, 10413982612918u },
+  { 1u, 11483548230320546368u, 32182425581902u },
+  { 1u, 17667928268818776064u, 31054622524396u },
+  { 1u, 11410578867266519040u, 1004957780310u },
+  { 1u, 15871160118826500096u, 18774618568719u },
+  { 1u, 642858060481560576u, 30735860377314u },
+  { 1u, 5325506559365611520u, 9954034849405u },
+  { 1u, 1152921504606846976u, 5757288696289u },
+  { 1u, 0u, 18913062500000u },
+  { 1u, 0u, 13984000000000u },
+  { 1u, 0u, 16384000000000u },
+  { 16568526095247236582u, 4887u, 0u },
+  { 6779017649901313525u, 4887898181599u, 0u },
+  { 3081143831420478163u, 17957746140045864659u, 264u },
+  { 14541931072452718071u, 16584460421840578453u, 264973491368u },
+  { 818757181069117388u, 17394745137360953263u, 7336899045400u },
+  { 13330765204529539890u, 7155869970833561747u, 26648942971023u },
+  { 14430055019596652401u, 7749044514582753621u, 2191387920488u },
+  { 1228598157113963619u, 16046363919143359746u, 2152420076544u },
+  { 10196111703123636627u, 1501789878147340743u, 27648869875131u },
+  { 17922417008205266070u, 7843636575157030050u, 15803081412192u },
+  { 15206854070591080790u, 13809245118916781932u, 20064425204390u },
+  { 4506719336069490u, 16892073691720321179u, 23206748600677u },
+  { 13738165582185689797u, 13234069880921917525u, 14693915721149u },
+  { 9381377337051107418u, 14499624101407687608u, 32189717420365u },
+  { 8980877624698213339u, 10117481069208881132u, 6477786026197u },
+  { 10629253424211755592u, 14127654006175893199u, 4309548469747u },
+  { 13308747053240293409u, 5183021788509873654u, 3571765861658u },
+  { 7547652702374693655u, 2898084692608735439u, 23834280972174u },
+  { 15754193917494206829u, 18237720583644945312u, 20366157105485u },
+  { 10242682706276807209u, 16575738409901084755u, 18765988668813u },
+  { 2052218981747037916u, 13434926863032519278u, 9613898572579u },
+  { 16995103630102825117u, 11145264948903959109u, 25379728308844u },
+  { 16024470513450775251u, 9710566261937043245u, 14956604186023u },
+  { 3332623121566650374u, 15916391452861703071u, 23975526410851u },
+  { 7819561605459731079u, 10443045583647548517u, 10851862829309u },
+  { 483008924733979289u, 8444757770111935124u, 22781566118635u },
+  { 5097266894843572541u, 432764384731746590u, 27371457791236u },
+  { 1040251214709763763u, 5626729472616433728u, 17668023460204u },
+  { 6381661072012815596u, 16785572415011748291u, 8556305025615u },
+  { 16917940484474599698u, 17310879109206812491u, 2639909947703u },
+  { 6684941770721171391u, 16450769346949111615u, 2359938424636u },
+  { 9919726386361907522u, 4630289419283684731u, 7996891797993u },
+  { 17114301122006698497u, 7031913334409426372u, 6633251008492u },
+  { 15726558219761614849u, 12817247434910549562u, 28652381200785u },
+  { 6996213511000948737u, 13110356429735098429u, 24977694824375u },
+  { 7193923229839261697u, 2931275513436390358u, 6071710713846u },
+  { 13360667166408441857u, 18281919528013236351u, 2038158904763u },
+  { 7079658614226419713u, 8741099151812846930u, 19899991064843u },
+  { 9223372036854775809u, 9506242504662899718u, 267473855934u },
+  { 1u, 14507957361236648192u, 9662515334438u },
+  { 1u, 8651375583886442496u, 19750786477944u },
+  { 1u, 2801811727413411840u, 12152468992010u },
+  { 1u, 1620532701704486912u, 28682151886518u },
+  { 1u, 14546925863569457152u, 32438087849253u },
+  { 1u, 3936146074321813504u, 5413788590431u },
+  { 1u, 4611686018427387904u, 8543213378906u },
+  { 1u, 0u, 23898250000000u },
+  { 1u, 0u, 13952000000000u },
+  { 5755422288403154041u, 74583407u, 0u },
+  { 7985773578781816245u, 74583407312002067u, 0u },
+  { 2852407831267873219u, 11288525524787440469u, 4043174u },
+  { 6894742047770638061u, 16724382638987183834u, 12710611952194u },
+  { 6382648508248422431u, 9840192900738266731u, 8770906630599u },
+  { 17390025721326742631u, 605852390917015652u, 10695533437926u },
+  { 6125477190097417851u, 17005837041033255215u, 9190032843323u },
+  { 15692667006913518308u, 4448171972453463615u, 8763921888273u },
+  { 910563549062879871u, 14871005653973361023u, 29713241135885u },
+  { 16675935558424671433u, 15755491058760640852u, 23309806158831u },
+  { 620089442460654881u, 13359341622253734582u, 17391854106881u },
+  { 600595753094553517u, 9060599961220057356u, 14593724211360u },
+  { 268107326286446293u, 1823334670860567833u, 24736491176108u },
+  { 5182654308513869669u, 10436402092010471407u, 172098843170u },
+  { 490773073942565312u, 1005362712726180797u, 29218565758491u },
+  { 11958948935892902379u, 15932125718412728125u, 7707054500821u },
+  { 15622820800412042512u, 14955935633807005680u, 27605863682265u },
+  { 11214203462074371805u, 5282156223506826492u, 20697810762895u },
+  { 15011498273890844331u, 11929443913670263795u, 31887286346262u },
+  { 751569502194004057u, 7143758434654811752u, 8726646696450u },
+  { 6504864561507936572u, 13433281851786247944u, 10754387263920u },
+  { 8587764578480806901u, 6748510738120245926u, 16816728219668u },
+  { 11790193201272484668u, 3054527837147143650u, 8212365837500u },
+  { 2622621675054280886u, 15635812829529961094u, 1212165586285u },
+  { 16326681919256188445u, 16927752481179639229u, 32109847619111u },
+  { 5845187144493826179u, 14196478528839106400u, 9767917655300u },
+  { 594491023786762738u, 2408385757814507142u, 5380769592643u },
+  { 17997325912322800196u, 9966440627902970974u, 13635130558853u },
+  { 12054986974872489039u, 664263613113251328u, 2437540281829u },
+  { 6863306361252299778u, 11474296969452562121u, 32229036009802u },
+  { 6736129030675195948u, 1867094173131328423u, 10570622022885u },
+  { 8486168741383629896u, 17288300368050767054u, 13541101215377u },
+  { 5060597099538728037u, 16253968105831801889u, 7825937200640u },
+  { 8664188011876902913u, 10932406668628463902u, 30208881129376u },
+  { 4888204216114348033u, 573690730251060525u, 30624592646953u },
+  { 9835783978802479105u, 14824721558373855105u, 21289031099836u },
+  { 16524378009793200129u, 75287197369877061u, 26044803649766u },
+  { 15854500275692765185u, 2719756278727513894u, 4326004081327u },
+  { 2377900603251621889u, 5559352163896558854u, 17071147438283u },
+  { 1u, 12643987963357802506u, 20683301373084u },
+  { 1u, 17296680071123952640u, 17564685431960u },
+  { 1u, 9130510021906923520u, 29848937654905u },
+  { 1u, 1523846017408040960u, 27257494965940u },
+  { 1u, 2404700786861801472u, 3764082607858u },
+  { 1u, 15950131399030210560u, 1778130359090u },
+  { 1u, 13150510911921848320u, 4914864658355u },
+  { 1u, 0u, 6067712890625u },
+  { 1u, 0u, 5889000000000u },
+  { 1u, 0u, 18944000000000u },
+  { 6634768529281412094u, 1138052479736u, 0u },
+  { 12345817477795500356u, 12801091240077022946u, 61u },
+  { 9717184351419813714u, 11692162776434117770u, 61693948546u },
+  { 3921325292043396179u, 3010525025348272595u, 29314633833414u },
+  { 604873600708762263u, 11810136317399540462u, 7110163200888u },
+  { 11038134679072725892u, 11690196746250494711u, 31608640228772u },
+  { 17744140507958730131u, 8363533856721563119u, 19876633726835u },
+  { 7025347837818386256u, 15784499182541877736u, 20339453388078u },
+  { 7589945726609234230u, 4895371729689660229u, 25902855679415u },
+  { 5383499866382009047u, 4107768182514430854u, 28087265378633u },
+  { 9875277247280563408u, 6962703277698374768u, 16713222682559u },
+  { 4979014954027931900u, 48441517873365836u, 30655377448901u },
+  { 9218666043279572126u, 17447667153244816237u, 8133002626019u },
+  { 10645672582776533421u, 11392715022981366391u, 995945839931u },
+  { 1674677115530914543u, 16993731873898089179u, 32059617600318u },
+  { 6336803061037442597u, 15049287839302291628u, 25406921232050u },
+  { 4971019203875316711u, 8975473181680297534u, 20146815823528u },
+  { 284800258740146600u, 2456332675645495875u, 28328486561376u },
+  { 17755452998948680267u, 3027090904649462476u, 26208133158061u },
+  { 13765351517414145206u, 13956860220835360619u, 5293164098926u },
+  { 190971073098046216u, 11534947519704521873u, 30062756602908u },
+  { 11376835512762358547u, 341194280169267634u, 9244625310758u },
+  { 17475695422088718810u, 18261490647627015840u, 5158018496178u },
+  { 2143118123093720591u, 11972796431392165491u, 14002989957391u },
+  { 4566739212631351613u, 1514551995774631146u, 271649046595u },
+  { 14305130337602090744u, 3837948056500054180u, 67082104028u },
+  { 8961874925913650927u, 686106594059113773u, 11484208055581u },
+  { 3891294022551509309u, 18295039197120862421u, 17693037193912u },
+  { 12018241806358916896u, 2975365587708731279u, 27320991776062u },
+  { 14674800695982027416u, 13034853186089916337u, 32062161294891u },
+  { 14181401765295044146u, 2202805491289448427u, 5675706620807u },
+  { 2603439278180529505u, 17726416149201027746u, 7047119414324u },
+  { 1233555552963365663u, 17843428538929207222u, 9268960950944u },
+  { 9596400969073423121u, 5992329533018995596u, 31392967294199u },
+  { 17258225329213448193u, 16554332537606270194u, 31991324844834u },
+  { 13998847158749495297u, 1217661898041761629u, 8994897412165u },
+  { 1668262632462745601u, 14028472864469742897u, 16453066009583u },
+  { 9585385140788396033u, 15045203809143266906u, 11247760485037u },
+  { 12684951300442423297u, 14167391459745979457u, 10925815602132u },
+  { 16429131440647569409u, 17625101068107122923u, 7124768015829u },
+  { 1u, 7672302760728807912u, 17877955458643u },
+  { 1u, 1059495064383852544u, 13907415916366u },
+  { 1u, 9723871238268387328u, 24398057435342u },
+  { 1u, 1383411415246700544u, 28878527132116u },
+  { 1u, 1707909344575619072u, 29140074994883u },
+  { 1u, 1657606137849053184u, 7363092585951u },
+  { 1u, 14555633995661443072u, 7647089859008u },
+  { 1u, 0u, 6592789062500u },
+  { 1u, 0u, 9060000000000u },
+  { 1u, 0u, 26624000000000u },
+  { 13472619523812305603u, 17365302u, 0u },
+  { 15484126851077884368u, 17365302730352167u, 0u },
+  { 10127054984562281309u, 17474707912396435814u, 941374u },
+  { 13966566704081516801u, 2001333021379093326u, 23870947305814u },
+  { 2516958471385368642u, 8897041272249281418u, 10582108492480u },
+  { 2519650945105793293u, 14818147052202024624u, 21184482309573u },
+  { 7921821023665098112u, 5725047168716969175u, 30149803293361u },
+  { 3596231500756089018u, 16514377735957671130u, 15025310355428u },
+  { 5423857139618468618u, 17129234405171576740u, 20452895246210u },
+  { 12936109125357207569u, 13927726002188184172u, 18306928577657u },
+  { 15884346570508189352u, 8628721653485778856u, 3193755023539u },
+  { 237640854082716210u, 2289236724746668345u, 14515467763938u },
+  { 9470366257110613155u, 9503705868954602600u, 16610124099771u },
+  { 9401145187231568771u, 9023980117402305551u, 28859515196927u },
+  { 14617302569105930419u, 7151412562080974829u, 22015489190942u },
+  { 1201431892542318783u, 14894196551576332344u, 11294387678851u },
+  { 7367401892158167715u, 17197132131966254361u, 11907807416012u },
+  { 15727418669414977062u, 16600305707149813256u, 3788932258400u },
+  { 8272257542284778619u, 10713265278325865074u, 6752899904375u },
+  { 17252092840167992283u, 8461913714661825195u, 13175580767274u },
+  { 15893487473954512483u, 11825502730899130050u, 13354458721261u },
+  { 7039862764266794560u, 10675225172939889890u, 11245641061787u },
+  { 2783491227665132677u, 3941491272136364269u, 21915578705116u },
+  { 14876266695522256564u, 76462409063822641u, 9436213668670u },
+  { 9001076488163706558u, 9242253970523817473u, 27454004145035u },
+  { 2928683936663998064u, 12455889231839776278u, 11147501023591u },
+  { 6137698614534953105u, 4980147232097429746u, 12647675235108u },
+  { 11012767840239086281u, 7690175523879120956u, 2852269974322u },
+  { 16109277775944178886u, 9024696103772939340u, 25394416885250u },
+  { 1707369653438482858u, 1597569388908200002u, 7682489229756u },
+  { 6911834444148305283u, 1983587773024330134u, 8636086604410u },
+  { 189753859633764928u, 11832352604653990368u, 21114107530508u },
+  { 6320257949625049368u, 18059706774867916273u, 3340641433119u },
+  { 18126009029717550038u, 18228129452497709229u, 30239979018665u },
+  { 7850600440080087403u, 11755210576458677686u, 6569988148877u },
+  { 11483548230320546369u, 4631126371866474830u, 20109637251242u },
+  { 17667928268818776065u, 12389335157427831788u, 28842251053863u },
+  { 11410578867266519041u, 12298715729010018646u, 27431671627204u },
+  { 15871160118826500097u, 11228815948179339279u, 32196666714715u },
+  { 642858060481560577u, 5032197096355800802u, 27227608715332u },
+  { 5325506559365611521u, 3914589571164542589u, 4164272795951u },
+  { 1152921504606846977u, 16090814685253061089u, 12591212210325u },
+  { 1u, 17351954788805195424u, 10389872284811u },
+  { 1u, 17425573967386263552u, 5259940651353u },
+  { 1u, 11295898351003762688u, 24921944642257u },
+  { 1u, 11375836476823568384u, 21201612351876u },
+  { 1u, 1855705147825455104u, 10628616685331u },
+  { 1u, 11773535325853319168u, 1811100597977u },
+  { 1u, 16717361816799281152u, 32473638244628u },
+  { 1u, 0u, 4372906250000u },
+  { 1u, 0u, 3856000000000u },
+  { 1u, 0u, 8192000000000u },
+  { 16584460421840578454u, 264973491368u, 0u },
+  { 17394745137360953264u, 6719074336965322776u, 14u },
+  { 7155869970833561748u, 12201970778325354639u, 14364241749u },
+  { 7749044514582753622u, 5962901664714590312u, 28501661470161u },
+  { 16046363919143359747u, 17709787216684510208u, 19921323249546u },
+  { 1501789878147340744u, 13452620919219502523u, 20362960049488u },
+  { 7843636575157030051u, 5756978213092707936u, 5456729268041u },
+  { 13809245118916781933u, 5152942295039859366u, 24393312086414u },
+  { 16892073691720321180u, 10122334157725088101u, 10638279341561u },
+  { 13234069880921917526u, 4085740950798761405u, 30201548732834u },
+  { 14499624101407687609u, 13898706330999069005u, 31138221488460u },
+  { 10117481069208881133u, 17346603404790763733u, 31052753450379u },
+  { 14127654006175893200u, 15420181344148983283u, 13707940361254u },
+  { 5183021788509873655u, 12402459545720708378u, 29734835929705u },
+  { 2898084692608735440u, 3351749815097216910u, 17001672338679u },
+  { 18237720583644945313u, 10289861656046422349u, 27895181698721u },
+  { 16575738409901084756u, 1900772343313507725u, 26273557814518u },
+  { 13434926863032519279u, 3708596289617945379u, 7414103041075u },
+  { 11145264948903959110u, 12982317994405313132u, 25651201043407u },
+  { 9710566261937043246u, 12388738592817831335u, 27599703772868u },
+  { 15916391452861703072u, 15392059042477910627u, 3780671594864u },
+  { 10443045583647548518u, 11879430059480439037u, 24944834405192u },
+  { 8444757770111935125u, 16950987214192896747u, 25416643985193u },
+  { 432764384731746591u, 3137742590997480708u, 16169918914858u },
+  { 5626729472616433729u, 12783376129100816748u, 24874170097366u },
+  { 16785572415011748292u, 10026214661449681487u, 7894692988208u },
+  { 17310879109206812492u, 16371264938211346743u, 1328543522185u },
+  { 16450769346949111616u, 11385800513880235836u, 23945887488050u },
+  { 4630289419283684732u, 11654214312702319081u, 6194617225482u },
+  { 7031913334409426373u, 15166464962270982124u, 4362631776223u },
+  { 12817247434910549563u, 940306969586098577u, 2015822175713u },
+  { 13110356429735098430u, 17735169426864510903u, 24033050974142u },
+  { 2931275513436390359u, 1849287261194618870u, 22462961425461u },
+  { 18281919528013236352u, 5660359676953152955u, 7221100250063u },
+  { 8741099151812846931u, 17341743980523946251u, 975306848712u },
+  { 9506242504662899719u, 16944701169256572350u, 31176940097824u },
+  { 14507957361236648193u, 18285928050540104998u, 4384918574090u },
+  { 8651375583886442497u, 16887262565889781624u, 5130991282145u },
+  { 2801811727413411841u, 1172138588257185802u, 10209915460338u },
+  { 1620532701704486913u, 3544111163660402358u, 23282063541760u },
+  { 14546925863569457153u, 2924489059394131237u, 1536192126651u },
+  { 3936146074321813505u, 10703913709194060127u, 7867158536869u },
+  { 4611686018427387905u, 16238275824618495322u, 8869580260324u },
+  { 1u, 5967723342972827264u, 17380880278696u },
+  { 1u, 12215061670824837120u, 25768323510930u },
+  { 1u, 509779498636410880u, 29330662179820u },
+  { 1u, 18363888605471965184u, 17388027635201u },
+  { 1u, 1230863684876632064u, 26113995508396u },
+  { 1u, 1085367510196289536u, 2732066725254u },
+  { 1u, 11529215046068469760u, 23942058837890u },
+  { 1u, 0u, 1922625000000u },
+  { 1u, 0u, 21056000000000u },
+  { 11288525524787440470u, 4043174u, 0u },
+  { 16724382638987183835u, 4043174611952194u, 0u },
+  { 9840192900738266732u, 17245876535383435719u, 219180u },
+  { 605852390917015653u, 5607353997711680486u, 22572934900840u },
+  { 17005837041033255216u, 5731663705689858619u, 11368303975269u },
+  { 4448171972453463616u, 1535932743638283281u, 23397310714112u },
+  { 14871005653973361024u, 16089478988273998605u, 20736083263080u },
+  { 15755491058760640853u, 12217781466762265583u, 32360872212403u },
+  { 13359341622253734583u, 8500980226200254721u, 30643662327260u },
+  { 9060599961220057357u, 8764630168275738784u, 3548460839061u },
+  { 1823334670860567834u, 8740573054247436460u, 28821475131553u },
+  { 10436402092010471408u, 13081814230790042146u, 161473827414u },
+  { 1005362712726180798u, 8369612250809081371u, 4694709166570u },
+  { 15932125718412728126u, 4785545325571926997u, 25066453717589u },
+  { 14955935633807005681u, 17075167655841943769u, 21077259424931u },
+  { 5282156223506826493u, 7395349073947557007u, 5283925646693u },
+  { 11929443913670263796u, 11310256517671821846u, 23909400902676u },
+  { 7143758434654811753u, 7220171216293538306u, 31764613130234u },
+  { 13433281851786247945u, 16991998013543989680u, 26618391406265u },
+  { 6748510738120245927u, 1064164449115217940u, 9913921138058u },
+  { 3054527837147143651u, 7021346683252769980u, 28042057688470u },
+  { 15635812829529961095u, 7154149273795493229u, 9622380627966u },
+  { 16927752481179639230u, 4551427549972899367u, 18430387827209u },
+  { 14196478528839106401u, 16224828485707961604u, 12809246733381u },
+  { 2408385757814507143u, 11445530561848554819u, 29765879549714u },
+  { 9966440627902970975u, 373951756966365573u, 20242620463455u },
+  { 664263613113251329u, 6740168123015036389u, 14687020271965u },
+  { 11474296969452562122u, 1743629739274152266u, 18781365385246u },
+  { 1867094173131328424u, 10451343714464543973u, 14366094522357u },
+  { 17288300368050767055u, 567403499961654929u, 30709566568478u },
+  { 16253968105831801890u, 6764702463232898560u, 30750030759005u },
+  { 10932406668628463903u, 6322761544084027296u, 1117366715255u },
+  { 573690730251060526u, 2032559024711881513u, 887342757590u },
+  { 14824721558373855106u, 9497896509381993916u, 30422110185245u },
+  { 75287197369877062u, 8775528487944786150u, 10013514882001u },
+  { 2719756278727513895u, 10457616890375160495u, 23505475722352u },
+  { 5559352163896558855u, 10667617688499376331u, 23664566908547u },
+  { 12643987963357802507u, 12097207753271198876u, 13955578292713u },
+  { 17296680071123952641u, 6553318293192963224u, 27113655790946u },
+  { 9130510021906923521u, 9655771679927003769u, 28002355256096u },
+  { 1523846017408040961u, 11437780302799179444u, 6944523440431u },
+  { 2404700786861801473u, 11719936934063015666u, 20783620043312u },
+  { 15950131399030210561u, 4892282871656747826u, 12848635339054u },
+  { 13150510911921848321u, 16476510296966633395u, 24878265211185u },
+  { 1u, 17479219490827736833u, 6449893193412u },
+  { 1u, 4894294673662724608u, 14020947550387u },
+  { 1u, 16573808314402734080u, 8371265320245u },
+  { 1u, 769008417862844416u, 13621898467949u },
+  { 1u, 15962462490655195136u, 23149041688029u },
+  { 1u, 9764542863953100800u, 7645865326825u },
+  { 1u, 5926737109619572736u, 14569529336929u },
+  { 1u, 9223372036854775808u, 25697321289062u },
+  { 1u, 0u, 1382500000000u },
+  { 1u, 0u, 24832000000000u },
+  { 11692162776434117771u, 61693948546u, 0u },
+  { 3010525025348272596u, 6353716325505178566u, 3u },
+  { 11810136317399540463u, 3199893096678587256u, 3344435652u },
+  { 11690196746250494712u, 6585757488346680740u, 2500173466552u },
+  { 8363533856721563120u, 15060060590400687987u, 3000357014628u },
+  { 15784499182541877737u, 9108775752322835758u, 19556816407520u },
+  { 4895371729689660230u, 17848796176749620663u, 19424493787722u },
+  { 4107768182514430855u, 10222174968888279369u, 23114967585179u },
+  { 6962703277698374769u, 8112524041420765119u, 4507554145215u },
+  { 48441517873365837u, 9268822878665711557u, 25535439780809u },
+  { 17447667153244816238u, 1321443153323721699u, 15305502463895u },
+  { 11392715022981366392u, 16278951513231949115u, 6039071635576u },
+  { 16993731873898089180u, 15156093142611944254u, 14456882483729u },
+  { 15049287839302291629u, 10710664885198638770u, 21009821613455u },
+  { 8975473181680297535u, 15953270099101413032u, 15759580626306u },
+  { 2456332675645495876u, 18164315777910498912u, 32130864828504u },
+  { 3027090904649462477u, 7492411101153825965u, 20568984689531u },
+  { 13956860220835360620u, 12013892758300947822u, 7035406164419u },
+  { 11534947519704521874u, 7893137534781072412u, 8643651274431u },
+  { 341194280169267635u, 2708459363157906470u, 1727427887843u },
+  { 18261490647627015841u, 5187692984432080562u, 17123146825876u },
+  { 11972796431392165492u, 3605482425959710991u, 148281225400u },
+  { 1514551995774631147u, 17601722289882890307u, 28856195453593u },
+  { 3837948056500054181u, 5697791123513650396u, 4761954191277u },
+  { 686106594059113774u, 13357400725855159581u, 1965308877875u },
+  { 18295039197120862422u, 5286484384406465208u, 7219724106144u },
+  { 2975365587708731280u, 13267068157958454590u, 14752286580892u },
+  { 13034853186089916338u, 17867346571511469611u, 8348719209205u },
+  { 2202805491289448428u, 8655364191742991239u, 23285968590798u },
+  { 17726416149201027747u, 314510770153759796u, 22478469208233u },
+  { 17843428538929207223u, 249764782027045536u, 6313017049663u },
+  { 5992329533018995597u, 17786434792735767799u, 575013539775u },
+  { 16554332537606270195u, 2818553868203172642u, 20415964204562u },
+  { 1217661898041761630u, 6616203231522078789u, 19986152794111u },
+  { 14028472864469742898u, 15884355456305966063u, 10239358665095u },
+  { 15045203809143266907u, 13151518111780088493u, 391861092634u },
+  { 14167391459745979458u, 7631815632297368532u, 16666712945225u },
+  { 17625101068107122924u, 7881962293553284565u, 12873413721554u },
+  { 7672302760728807913u, 1954709573662094931u, 32210427282032u },
+  { 1059495064383852545u, 5850068967654547278u, 624105965018u },
+  { 9723871238268387329u, 3616569332824010958u, 17882317132874u },
+  { 1383411415246700545u, 7002609120920072660u, 5194196054616u },
+  { 1707909344575619073u, 1815483536402128067u, 29272379612201u },
+  { 1657606137849053185u, 13169917922061360607u, 23593098417559u },
+  { 14555633995661443073u, 2356301711054936512u, 5527713942681u },
+  { 1u, 13057595590875652964u, 3225127735371u },
+  { 1u, 6515875970012211200u, 20555707853675u },
+  { 1u, 2152119764801028096u, 11115353226344u },
+  { 1u, 4100957930797400064u, 15464116666646u },
+  { 1u, 16456524948219887616u, 16662222313374u },
+  { 1u, 389139155302481920u, 6046892110005u },
+  { 1u, 16212958658533785600u, 12469021095275u },
+  { 1u, 0u, 13675878906250u },
+  { 1u, 0u, 31114000000000u },
+  { 1u, 0u, 25600000000000u },
+  { 17474707912396435815u, 941374u, 0u },
+  { 2001333021379093327u, 941374947305814u, 0u },
+  { 8897041272249281419u, 703736268270424768u, 51032u },
+  { 14818147052202024625u, 10067897457671075269u, 18264038149619u },
+  { 5725047168716969176u, 14728126479696181937u, 3571545781814u },
+  { 16514377735957671131u, 5467508936515604452u, 13878798413336u },
+  { 17129234405171576741u, 6506284962705983362u, 28184296394253u },
+  { 13927726002188184173u, 10492135734901312633u, 3597352706414u },
+  { 8628721653485778857u, 16410959354454489267u, 8558568779817u },
+  { 2289236724746668346u, 4308115949569753314u, 12329889639889u },
+  { 9503705868954602601u, 10923219584832762043u, 11729233543433u },
+  { 9023980117402305552u, 4069250660416542207u, 265592148920u },
+  { 7151412562080974830u, 5913739049342446622u, 5048220594520u },
+  { 14894196551576332345u, 4435927589759430275u, 12632320584436u },
+  { 17197132131966254362u, 9044034429296676556u, 10996240472116u },
+  { 16600305707149813257u, 15013026523302468192u, 22580490278088u },
+  { 10713265278325865075u, 11203662823134802807u, 5320813857798u },
+  { 8461913714661825196u, 11656343578020394026u, 19462607351778u },
+  { 11825502730899130051u, 9709599761354763245u, 12258631891651u },
+  { 10675225172939889891u, 14043109390881445275u, 15043526358457u },
+  { 3941491272136364270u, 9265109491320923356u, 30137761278485u },
+  { 76462409063822642u, 17345668980113271614u, 10773502262591u },
+  { 9242253970523817474u, 10563742981941767051u, 32063940310599u },
+  { 12455889231839776279u, 9776557307484090727u, 13895572661654u },
+  { 4980147232097429747u, 11255543711489100580u, 9622529988233u },
+  { 7690175523879120957u, 4152399521785701170u, 22153610164247u },
+  { 9024696103772939341u, 2349955544975056386u, 30743225102029u },
+  { 1597569388908200003u, 6554417466780066236u, 28365127391345u },
+  { 1983587773024330135u, 15550498633733362298u, 6257355315682u },
+  { 11832352604653990369u, 1776956327027870988u, 23010842994220u },
+  { 18059706774867916274u, 9385223959571527199u, 26156096328995u },
+  { 18228129452497709230u, 5746583049004718505u, 5411508774010u },
+  { 11755210576458677687u, 5625601892258107021u, 25722311522891u },
+  { 4631126371866474831u, 12105495278644687018u, 14923304964489u },
+  { 12389335157427831789u, 110299091923168039u, 4489656240214u },
+  { 12298715729010018647u, 13914634674955288004u, 2134005979325u },
+  { 11228815948179339280u, 3623543827461171803u, 6333754313857u },
+  { 5032197096355800803u, 9066429269050265668u, 3201196432704u },
+  { 3914589571164542590u, 9399042248823288111u, 7488491492115u },
+  { 16090814685253061090u, 5033424798508329109u, 4883509523101u },
+  { 17351954788805195425u, 1462036213503726731u, 12957272862505u },
+  { 17425573967386263553u, 17462814406464561497u, 28457079257141u },
+  { 11295898351003762689u, 15864238864469611217u, 14389946661065u },
+  { 11375836476823568385u, 1555913153279338884u, 14537860002112u },
+  { 1855705147825455105u, 907792754202642195u, 12608084346221u },
+  { 11773535325853319169u, 15009289426239094489u, 1389049211543u },
+  { 16717361816799281153u, 3128693790515925268u, 27287813655210u },
+  { 1u, 4352761878595112720u, 2730169606830u },
+  { 1u, 4689998637604970496u, 8878235963694u },
+  { 1u, 10925420852690288640u, 20782254245335u },
+  { 1u, 3509717422397456384u, 17879592268251u },
+  { 1u, 13072789733489246208u, 29147190262162u },
+  { 1u, 8757812425375350784u, 31122708677351u },
+  { 1u, 16429131440647569408u, 17127474761962u },
+  { 1u, 0u, 4330890625000u },
+  { 1u, 0u, 32744000000000u },
+  { 1u, 0u, 4096000000000u },
+  { 12201970778325354640u, 14364241749u, 0u },
+  { 5962901664714590313u, 14364241749661470161u, 0u },
+  { 17709787216684510209u, 10228672802612137866u, 778687105u },
+  { 13452620919219502524u, 13129906497020499280u, 21121554497463u },
+  { 5756978213092707937u, 7933174171178688329u, 16311711773657u },
+  { 5152942295039859367u, 10235936806112831886u, 13273430058233u },
+  { 10122334157725088102u, 2409022947975788025u, 25849554891246u },
+  { 4085740950798761406u, 12693927436087556514u, 29166130593395u },
+  { 13898706330999069006u, 3301485738471815500u, 32371688139185u },
+  { 17346603404790763734u, 9298129580786627979u, 27057178973900u },
+  { 15420181344148983284u, 10644319811127637030u, 5836504052614u },
+  { 12402459545720708379u, 3555682142305731177u, 13190577029733u },
+  { 3351749815097216911u, 3095166530793762039u, 613192753915u },
+  { 10289861656046422350u, 15579215011995018913u, 25339167789313u },
+  { 1900772343313507726u, 1497675956705598710u, 20737844550938u },
+  { 3708596289617945380u, 5478236951070532659u, 7450081189176u },
+  { 12982317994405313133u, 3450498126207118287u, 23864296975820u },
+  { 12388738592817831336u, 4234376231393038020u, 11724187051878u },
+  { 15392059042477910628u, 8483025653973016944u, 10086229545995u },
+  { 11879430059480439038u, 3032471298455266120u, 5131459865742u },
+  { 16950987214192896748u, 9025196852177878825u, 11406164390598u },
+  { 3137742590997480709u, 13134628028175212842u, 29382489256901u },
+  { 12783376129100816749u, 2708501404335644374u, 13253712029612u },
+  { 10026214661449681488u, 6235686905038439728u, 10156146828155u },
+  { 16371264938211346744u, 8653448569604103561u, 9083338037264u },
+  { 11385800513880235837u, 17207445608728500274u, 6160469104386u },
+  { 11654214312702319082u, 10984660978606903562u, 5890932817495u },
+  { 15166464962270982125u, 15700348532745439199u, 15959595479664u },
+  { 940306969586098578u, 7362286605045685729u, 29296851117599u },
+  { 17735169426864510904u, 10746576342988838846u, 26143399110356u },
+  { 1849287261194618871u, 16463559073704844341u, 26324582573070u },
+  { 5660359676953152956u, 13423908954180518863u, 9230892491325u },
+  { 17341743980523946252u, 10487097922507864520u, 25149727711562u },
+  { 16944701169256572351u, 9824041320185893152u, 8522568506717u },
+  { 18285928050540104999u, 1782793347983971338u, 7517532562347u },
+  { 16887262565889781625u, 901056691341731809u, 9131096645421u },
+  { 1172138588257185803u, 2107822968341158642u, 7981048846381u },
+  { 3544111163660402359u, 1374585729281197568u, 22573114265312u },
+  { 2924489059394131238u, 12870520114062007995u, 3808074516441u },
+  { 10703913709194060128u, 8009955721157321381u, 18393697712293u },
+  { 16238275824618495323u, 13273781938145870820u, 30885434220569u },
+  { 5967723342972827265u, 13315415842372052136u, 24601719573160u },
+  { 12215061670824837121u, 3548860247718556306u, 2728721830139u },
+  { 509779498636410881u, 9614354631324025836u, 20731192384099u },
+  { 18363888605471965185u, 16904208749939779073u, 6755521195208u },
+  { 1230863684876632065u, 9991846463353457324u, 27848916378992u },
+  { 1085367510196289537u, 2499001261112548742u, 9584541659082u },
+  { 11529215046068469761u, 15073056566555543426u, 28618135471129u },
+  { 1u, 14256029854156804672u, 1049817112033u },
+  { 1u, 17427576737078083584u, 24033772820926u },
+  { 1u, 17983635736984813568u, 22974944750827u },
+  { 1u, 14044327596590628864u, 11499974894846u },
+  { 1u, 10442409374663049216u, 9470761344524u },
+  { 1u, 9216616637413720064u, 7692566084146u },
+  { 1u, 1152921504606846976u, 14898499633789u },
+  { 1u, 0u, 17021062500000u },
+  { 1u, 0u, 20128000000000u },
+  { 1u, 0u, 16384000000000u },
+  { 17245876535383435720u, 219180u, 0u },
+  { 5607353997711680487u, 219180934900840u, 0u },
+  { 5731663705689858620u, 15168561097121225573u, 11881u },
+  { 1535932743638283282u, 13814710728455934208u, 11881822289344u },
+  { 16089478988273998606u, 3736138416511811176u, 32192748896969u },
+  { 12217781466762265584u, 7276002860994328499u, 17097202536469u },
+  { 8500980226200254722u, 8209535929516002780u, 4117394432905u },
+  { 8764630168275738785u, 9111820165061767317u, 9097445039834u },
+  { 8740573054247436461u, 16839290858389471393u, 24282493952760u },
+  { 13081814230790042147u, 10866201879136113238u, 8952912859786u },
+  { 8369612250809081372u, 3712817362244264426u, 21130589057984u },
+  { 4785545325571926998u, 9395970452982190677u, 13248201272232u },
+  { 17075167655841943770u, 16355713700219294883u, 11176509356578u },
+  { 7395349073947557008u, 5837184312004500837u, 14882886645016u },
+  { 11310256517671821847u, 11320383466070670356u, 29976316434395u },
+  { 7220171216293538307u, 6717202435485165562u, 22491613679217u },
+  { 16991998013543989681u, 12523437314233575097u, 20081364140273u },
+  { 1064164449115217941u, 2839021226557402506u, 241678896897u },
+  { 7021346683252769981u, 1444377546201441686u, 20225153903649u },
+  { 7154149273795493230u, 12433921893056399358u, 11297078299863u },
+  { 4551427549972899368u, 8270435479287509513u, 19671674044256u },
+  { 16224828485707961605u, 12953960321719596101u, 16224448341205u },
+  { 11445530561848554820u, 2858701191925026578u, 25813702235596u },
+  { 373951756966365574u, 2556732362494032223u, 21964154970502u },
+  { 6740168123015036390u, 1734017897684027741u, 8582138600739u },
+  { 1743629739274152267u, 10881522214463387678u, 7459094001298u },
+  { 10451343714464543974u, 4492226765950154741u, 30354589888501u },
+  { 567403499961654930u, 17469702522876622878u, 12277243524100u },
+  { 6764702463232898561u, 7358712655725003869u, 13316947034471u },
+  { 6322761544084027297u, 7409711266672870263u, 16743398916612u },
+  { 2032559024711881514u, 11821637285869254358u, 16900401681252u },
+  { 9497896509381993917u, 7079019021891413789u, 21348640852241u },
+  { 8775528487944786151u, 2398889771943287761u, 2321383754390u },
+  { 10457616890375160496u, 2115997302908247152u, 2710130044075u },
+  { 10667617688499376332u, 11793547252467414659u, 11435114708443u },
+  { 12097207753271198877u, 11469837575016507881u, 15835639329477u },
+  { 6553318293192963225u, 15577138848970468706u, 12997621781140u },
+  { 9655771679927003770u, 1071877685827869472u, 4756844438389u },
+  { 11437780302799179445u, 14400737672045416751u, 25461058106605u },
+  { 11719936934063015667u, 8693476877933359664u, 29933780665553u },
+  { 4892282871656747827u, 16148140480752279854u, 1233471274325u },
+  { 16476510296966633396u, 9991438950443063601u, 32085875392449u },
+  { 17479219490827736834u, 15058683930353317572u, 32705541636990u },
+  { 4894294673662724609u, 11124882207944548531u, 894816332891u },
+  { 16573808314402734081u, 17062145126048707893u, 11355603081072u },
+  { 769008417862844417u, 11921180677127232109u, 6000924940740u },
+  { 15962462490655195137u, 8055289015238663645u, 22980646248499u },
+  { 9764542863953100801u, 9518869284014930153u, 8243436678092u },
+  { 5926737109619572737u, 15988277681894384737u, 27596516018937u },
+  { 9223372036854775809u, 15690244075522688358u, 19193866726269u },
+  { 1u, 12460327202554896640u, 11133850569835u },
+  { 1u, 2665782328882233344u, 19563675475691u },
+  { 1u, 11388636896235094016u, 24299144512349u },
+  { 1u, 4193554837444493312u, 861617379243u },
+  { 1u, 4791003170778120192u, 22443227333063u },
+  { 1u, 5665528331232083968u, 16839259720802u },
+  { 1u, 4611686018427387904u, 3170307128906u },
+  { 1u, 0u, 15946250000000u },
+  { 1u, 0u, 5760000000000u },
+  { 3199893096678587257u, 3344435652u, 0u },
+  { 6585757488346680741u, 3344435652173466552u, 0u },
+  { 15060060590400687988u, 18284825282881178724u, 181302219u },
+  { 9108775752322835759u, 14035806722624867296u, 29643991222364u },
+  { 17848796176749620664u, 1158943502110644810u, 2140760882607u },
+  { 10222174968888279370u, 2560703130713887131u, 15791062826453u },
+  { 8112524041420765120u, 16058286456684798911u, 15829138815994u },
+  { 9268822878665711558u, 2520020938700962761u, 15354870521453u },
+  { 1321443153323721700u, 15171104099833321367u, 24173136610608u },
+  { 16278951513231949116u, 3729037144559728760u, 1328822427201u },
+  { 15156093142611944255u, 12369279747704246801u, 7745202151508u },
+  { 10710664885198638771u, 13412532208648076687u, 24660670539998u },
+  { 15953270099101413033u, 17660955007097535874u, 26846727094827u },
+  { 18164315777910498913u, 6330826436542779480u, 16939957402289u },
+  { 7492411101153825966u, 14875773540556512123u, 15025343194788u },
+  { 12013892758300947823u, 9291398598730359235u, 26276806417299u },
+  { 7893137534781072413u, 5692874723999057599u, 23443503687727u },
+  { 2708459363157906471u, 3179844851352584931u, 10287308611357u },
+  { 5187692984432080563u, 14760456030321475732u, 7965172379734u },
+  { 3605482425959710992u, 13790148255838892216u, 12374800165924u },
+  { 17601722289882890308u, 16489283272435012249u, 27684747565434u },
+  { 5697791123513650397u, 6182360008791328685u, 22906893885837u },
+  { 13357400725855159582u, 11639029299625434163u, 24973335146407u },
+  { 5286484384406465209u, 11322920347152890272u, 12199630953042u },
+  { 13267068157958454591u, 17767429518782177436u, 23122613816741u },
+  { 17867346571511469612u, 3455736835017366261u, 19877963174284u },
+  { 8655364191742991240u, 3748387356384876494u, 4492187335869u },
+  { 314510770153759797u, 13936219856965474473u, 31933203200485u },
+  { 249764782027045537u, 4757040169631318591u, 14821755483992u },
+  { 17786434792735767800u, 6009108186688802751u, 30552257879664u },
+  { 2818553868203172643u, 9876783475058232850u, 24176325754407u },
+  { 6616203231522078790u, 762833791038892031u, 32295535421505u },
+  { 15884355456305966064u, 12442070683097629063u, 10305041353302u },
+  { 13151518111780088494u, 4457336211463061786u, 19030674486003u },
+  { 7631815632297368533u, 3658505288140534345u, 13043241632680u },
+  { 7881962293553284566u, 1338932677511773650u, 17320198327969u },
+  { 1954709573662094932u, 16390022774440297072u, 20129072583685u },
+  { 5850068967654547279u, 17648982252553323994u, 5125888504914u },
+  { 3616569332824010959u, 347191298214138954u, 29778956753245u },
+  { 7002609120920072661u, 18254743065685520984u, 6493018821277u },
+  { 1815483536402128068u, 9205791570581380137u, 4765989591604u },
+  { 13169917922061360608u, 251868406460978583u, 23092499046961u },
+  { 2356301711054936513u, 12419690149635230873u, 25137013653813u },
+  { 13057595590875652965u, 1689110207937368139u, 309673272752u },
+  { 6515875970012211201u, 15691848904446978923u, 9648091566847u },
+  { 2152119764801028097u, 11543693183836634216u, 4863850656833u },
+  { 4100957930797400065u, 7767728703725781270u, 13377625784861u },
+  { 16456524948219887617u, 14625965226619017118u, 541421089416u },
+  { 389139155302481921u, 12357272366699196597u, 12936792875163u },
+  { 16212958658533785601u, 5506685098894996843u, 8347669889077u },
+  { 1u, 6839601135702473098u, 53298517997u },
+  { 1u, 9465895768610759680u, 22509370775520u },
+  { 1u, 15540578927740715008u, 6112513147237u },
+  { 1u, 13963202274592292864u, 16741842456471u },
+  { 1u, 892362125274513408u, 3991756946712u },
+  { 1u, 13711842384227074048u, 15640048375047u },
+  { 1u, 1621295865853378560u, 5383743320465u },
+  { 1u, 0u, 12689087890625u },
+  { 1u, 0u, 1217000000000u },
+  { 1u, 0u, 18944000000000u },
+  { 703736268270424769u, 51032u, 0u },
+  { 10067897457671075270u, 51032038149619u, 0u },
+  { 14728126479696181938u, 8344041738926011958u, 2766u },
+  { 5467508936515604453u, 602570619574906392u, 2766452331409u },
+  { 6506284962705983363u, 13668161078167178765u, 5009032665418u },
+  { 10492135734901312634u, 13678878516436672878u, 22858740952496u },
+  { 16410959354454489268u, 4322011822421159977u, 28080741533490u },
+  { 4308115949569753315u, 6804133064494624209u, 18226234296730u },
+  { 10923219584832762044u, 9597402298603831561u, 2458368852792u },
+  { 4069250660416542208u, 2180080595215225784u, 17208520276221u },
+  { 5913739049342446623u, 16164733702770078040u, 30973118182405u },
+  { 4435927589759430276u, 16780053920628812532u, 29701876291969u },
+  { 9044034429296676557u, 13991546152143673396u, 6529909648545u },
+  { 15013026523302468193u, 13452630162677568712u, 27809758483236u },
+  { 11203662823134802808u, 7396263474339793926u, 4900729268542u },
+  { 11656343578020394027u, 6598759654519222242u, 10558400952246u },
+  { 9709599761354763246u, 12118991988651866819u, 30646357719477u },
+  { 14043109390881445276u, 2241996710082213305u, 31157656971872u },
+  { 9265109491320923357u, 3483196588502690325u, 27232121538885u },
+  { 17345668980113271615u, 7792563676221177151u, 18757188824465u },
+  { 10563742981941767052u, 6447717423029532231u, 11665422435723u },
+  { 9776557307484090728u, 16252740965577270678u, 17803349531461u },
+  { 11255543711489100581u, 3433890838386267785u, 6981881062853u },
+  { 4152399521785701171u, 6508437185556936727u, 26053186151595u },
+  { 2349955544975056387u, 14818521258391695053u, 25771352823086u },
+  { 6554417466780066237u, 1264438325743687793u, 5422803313647u },
+  { 15550498633733362299u, 18211769664008149474u, 25583068545338u },
+  { 1776956327027870989u, 13395325316522534444u, 314987262011u },
+  { 9385223959571527200u, 8599696075136472355u, 12347726162040u },
+  { 5746583049004718506u, 6805030728671093882u, 26744466190458u },
+  { 5625601892258107022u, 18313757117481073227u, 12410368901454u },
+  { 12105495278644687019u, 12123983311777993097u, 16718992790762u },
+  { 110299091923168040u, 5356658657735837782u, 21738657242452u },
+  { 13914634674955288005u, 12894718171644893373u, 23892290385047u },
+  { 3623543827461171804u, 14098574457843813505u, 13463699024072u },
+  { 9066429269050265669u, 14889202273554865472u, 26824764285252u },
+  { 9399042248823288112u, 10666181384397132563u, 24900807145272u },
+  { 5033424798508329110u, 8382031158587273885u, 14136578214851u },
+  { 1462036213503726732u, 11050994358355849001u, 3011454390819u },
+  { 17462814406464561498u, 10564878846154881077u, 21027599075604u },
+  { 15864238864469611218u, 15723332668288973001u, 18708572723229u },
+  { 1555913153279338885u, 16298812369637421376u, 22557852363571u },
+  { 907792754202642196u, 87165277235807597u, 27443883560389u },
+  { 15009289426239094490u, 2715696349080775319u, 19909004725239u },
+  { 3128693790515925269u, 1369052250356353706u, 3063147218194u },
+  { 4352761878595112721u, 3765466906237739694u, 17682074216471u },
+  { 4689998637604970497u, 152396488534249774u, 10263204126370u },
+  { 10925420852690288641u, 3641383473247274455u, 24226008261430u },
+  { 3509717422397456385u, 11573032224471052763u, 25398197399793u },
+  { 13072789733489246209u, 15002199112022418u, 12529627375334u },
+  { 8757812425375350785u, 15559196651665933031u, 9958000813270u },
+  { 16429131440647569409u, 10943891532617126122u, 25814843465740u },
+  { 1u, 13935781752383635432u, 8204593269548u },
+  { 1u, 10346951730465148928u, 2860755460242u },
+  { 1u, 4402282252120096768u, 8338560909377u },
+  { 1u, 1515389025744060416u, 65238648199u },
+  { 1u, 12795032755347914752u, 17799082149403u },
+  { 1u, 9565927083511644160u, 1563693620115u },
+  { 1u, 5332261958806667264u, 7059518569946u },
+  { 1u, 0u, 15834289062500u },
+  { 1u, 0u, 16996000000000u },
+  { 1u, 0u, 26624000000000u },
+  { 10228672802612137867u, 778687105u, 0u },
+  { 13129906497020499281u, 778687105554497463u, 0u },
+  { 7933174171178688330u, 10633289389696431065u, 42212712u },
+  { 10235936806112831887u, 15657535614093714681u, 7528576431772u },
+  { 2409022947975788026u, 7904026069157114350u, 13980848796706u },
+  { 12693927436087556515u, 14353600911049916019u, 13346428478111u },
+  { 3301485738471815501u, 9915341352440752561u, 25247778110264u },
+  { 9298129580786627980u, 14067139880828966604u, 31544537511731u },
+  { 10644319811127637031u, 17941529755903865734u, 30515762581180u },
+  { 3555682142305731178u, 17583706974399791717u, 20156972612276u },
+  { 3095166530793762040u, 1838006166247105275u, 15028953214665u },
+  { 15579215011995018914u, 17051123158252802305u, 28361099638513u },
+  { 1497675956705598711u, 10602804693582978330u, 30449924343238u },
+  { 5478236951070532660u, 2971925662135311672u, 1478574779194u },
+  { 3450498126207118288u, 17849554862211182028u, 11066161108412u },
+  { 4234376231393038021u, 17993472807371089766u, 5564967626307u },
+  { 8483025653973016945u, 7665160775939462155u, 9795975428115u },
+  { 3032471298455266121u, 5279679287523781774u, 14355415529198u },
+  { 9025196852177878826u, 12506896545269969606u, 30446286211987u },
+  { 13134628028175212843u, 5011197394739901381u, 2963678000220u },
+  { 2708501404335644375u, 1965224809563170732u, 29788271657555u },
+  { 6235686905038439729u, 7333319965258687355u, 16979106535050u },
+  { 8653448569604103562u, 16477362972535232528u, 5770397540071u },
+  { 17207445608728500275u, 10749755473270052610u, 24295893239636u },
+  { 10984660978606903563u, 16424365659841183319u, 1876582745411u },
+  { 15700348532745439200u, 9312033069093679728u, 17731890366646u },
+  { 7362286605045685730u, 3475575933889898015u, 18614504806324u },
+  { 10746576342988838847u, 16751270034952971988u, 22452188411348u },
+  { 16463559073704844342u, 3493208297507693582u, 30164908088168u },
+  { 13423908954180518864u, 4705978106405544509u, 7016189367201u },
+  { 10487097922507864521u, 6118888041040191818u, 5025255111584u },
+  { 9824041320185893153u, 6725081879695531357u, 15264331705585u },
+  { 1782793347983971339u, 3789694369240163243u, 11505364567419u },
+  { 901056691341731810u, 7550499902460370733u, 1403205439743u },
+  { 2107822968341158643u, 16232326148146911277u, 20735409313419u },
+  { 1374585729281197569u, 13202465060648455904u, 22155879956163u },
+  { 12870520114062007996u, 847649054521149401u, 16067715707065u },
+  { 8009955721157321382u, 5918742960086808741u, 12473045951147u },
+  { 13273781938145870821u, 14489367108415512601u, 8875320855698u },
+  { 13315415842372052137u, 15572843005533588136u, 19602785470164u },
+  { 3548860247718556307u, 16948138522865225979u, 1748844205510u },
+  { 9614354631324025837u, 5603886641369029219u, 21958918760430u },
+  { 16904208749939779074u, 10085571328757263560u, 26606303787303u },
+  { 9991846463353457325u, 4977061428277323120u, 14631546739917u },
+  { 2499001261112548743u, 12112207179301482442u, 23757269807040u },
+  { 15073056566555543427u, 16042387148033000473u, 12224656604066u },
+  { 14256029854156804673u, 16372329058454330849u, 31650869659549u },
+  { 17427576737078083585u, 12750148610520111550u, 18333887545736u },
+  { 17983635736984813569u, 2802928047000104171u, 16776691186941u },
+  { 14044327596590628865u, 16489604500163339518u, 31997151947033u },
+  { 10442409374663049217u, 2309387699466640908u, 10521893903251u },
+  { 9216616637413720065u, 805231076546656818u, 7059125192158u },
+  { 1152921504606846977u, 2347096237767344765u, 17886043651664u },
+  { 1u, 18363046982471328u, 15952127236342u },
+  { 1u, 14233368270329233408u, 6390000995462u },
+  { 1u, 440140625304616960u, 19590771592440u },
+  { 1u, 1987077825064075264u, 19704023860071u },
+  { 1u, 13680328181951758336u, 17255107719704u },
+  { 1u, 14007320741029085184u, 29208741612076u },
+  { 1u, 16717361816799281152u, 2604759338378u },
+  { 1u, 0u, 19850906250000u },
+  { 1u, 0u, 11024000000000u },
+  { 1u, 0u, 8192000000000u },
+  { 15168561097121225574u, 11881u, 0u },
+  { 13814710728455934209u, 11881822289344u, 0u },
+  { 3736138416511811177u, 2119105875797656265u, 644u },
+  { 7276002860994328500u, 13158631126302920725u, 644114876959u },
+  { 8209535929516002781u, 12980057681901724553u, 2591713330822u },
+  { 9111820165061767318u, 16329989792437296858u, 1670703650336u },
+  { 16839290858389471394u, 8878997961463112440u, 5664885250520u },
+  { 10866201879136113239u, 17812795598700597898u, 6616481331443u },
+  { 3712817362244264427u, 5673683396597986240u, 30963965633584u },
+  { 9395970452982190678u, 4230274256083397544u, 9264307570993u },
+  { 16355713700219294884u, 17206311897094076962u, 2353229323626u },
+  { 5837184312004500838u, 17794263782209090840u, 23914932756036u },
+  { 11320383466070670357u, 9639553838393415643u, 24132964628972u },
+  { 6717202435485165563u, 12338219477121683057u, 14828522561260u },
+  { 12523437314233575098u, 1566399133010591985u, 24300668856218u },
+  { 2839021226557402507u, 2757321955486945025u, 10138084914667u },
+  { 1444377546201441687u, 13264062288607652897u, 13803149474722u },
+  { 12433921893056399359u, 8569867702445198551u, 15266719046257u },
+  { 8270435479287509514u, 834201196089884512u, 6769464573459u },
+  { 12953960321719596102u, 8384653071061017813u, 32275045222137u },
+  { 2858701191925026579u, 14002565653375833548u, 1785454532953u },
+  { 2556732362494032224u, 1624222513202962822u, 6489759080605u },
+  { 1734017897684027742u, 16062058020646067491u, 24733088049278u },
+  { 10881522214463387679u, 528211084560430738u, 26750870725910u },
+  { 4492226765950154742u, 4991083427987730421u, 9494028634380u },
+  { 17469702522876622879u, 14462889343695270916u, 18700270567174u },
+  { 7358712655725003870u, 6319729210187694439u, 32518784034802u },
+  { 7409711266672870264u, 17714038838450995716u, 10226342593206u },
+  { 11821637285869254359u, 11198253775585301348u, 694960279969u },
+  { 7079019021891413790u, 10637855602353080593u, 20897607058553u },
+  { 2398889771943287762u, 13519899448188144278u, 1145576679307u },
+  { 2115997302908247153u, 12461844260516703403u, 26507732915217u },
+  { 11793547252467414660u, 394967218472041947u, 5137675557931u },
+  { 11469837575016507882u, 15059870890435556037u, 7211021411215u },
+  { 15577138848970468707u, 15459697831520047764u, 9103816397236u },
+  { 1071877685827869473u, 13746031941294351221u, 4532838071898u },
+  { 14400737672045416752u, 12734222355464910061u, 32346745173884u },
+  { 8693476877933359665u, 2498180731157415121u, 30588690323577u },
+  { 16148140480752279855u, 14741065620533411157u, 22649135426648u },
+  { 9991438950443063602u, 9715627918871527361u, 27736799114768u },
+  { 15058683930353317573u, 15404258183538082686u, 30224526685244u },
+  { 11124882207944548532u, 7489008738887904347u, 13372835066509u },
+  { 17062145126048707894u, 4118414277859088240u, 29325405979977u },
+  { 11921180677127232110u, 6687076965645539780u, 1353223259685u },
+  { 8055289015238663646u, 12664306969780265011u, 17957362507168u },
+  { 9518869284014930154u, 8908927800293813196u, 7584686533456u },
+  { 15988277681894384738u, 14383902606806797049u, 27472482953943u },
+  { 15690244075522688359u, 13945590797980904317u, 27351779752922u },
+  { 12460327202554896641u, 18229769635953462379u, 15322755991991u },
+  { 2665782328882233345u, 2961649841369603819u, 2487988237792u },
+  { 11388636896235094017u, 11210339135915066205u, 13792160551359u },
+  { 4193554837444493313u, 5034473720297936811u, 4543607713702u },
+  { 4791003170778120193u, 4490124642334785991u, 12198272919367u },
+  { 5665528331232083969u, 11021997418233728098u, 26439243410144u },
+  { 4611686018427387905u, 5514311977725836874u, 10976597503677u },
+  { 1u, 5546189657119725184u, 28349298931451u },
+  { 1u, 14080253080398528512u, 30459300659543u },
+  { 1u, 17444901901861650432u, 16727763292048u },
+  { 1u, 733174574107066368u, 3984945690027u },
+  { 1u, 5587533374404165632u, 13739039745473u },
+  { 1u, 3102980143258271744u, 26049302900791u },
+  { 1u, 11529215046068469760u, 12343168212890u },
+  { 1u, 0u, 8090625000000u },
+  { 1u, 0u, 16960000000000u },
+  { 18284825282881178725u, 181302219u, 0u },
+  { 14035806722624867297u, 181302219991222364u, 0u },
+  { 1158943502110644811u, 729502449434017199u, 9828413u },
+  { 2560703130713887132u, 470261271068982741u, 30781039546407u },
+  { 16058286456684798912u, 10817895480813566970u, 4135025492914u },
+  { 2520020938700962762u, 1862373928674680429u, 17330586439289u },
+  { 15171104099833321368u, 17938953542437471536u, 20089100959492u },
+  { 3729037144559728761u, 2607670757785673281u, 32516972472620u },
+  { 12369279747704246802u, 662375169062723668u, 26924141362115u },
+  { 13412532208648076688u, 15954827177397184734u, 15299035907429u },
+  { 17660955007097535875u, 6792825656899125803u, 17765864912914u },
+  { 6330826436542779481u, 13397230079439059633u, 14354368239816u },
+  { 14875773540556512124u, 16063402237212124836u, 6344726265297u },
+  { 9291398598730359236u, 2853617215246588819u, 15825870798780u },
+  { 5692874723999057600u, 3885241176931280943u, 16316154694899u },
+  { 3179844851352584932u, 4297199387993448221u, 19699210619346u },
+  { 14760456030321475733u, 11128806920012771414u, 2514232951645u },
+  { 13790148255838892217u, 18307989639091285028u, 17245603293831u },
+  { 16489283272435012250u, 502560773081094522u, 27271992478107u },
+  { 6182360008791328686u, 1826704786071085453u, 2459027243874u },
+  { 11639029299625434164u, 16185117419508150183u, 866099025864u },
+  { 11322920347152890273u, 7529700714565294674u, 22472877396973u },
+  { 17767429518782177437u, 11895703525607263653u, 21485408185893u },
+  { 3455736835017366262u, 5263658222378488204u, 28197644867380u },
+  { 3748387356384876495u, 18376596015709617341u, 5940285343483u },
+  { 13936219856965474474u, 2878459543258118629u, 1787996197266u },
+  { 4757040169631318592u, 9418985965474051928u, 20882156041604u },
+  { 6009108186688802752u, 5882153460114808432u, 13700510604252u },
+  { 9876783475058232851u, 322451169128414759u, 23516318872178u },
+  { 762833791038892032u, 16684635541817960513u, 12914017480112u },
+  { 12442070683097629064u, 1446127108015540822u, 11696904475905u },
+  { 4457336211463061787u, 11253094120636789491u, 5377078394707u },
+  { 3658505288140534346u, 11785868545245103016u, 32595610031454u },
+  { 1338932677511773651u, 1275880490720874145u, 21854638913214u },
+  { 16390022774440297073u, 18328171381339493381u, 14014069165619u },
+  { 17648982252553323995u, 8609950896438342738u, 20019993572161u },
+  { 347191298214138955u, 6375164866732464477u, 29505466746373u },
+  { 18254743065685520985u, 17030586921712390813u, 17925345598379u },
+  { 9205791570581380138u, 17730819981674666548u, 23467923229966u },
+  { 251868406460978584u, 3764118438901178929u, 19726961189677u },
+  { 12419690149635230874u, 8254367965244621109u, 9005204053269u },
+  { 1689110207937368140u, 380898485504255408u, 7445447470184u },
+  { 15691848904446978924u, 5054548193490113279u, 27752020648548u },
+  { 11543693183836634217u, 11358271502217065537u, 8804274007606u },
+  { 7767728703725781271u, 16956188536499995165u, 28214615733131u },
+  { 14625965226619017119u, 7698841568948925064u, 29579919196822u },
+  { 12357272366699196598u, 13536344422843785371u, 662417355037u },
+  { 5506685098894996844u, 9923678468143710261u, 12573733806701u },
+  { 6839601135702473099u, 13105520106838349805u, 25197537963687u },
+  { 9465895768610759681u, 10502283912251480032u, 11943710451668u },
+  { 15540578927740715009u, 12656880622743896421u, 26580569329951u },
+  { 13963202274592292865u, 7441985423117815703u, 4383686130873u },
+  { 892362125274513409u, 3089637526709812504u, 31929403430838u },
+  { 13711842384227074049u, 17202990293348455687u, 22454167489585u },
+  { 1621295865853378561u, 8573530943767949713u, 19505932575972u },
+  { 1u, 13931818819905619137u, 9444464772043u },
+  { 1u, 10345034532148365824u, 17355755245411u },
+  { 1u, 13090567929238650880u, 20323560805445u },
+  { 1u, 7332226927329017856u, 21573709641109u },
+  { 1u, 3474292985259098112u, 13717397480818u },
+  { 1u, 2277308483449651200u, 9586188341800u },
+  { 1u, 4773815605012725760u, 21032123453140u },
+  { 1u, 9223372036854775808u, 20180258789062u },
+  { 1u, 0u, 5830500000000u },
+  { 1u, 0u, 8448000000000u },
+  { 8344041738926011959u, 2766u, 0u },
+  { 602570619574906393u, 2766452331409u, 0u },
+  { 13668161078167178766u, 17887464426309474634u, 149u },
+  { 13678878516436672879u, 10387278241170877872u, 149969681389u },
+  { 4322011822421159978u, 14101498451235686194u, 15341563095481u },
+  { 6804133064494624210u, 14877951261566077338u, 10681764443762u },
+  { 9597402298603831562u, 18376086106286572344u, 30322806535353u },
+  { 2180080595215225785u, 16801844099710515453u, 13497996169623u },
+  { 16164733702770078041u, 13529667812594086917u, 20887910829793u },
+  { 16780053920628812533u, 14224018449462008193u, 20193733444761u },
+  { 13991546152143673397u, 4040395465998593185u, 1177771085585u },
+  { 13452630162677568713u, 1785881677760205604u, 3857219030277u },
+  { 7396263474339793927u, 13677958651367270718u, 3333096812839u },
+  { 6598759654519222243u, 4592589262754215862u, 12583741483624u },
+  { 12118991988651866820u, 14768206887153564085u, 27240248964762u },
+  { 2241996710082213306u, 9931065698364385888u, 30362800586099u },
+  { 3483196588502690326u, 4854205785492572485u, 32115538364150u },
+  { 7792563676221177152u, 16899755484483136913u, 1782263147022u },
+  { 6447717423029532232u, 9915526673055106443u, 27150916137580u },
+  { 16252740965577270679u, 243785203134438213u, 12908537521778u },
+  { 3433890838386267786u, 6325552641934517701u, 9842013215622u },
+  { 6508437185556936728u, 15270976805598127275u, 7046342908895u },
+  { 14818521258391695054u, 7936931432341214510u, 7135827841311u },
+  { 1264438325743687794u, 1672041678711809007u, 20767430261915u },
+  { 18211769664008149475u, 503276187984232762u, 15515090641561u },
+  { 13395325316522534445u, 15101176422333689915u, 25241027282656u },
+  { 8599696075136472356u, 3856350903256017016u, 1760818636414u },
+  { 6805030728671093883u, 6619255306866667642u, 9854209053201u },
+  { 18313757117481073228u, 3634972769455784270u, 21009358830549u },
+  { 12123983311777993098u, 12515757951796925674u, 15317197052268u },
+  { 5356658657735837783u, 1513513015921696084u, 22892678480598u },
+  { 12894718171644893374u, 18398220611328095383u, 726082047704u },
+  { 14098574457843813506u, 15374906015971502280u, 20184997369537u },
+  { 14889202273554865473u, 3944609792014410052u, 5825833475325u },
+  { 10666181384397132564u, 5635127224471631672u, 7421213837725u },
+  { 8382031158587273886u, 17528422602127248323u, 2461305480858u },
+  { 11050994358355849002u, 5045536234834448931u, 9882950217693u },
+  { 10564878846154881078u, 6605633144602413332u, 12253273519067u },
+  { 15723332668288973002u, 5552645941436405789u, 29659358092090u },
+  { 16298812369637421377u, 11758111638023498547u, 23354301009539u },
+  { 87165277235807598u, 2095707153270459845u, 20099637408509u },
+  { 2715696349080775320u, 7811499365723769847u, 29437113608512u },
+  { 1369052250356353707u, 2478182821245306130u, 10560423462229u },
+  { 3765466906237739695u, 17165080343238191127u, 1365134342559u },
+  { 152396488534249775u, 17549379103883452066u, 31135930520869u },
+  { 3641383473247274456u, 9409825946436756278u, 5413951353747u },
+  { 11573032224471052764u, 12762563467262079217u, 13203510107686u },
+  { 15002199112022419u, 16315848448349644518u, 7718691859951u },
+  { 15559196651665933032u, 12585227658077005014u, 28143884483916u },
+  { 10943891532617126123u, 7481765133104128012u, 15692682246558u },
+  { 13935781752383635433u, 10457269988449192748u, 14750405587300u },
+  { 10346951730465148929u, 18210700123935088786u, 29028566889741u },
+  { 4402282252120096769u, 15543658308043145281u, 29965987204031u },
+  { 1515389025744060417u, 5490431917541475719u, 19391842623405u },
+  { 12795032755347914753u, 11881752538610402843u, 8109297636910u },
+  { 9565927083511644161u, 14108582840352840595u, 5678644111095u },
+  { 5332261958806667265u, 5720573804390432218u, 9975764827808u },
+  { 1u, 6072459418793722468u, 16032310112927u },
+  { 1u, 13084476173298886656u, 12959329188684u },
+  { 1u, 11921644177106927616u, 31564709310874u },
+  { 1u, 15143388496003072000u, 12698646273625u },
+  { 1u, 5680237872666378240u, 24153820924735u },
+  { 1u, 1641139851711479808u, 2879307926312u },
+  { 1u, 11601272640106397696u, 19240088966369u },
+  { 1u, 0u, 5345628906250u },
+  { 1u, 0u, 25354000000000u },
+  { 1u, 0u, 25600000000000u },
+  { 10633289389696431066u, 42212712u, 0u },
+  { 15657535614093714682u, 42212712576431772u, 0u },
+  { 7904026069157114351u, 13541638151860565026u, 2288355u },
+  { 14353600911049916020u, 3006649398036849311u, 27363734093675u },
+  { 9915341352440752562u, 8535111263340493624u, 32619162990790u },
+  { 14067139880828966605u, 13022720194340190003u, 30918462689308u },
+  { 17941529755903865735u, 5879424214350450364u, 20508705963076u },
+  { 17583706974399791718u, 5684030651065514676u, 15428318724225u },
+  { 1838006166247105276u, 331513088885583561u, 129308131919u },
+  { 17051123158252802306u, 10309082673569920753u, 591017971360u },
+  { 10602804693582978331u, 10161555384623203782u, 3744558856491u },
+  { 2971925662135311673u, 3542008341036051258u, 14635550859021u },
+  { 17849554862211182029u, 16890820479803856316u, 24333192012656u },
+  { 17993472807371089767u, 17769740624697435715u, 9072915653212u },
+  { 7665160775939462156u, 9039720413099374611u, 8796963299569u },
+  { 5279679287523781775u, 9725034514655311598u, 24817490044225u },
+  { 12506896545269969607u, 7642303487498455955u, 9537527195177u },
+  { 5011197394739901382u, 3633430298311095388u, 9769414290102u },
+  { 1965224809563170733u, 2770280440653267539u, 27318196968651u },
+  { 7333319965258687356u, 11206741243031525002u, 7371150177203u },
+  { 16477362972535232529u, 2008556975444385511u, 13235607518660u },
+  { 10749755473270052611u, 15068883986167498580u, 15812108884091u },
+  { 16424365659841183320u, 13590481813851882819u, 6267816885837u },
+  { 9312033069093679729u, 7104717566538860726u, 15949736741495u },
+  { 3475575933889898016u, 495626384676378548u, 2679385147511u },
+  { 16751270034952971989u, 2773713263751787988u, 18551026867960u },
+  { 3493208297507693583u, 5913608787534650216u, 24312150363297u },
+  { 4705978106405544510u, 13534779720414630817u, 3233320577374u },
+  { 6118888041040191819u, 15667088179025656736u, 10590733721878u },
+  { 6725081879695531358u, 204373927467789553u, 24854849314552u },
+  { 3789694369240163244u, 14904943701350090107u, 24312011079132u },
+  { 7550499902460370734u, 1639826341787324671u, 15836807998617u },
+  { 16232326148146911278u, 2088885992138528395u, 11417088895164u },
+  { 13202465060648455905u, 9916167939757358787u, 10428113238736u },
+  { 847649054521149402u, 2781803182357786809u, 15056537556541u },
+  { 5918742960086808742u, 12672361915263558315u, 5693150801852u },
+  { 14489367108415512602u, 17571739165078899858u, 12220686970115u },
+  { 15572843005533588137u, 15797023369608595156u, 11523952565888u },
+  { 16948138522865225980u, 14880917008307508678u, 24192856358352u },
+  { 5603886641369029220u, 8285810867384969198u, 32208806696127u },
+  { 10085571328757263561u, 2972494948085610791u, 21695449174707u },
+  { 4977061428277323121u, 384251157278973133u, 4787161139274u },
+  { 12112207179301482443u, 17987357355081248704u, 2122020830296u },
+  { 16042387148033000474u, 1523891831208704930u, 15448975096596u },
+  { 16372329058454330850u, 12939829736914798493u, 15124082610341u },
+  { 12750148610520111551u, 11395990648371462536u, 20645701469575u },
+  { 2802928047000104172u, 17145171266512616701u, 17799617777890u },
+  { 16489604500163339519u, 13640469406732527897u, 4322929441596u },
+  { 2309387699466640909u, 4151870069158157203u, 31548739451328u },
+  { 805231076546656819u, 8170815189233845726u, 31168225073327u },
+  { 2347096237767344766u, 17658047587221454416u, 22703442940778u },
+  { 18363046982471329u, 14681690487654488310u, 21354957244677u },
+  { 14233368270329233409u, 2282564363489201286u, 2309795896036u },
+  { 440140625304616961u, 1598396218918784248u, 23268123738062u },
+  { 1987077825064075265u, 12031300209433101159u, 32718086649232u },
+  { 13680328181951758337u, 4512694115654234648u, 13712652218091u },
+  { 14007320741029085185u, 3647726881570753068u, 12011244633638u },
+  { 16717361816799281153u, 8884675818157067658u, 15910197743670u },
+  { 1u, 3574351164125686544u, 20534481639241u },
+  { 1u, 16022068219118002176u, 22345193765964u },
+  { 1u, 10033825168356278272u, 15436868558058u },
+  { 1u, 5415603593719840768u, 7402543934752u },
+  { 1u, 1504660771890528256u, 27936293580459u },
+  { 1u, 16359888596376748032u, 28331081567823u },
+  { 1u, 16429131440647569408u, 3663886871337u },
+  { 1u, 0u, 27433890625000u },
+  { 1u, 0u, 13800000000000u },
+  { 1u, 0u, 4096000000000u },
+  { 13158631126302920726u, 644114876959u, 0u },
+  { 12980057681901724554u, 16925578453588575878u, 34u },
+  { 16329989792437296859u, 9181478143153837600u, 34917537446u },
+  { 8878997961463112441u, 8702773565402454488u, 22182497728927u },
+  { 17812795598700597899u, 5772687533322598643u, 14751471778300u },
+  { 5673683396597986241u, 4342685653585896496u, 14844312938018u },
+  { 4230274256083397545u, 36397003420404017u, 26146235417461u },
+  { 17206311897094076963u, 9389728806579068266u, 885001973085u },
+  { 17794263782209090841u, 10277371653777415748u, 27997509018218u },
+  { 9639553838393415644u, 13342913374045387244u, 25194557137433u },
+  { 12338219477121683058u, 6849184655058525932u, 25113723320783u },
+  { 1566399133010591986u, 2553798722185865114u, 14799371295044u },
+  { 2757321955486945026u, 2476125039870817771u, 22852138441706u },
+  { 13264062288607652898u, 6985502432215317410u, 7146134231007u },
+  { 8569867702445198552u, 11907947281994586737u, 22495378684845u },
+  { 834201196089884513u, 11973217696638041619u, 15277645531115u },
+  { 8384653071061017814u, 16912760892382971641u, 2027649069431u },
+  { 14002565653375833549u, 2074794324459133273u, 29047916842605u },
+  { 1624222513202962823u, 12948864354921013405u, 20077112474825u },
+  { 16062058020646067492u, 4450712979896100990u, 15561701959343u },
+  { 528211084560430739u, 1764233611967833366u, 9903241273634u },
+  { 4991083427987730422u, 13712823814708283660u, 8482095639295u },
+  { 14462889343695270917u, 9977551908849319686u, 11007743373668u },
+  { 6319729210187694440u, 14445021892472612850u, 12644540884172u },
+  { 17714038838450995717u, 16066633994149855926u, 9420783066205u },
+  { 11198253775585301349u, 910098834214637985u, 7261870973974u },
+  { 10637855602353080594u, 12204398564569384057u, 25622049336556u },
+  { 13519899448188144279u, 16219390168815167371u, 11500661601771u },
+  { 12461844260516703404u, 16066594789142893585u, 30187879254902u },
+  { 394967218472041948u, 13681037199436651563u, 19318870971848u },
+  { 15059870890435556038u, 12436996867724583823u, 5576741650512u },
+  { 15459697831520047765u, 2935252931009450420u, 80674210951u },
+  { 13746031941294351222u, 4238038558070537818u, 17543159120380u },
+  { 12734222355464910062u, 10825851526216513404u, 508229744530u },
+  { 2498180731157415122u, 3439817580301604985u, 30610586870587u },
+  { 14741065620533411158u, 12467076316953046104u, 9019186472884u },
+  { 9715627918871527362u, 6809683680031602192u, 26548675841561u },
+  { 15404258183538082687u, 18289345151525270588u, 3609369153691u },
+  { 7489008738887904348u, 6106726051177919117u, 4251991467387u },
+  { 4118414277859088241u, 10570838107042088265u, 25979331046282u },
+  { 6687076965645539781u, 597295763787367973u, 27530573046282u },
+  { 12664306969780265012u, 4348499905517886880u, 25098032379468u },
+  { 8908927800293813197u, 4257050800515967824u, 30284235732652u },
+  { 14383902606806797050u, 5811248340323953367u, 30380230775186u },
+  { 13945590797980904318u, 14233519036345203674u, 4498315028403u },
+  { 18229769635953462380u, 1216796463895251383u, 10163771600613u },
+  { 2961649841369603820u, 8880180702313166304u, 28389065962668u },
+  { 11210339135915066206u, 8773075426627326399u, 13484481395560u },
+  { 5034473720297936812u, 15613823109862240166u, 15208475589371u },
+  { 4490124642334785992u, 15234258129957513031u, 31483846427046u },
+  { 11021997418233728099u, 650149746043136736u, 422825850788u },
+  { 5514311977725836875u, 6549394587271687869u, 30628035244688u },
+  { 5546189657119725185u, 18432694714464761595u, 12944355043391u },
+  { 14080253080398528513u, 13083140500583334231u, 10303999238382u },
+  { 17444901901861650433u, 12604236840374079376u, 24814709238467u },
+  { 733174574107066369u, 4478322539361580459u, 27331683277048u },
+  { 5587533374404165633u, 5779942741170808257u, 22776242770351u },
+  { 3102980143258271745u, 15512984931724832823u, 4527313331323u },
+  { 11529215046068469761u, 4345092217864986522u, 9339840960598u },
+  { 1u, 2083630881634009664u, 6230235547921u },
+  { 1u, 7863367584941768704u, 2321112953856u },
+  { 1u, 17197862561345699840u, 29696426274010u },
+  { 1u, 10254664508635086848u, 27866932297997u },
+  { 1u, 16945325761609334784u, 16653555906476u },
+  { 1u, 3884354678607052800u, 14252918607950u },
+  { 1u, 1152921504606846976u, 4174210571289u },
+  { 1u, 0u, 7193062500000u },
+  { 1u, 0u, 26272000000000u },
+  { 1u, 0u, 16384000000000u },
+  { 729502449434017200u, 9828413u, 0u },
+  { 470261271068982742u, 9828413039546407u, 0u },
+  { 10817895480813566971u, 6243818031634039730u, 532799u },
+  { 1862373928674680430u, 13375542212099755641u, 8511338478053u },
+  { 17938953542437471537u, 4178302638514372356u, 31205725089596u },
+  { 2607670757785673282u, 16582883042055940396u, 12092226506239u },
+  { 662375169062723669u, 249105909763128259u, 3583898959891u },
+  { 15954827177397184735u, 7880598198859449701u, 16403013504058u },
+  { 6792825656899125804u, 7091637383494449170u, 3130427208084u },
+  { 13397230079439059634u, 16292256723690133704u, 29076384438432u },
+  { 16063402237212124837u, 13389024727459675601u, 22688883205006u },
+  { 2853617215246588820u, 15655677172522696636u, 25486725820484u },
+  { 3885241176931280944u, 2011457966244023539u, 12356848695960u },
+  { 4297199387993448222u, 15555258228269091282u, 15000109041354u },
+  { 11128806920012771415u, 4300274920064435037u, 18122843252238u },
+  { 18307989639091285029u, 9794104511450507911u, 26126233118370u },
+  { 502560773081094523u, 8176261716765346203u, 9890530939469u },
+  { 1826704786071085454u, 14874576803123561314u, 21069443236035u },
+  { 16185117419508150184u, 4380229696584308680u, 195806352424u },
+  { 7529700714565294675u, 12010886643710940141u, 21544237452727u },
+  { 11895703525607263654u, 11610869709383101989u, 19895651111469u },
+  { 5263658222378488205u, 3098404309740230452u, 4653629426508u },
+  { 18376596015709617342u, 3559121850889471739u, 19276167964834u },
+  { 2878459543258118630u, 2651714694156439954u, 26786192940382u },
+  { 9418985965474051929u, 11267407000129910148u, 23902143749741u },
+  { 5882153460114808433u, 7211965740286565340u, 7789610807357u },
+  { 322451169128414760u, 3237148456515875442u, 12349390961446u },
+  { 16684635541817960514u, 8497132610217881008u, 15142175486169u },
+  { 1446127108015540823u, 14661150793732068609u, 12505460630481u },
+  { 11253094120636789492u, 1569713226199400275u, 25553794782577u },
+  { 11785868545245103017u, 9246079808503403870u, 21873085094324u },
+  { 1275880490720874146u, 14161332341695133374u, 6580501230990u },
+  { 18328171381339493382u, 9366425992360185395u, 13710767687364u },
+  { 8609950896438342739u, 8616114226498040641u, 1732507754970u },
+  { 6375164866732464478u, 2538675302404277765u, 25050467080488u },
+  { 17030586921712390814u, 16696159951057017771u, 6440137621863u },
+  { 17730819981674666549u, 10239319135330389262u, 359905100644u },
+  { 3764118438901178930u, 10420201236111532845u, 868555074602u },
+  { 8254367965244621110u, 16535903638065585429u, 11306564880240u },
+  { 380898485504255409u, 7749167407033248872u, 1904896413132u },
+  { 5054548193490113280u, 16287840116348887652u, 3532420083206u },
+  { 11358271502217065538u, 17747626584403078710u, 28166882965581u },
+  { 16956188536499995166u, 17774646786764698507u, 14413962100764u },
+  { 7698841568948925065u, 1266163117857145494u, 16412963565533u },
+  { 13536344422843785372u, 2860847374574989597u, 28637068638840u },
+  { 9923678468143710262u, 17214183717534163565u, 14968155086846u },
+  { 13105520106838349806u, 3795544086770658983u, 8190933182769u },
+  { 10502283912251480033u, 4280805312323020756u, 10545205756857u },
+  { 12656880622743896422u, 18085286976669651231u, 17337232062920u },
+  { 7441985423117815704u, 9342386933358001337u, 31176980405371u },
+  { 3089637526709812505u, 8621025507191805878u, 7291506451810u },
+  { 17202990293348455688u, 3643512034373225521u, 25954467346729u },
+  { 8573530943767949714u, 2900317945650390244u, 31017197515183u },
+  { 13931818819905619138u, 16208091741834167243u, 12719157226550u },
+  { 10345034532148365825u, 16916556950724956003u, 11318878642413u },
+  { 13090567929238650881u, 15634314440195658821u, 8429917048389u },
+  { 7332226927329017857u, 1274325414496220565u, 3653847537884u },
+  { 3474292985259098113u, 2628931516865619314u, 22748069081319u },
+  { 2277308483449651201u, 1753655405752996392u, 12519142514663u },
+  { 4773815605012725761u, 653335214629539540u, 24551095065850u },
+  { 9223372036854775809u, 17582172930721715910u, 23802035417372u },
+  { 1u, 7843844119576289536u, 12572953131504u },
+  { 1u, 13910931297779974144u, 14832425215641u },
+  { 1u, 13235211970086436864u, 9881754113096u },
+  { 1u, 10398307860193738752u, 5192717482278u },
+  { 1u, 11248039136520568832u, 14630563693398u },
+  { 1u, 7394910588142354432u, 17238609757423u },
+  { 1u, 4611686018427387904u, 1263400878906u },
+  { 1u, 0u, 826250000000u },
+  { 1u, 0u, 30336000000000u },
+  { 10387278241170877873u, 149969681389u, 0u },
+  { 14101498451235686195u, 2395728799886682553u, 8u },
+  { 14877951261566077339u, 8783630742833231474u, 8129872718u },
+  { 18376086106286572345u, 12627031211078628537u, 846476161576u },
+  { 16801844099710515454u, 10232149913123443095u, 12840684512733u },
+  { 13529667812594086918u, 4617037844039421665u, 26077554685958u },
+  { 14224018449462008194u, 881136925489955993u, 14342250290123u },
+  { 4040395465998593186u, 8184274632637976337u, 23499047766528u },
+  { 1785881677760205605u, 15609724908574838021u, 2560443670416u },
+  { 13677958651367270719u, 16397247593606623527u, 24464846204882u },
+  { 4592589262754215863u, 3478143698912471656u, 12242888896573u },
+  { 14768206887153564086u, 13445527379927430810u, 12349188550547u },
+  { 9931065698364385889u, 14324498919209401715u, 12179728883499u },
+  { 4854205785492572486u, 7353880858530514678u, 24363776532642u },
+  { 16899755484483136914u, 2783936965843184142u, 24738398654680u },
+  { 9915526673055106444u, 5930521044169667180u, 20696150917525u },
+  { 243785203134438214u, 55114588488410738u, 16789321494190u },
+  { 6325552641934517702u, 15287535772110134150u, 11950002987767u },
+  { 15270976805598127276u, 14823499970099026911u, 25335828738974u },
+  { 7936931432341214511u, 10533252271301185823u, 29598803583543u },
+  { 1672041678711809008u, 14649130965827173531u, 25143571008749u },
+  { 503276187984232763u, 16763015070915977881u, 19693794130980u },
+  { 15101176422333689916u, 15951227392148047584u, 31780908724867u },
+  { 3856350903256017017u, 11415952557440771710u, 29315864717769u },
+  { 6619255306866667643u, 3476044533263847953u, 27081618860028u },
+  { 3634972769455784271u, 13485515529172990933u, 10236188436751u },
+  { 12515757951796925675u, 12743346276575664492u, 10511731051261u },
+  { 1513513015921696085u, 16416125828149543638u, 19197690818185u },
+  { 18398220611328095384u, 6156726117515185880u, 11913889919964u },
+  { 15374906015971502281u, 11075618467592345281u, 13276333756791u },
+  { 3944609792014410053u, 3859238015486139645u, 20855600410480u },
+  { 5635127224471631673u, 487657579981343133u, 28528209209712u },
+  { 17528422602127248324u, 7051079638071453338u, 10608026435970u },
+  { 5045536234834448932u, 1812737587127562205u, 16770382239793u },
+  { 6605633144602413333u, 9324676316676748251u, 6193098268701u },
+  { 5552645941436405790u, 244476519395679034u, 8221505491716u },
+  { 11758111638023498548u, 12405887123198103171u, 4868013253098u },
+  { 2095707153270459846u, 9759552710377435901u, 25066672524488u },
+  { 7811499365723769848u, 10217659897507686720u, 3272529066412u },
+  { 2478182821245306131u, 17151644763603731797u, 14764553900452u },
+  { 17165080343238191128u, 13280541683475872159u, 4516929792525u },
+  { 17549379103883452067u, 4619838537361265957u, 27149719939607u },
+  { 9409825946436756279u, 17283990265033765779u, 10775250441948u },
+  { 12762563467262079218u, 13436533141326503462u, 5852936966989u },
+  { 16315848448349644519u, 2305542726858501615u, 4941728395921u },
+  { 12585227658077005015u, 12191583581675240780u, 12945124983721u },
+  { 7481765133104128013u, 4879996991137921438u, 937660907070u },
+  { 10457269988449192749u, 17998911870365299044u, 32318264545166u },
+  { 18210700123935088787u, 11275748645563725069u, 3982975722967u },
+  { 15543658308043145282u, 16528905128812858303u, 26071611259558u },
+  { 5490431917541475720u, 8730564948215996333u, 15014896033742u },
+  { 11881752538610402844u, 3580124484122580526u, 24526473284874u },
+  { 14108582840352840596u, 3185981102264198903u, 19722194078937u },
+  { 5720573804390432219u, 11596182741723070112u, 19673172712381u },
+  { 6072459418793722469u, 1028466650630206111u, 7101628630326u },
+  { 13084476173298886657u, 15626384251731475276u, 17718055753288u },
+  { 11921644177106927617u, 12747197384606953882u, 22088847107987u },
+  { 15143388496003072001u, 16133890948736015961u, 10131691026954u },
+  { 5680237872666378241u, 15923049401626037055u, 14858874619980u },
+  { 1641139851711479809u, 12762343726729153320u, 2124863190237u },
+  { 11601272640106397697u, 13398328578990085345u, 13533691848039u },
+  { 1u, 12004838545699103498u, 9575726324847u },
+  { 1u, 10684992069244150784u, 7279650783601u },
+  { 1u, 13341509611717918720u, 16753579234580u },
+  { 1u, 4852237279994839040u, 5396723244685u },
+  { 1u, 355615732966359040u, 7821263040310u },
+  { 1u, 9455940736361955328u, 28470019277967u },
+  { 1u, 8538824893494460416u, 17551512607574u },
+  { 1u, 0u, 6998462890625u },
+  { 1u, 0u, 641000000000u },
+  { 1u, 0u, 18944000000000u },
+  { 13541638151860565027u, 2288355u, 0u },
+  { 3006649398036849312u, 2288355734093675u, 0u },
+  { 8535111263340493625u, 238261857865922758u, 124052u },
+  { 13022720194340190004u, 3614331374170558492u, 25748012916201u },
+  { 5879424214350450365u, 7340179097900956740u, 24041195933296u },
+  { 5684030651065514677u, 4036984566390784129u, 3696397911906u },
+  { 331513088885583562u, 15837765959660962383u, 1890218845371u },
+  { 10309082673569920754u, 720700822499528352u, 9403858567013u },
+  { 10161555384623203783u, 16109614052603967787u, 16229039069269u },
+  { 3542008341036051259u, 12669438903888862989u, 22613873303927u },
+  { 16890820479803856317u, 3475987559660921712u, 8567686811659u },
+  { 17769740624697435716u, 3428288903825203804u, 20491188433663u },
+  { 9039720413099374612u, 16081165468963922161u, 29439185847913u },
+  { 9725034514655311599u, 16186612222039795009u, 1641871761726u },
+  { 7642303487498455956u, 15048820634365437481u, 24894877478006u },
+  { 3633430298311095389u, 4725773876564847286u, 11382815798201u },
+  { 2770280440653267540u, 3363626812674219211u, 13241256184715u },
+  { 11206741243031525003u, 16354773841102877619u, 2955182342574u },
+  { 2008556975444385512u, 8331322549341208004u, 430886594066u },
+  { 15068883986167498581u, 7077286064110573691u, 9746451641900u },
+  { 13590481813851882820u, 5543310244362305101u, 13868383660446u },
+  { 7104717566538860727u, 8945530543175666295u, 27038300503450u },
+  { 495626384676378549u, 8251682338686945399u, 32154484938182u },
+  { 2773713263751787989u, 16846170074768072440u, 5574447324595u },
+  { 5913608787534650217u, 12104602938695355553u, 23987913232709u },
+  { 13534779720414630818u, 2958789252842563934u, 4421656191840u },
+  { 15667088179025656737u, 14627041612802023702u, 9056160396286u },
+  { 204373927467789554u, 12576833924610055928u, 13310792933514u },
+  { 14904943701350090108u, 3736955734995811804u, 8330681791533u },
+  { 1639826341787324672u, 5870329639826664601u, 13357202580776u },
+  { 2088885992138528396u, 8029977022900414652u, 9512318231207u },
+  { 9916167939757358788u, 12209266030865562320u, 25255435305926u },
+  { 2781803182357786810u, 13943814987229337149u, 966661865637u },
+  { 12672361915263558316u, 1743202190949560252u, 165755895725u },
+  { 17571739165078899859u, 2314148066807295235u, 16301094499180u },
+  { 15797023369608595157u, 1370223917043113600u, 29548125450218u },
+  { 14880917008307508679u, 7055641065044049360u, 28650074279987u },
+  { 8285810867384969199u, 10144507079608194239u, 4147382487068u },
+  { 2972494948085610792u, 13379224502127989427u, 2076549934830u },
+  { 384251157278973134u, 10494774745009621066u, 28398725289213u },
+  { 17987357355081248705u, 16865338824556559448u, 21757568922878u },
+  { 1523891831208704931u, 12256335404053838612u, 13566914271849u },
+  { 12939829736914798494u, 10870827333327147173u, 6761664417273u },
+  { 11395990648371462537u, 10614344922007061895u, 3577589308730u },
+  { 17145171266512616702u, 3643728753309585634u, 7482575404791u },
+  { 13640469406732527898u, 9487300118834871100u, 16119197526931u },
+  { 4151870069158157204u, 18320154797034469824u, 27539514307569u },
+  { 8170815189233845727u, 10344480035716192431u, 13297993137581u },
+  { 17658047587221454417u, 7338506172093617002u, 15789560775386u },
+  { 14681690487654488311u, 13449689548265359621u, 17114397821216u },
+  { 2282564363489201287u, 6903588496654490340u, 18720729109131u },
+  { 1598396218918784249u, 5551304119051878350u, 4747374244282u },
+  { 12031300209433101160u, 5537505831042332048u, 12730300936799u },
+  { 4512694115654234649u, 11222302790183530219u, 12895300188792u },
+  { 3647726881570753069u, 4987189330515082790u, 31352608362253u },
+  { 8884675818157067659u, 6217457725286076470u, 3853270356075u },
+  { 3574351164125686545u, 12075189532706461513u, 4203337049058u },
+  { 16022068219118002177u, 4182401387605670988u, 25570654597336u },
+  { 10033825168356278273u, 9821467853840260330u, 12504226728433u },
+  { 5415603593719840769u, 3809395597736176928u, 2545532422839u },
+  { 1504660771890528257u, 2695327344274108075u, 19127206507749u },
+  { 16359888596376748033u, 2049039534775963215u, 29925146113988u },
+  { 16429131440647569409u, 13939085361728514857u, 14276111078655u },
+  { 1u, 10742414586466416104u, 5375755639331u },
+  { 1u, 11424861868973953024u, 23075582347461u },
+  { 1u, 17236970050072608768u, 2245619343002u },
+  { 1u, 14163683639308582912u, 24218934418018u },
+  { 1u, 11193264216003837952u, 6754767814828u },
+  { 1u, 180425460071530496u, 16556606788069u },
+  { 1u, 14555633995661443072u, 4581009780883u },
+  { 1u, 0u, 28819789062500u },
+  { 1u, 0u, 8548000000000u },
+  { 1u, 0u, 26624000000000u },
+  { 9181478143153837601u, 34917537446u, 0u },
+  { 8702773565402454489u, 16470793372788177311u, 1u },
+  { 5772687533322598644u, 15990367102275697148u, 1892883497u },
+  { 4342685653585896497u, 10263815553021896226u, 7209866839537u },
+  { 36397003420404018u, 532049305479086965u, 17905556402556u },
+  { 9389728806579068267u, 11870322907995073885u, 12668028842450u },
+  { 10277371653777415749u, 4568068394059063914u, 29138643491494u },
+  { 13342913374045387245u, 15588611498415546905u, 6822247635483u },
+  { 6849184655058525933u, 11634961482630740431u, 6683845060322u },
+  { 2553798722185865115u, 14991128823993784644u, 26338630732525u },
+  { 2476125039870817772u, 17509766187777006570u, 2797812670721u },
+  { 6985502432215317411u, 462145815893956575u, 24833949206327u },
+  { 11907947281994586738u, 16230657095191378861u, 1847025052974u },
+  { 11973217696638041620u, 3203977811700385771u, 11566879865684u },
+  { 16912760892382971642u, 3727082276212535671u, 31572173687985u },
+  { 2074794324459133274u, 831809881052008045u, 3249202045535u },
+  { 12948864354921013406u, 121283794029788361u, 8799045092504u },
+  { 4450712979896100991u, 11966754285770221231u, 1176006574807u },
+  { 1764233611967833367u, 13126975004693340450u, 17111648719049u },
+  { 13712823814708283661u, 16833977041359219455u, 20681711614740u },
+  { 9977551908849319687u, 18274054935972819300u, 31508912571723u },
+  { 14445021892472612851u, 1569067430865413324u, 1355990638503u },
+  { 16066633994149855927u, 15975369355368963165u, 8103085059315u },
+  { 910098834214637986u, 1244585573620737046u, 11507866026508u },
+  { 12204398564569384058u, 2549082536632790252u, 16908067469119u },
+  { 16219390168815167372u, 3746655130961409515u, 30527138186041u },
+  { 16066594789142893586u, 11568250500110470006u, 17209203106581u },
+  { 13681037199436651564u, 3759718285343528392u, 8981627116116u },
+  { 12436996867724583824u, 11900851589448237136u, 6740203814736u },
+  { 2935252931009450421u, 7108773064553186439u, 16208645146457u },
+  { 4238038558070537819u, 272091126117466620u, 18265385367360u },
+  { 10825851526216513405u, 9270028173743650706u, 30528014750089u },
+  { 3439817580301604986u, 4588350194514928443u, 4489502529234u },
+  { 12467076316953046105u, 8317057922943674292u, 5842248734962u },
+  { 6809683680031602193u, 8064278990718012953u, 6386450868613u },
+  { 18289345151525270589u, 1167384388957802651u, 10629437165440u },
+  { 6106726051177919118u, 9807868881399768443u, 3968063284034u },
+  { 10570838107042088266u, 7993530539393706890u, 9026531685637u },
+  { 597295763787367974u, 15347583242702610954u, 29957433330158u },
+  { 4348499905517886881u, 13042118915559126604u, 2542831994154u },
+  { 4257050800515967825u, 1903239334377354924u, 1322707014683u },
+  { 5811248340323953368u, 1007001867355230610u, 21531103174811u },
+  { 14233519036345203675u, 11329529774654105523u, 8347054589680u },
+  { 1216796463895251384u, 13760522785342287589u, 18160614175039u },
+  { 8880180702313166305u, 16975056185200817324u, 28991745959434u },
+  { 8773075426627326400u, 12966424345554008936u, 9738920219639u },
+  { 15613823109862240167u, 4444366251523373819u, 21495702911272u },
+  { 15234258129957513032u, 4817274728143880614u, 31016240929577u },
+  { 650149746043136737u, 5269416789999253412u, 23337261144986u },
+  { 6549394587271687870u, 10559639091700904592u, 7066285655656u },
+  { 18432694714464761596u, 3583261159705225279u, 18024572439182u },
+  { 13083140500583334232u, 12853076357172093166u, 19086194248976u },
+  { 12604236840374079377u, 8824974708583557827u, 3344696766665u },
+  { 4478322539361580460u, 10307971220590942456u, 28873478402837u },
+  { 5779942741170808258u, 10406506234845598127u, 29461558796239u },
+  { 15512984931724832824u, 7197499407261443195u, 8143564137833u },
+  { 4345092217864986523u, 12742998964025366614u, 25961390177224u },
+  { 2083630881634009665u, 716503679434885393u, 31688690799358u },
+  { 7863367584941768705u, 5383830006308598784u, 4862038841742u },
+  { 17197862561345699841u, 8423179805497781466u, 6542291858009u },
+  { 10254664508635086849u, 4018368033383366925u, 29273456621492u },
+  { 16945325761609334785u, 10736512730237810604u, 14260217836167u },
+  { 3884354678607052801u, 6495199003836584014u, 29319582027521u },
+  { 1152921504606846977u, 9855457689127525401u, 3841352105443u },
+  { 1u, 16040396038123513504u, 32227534265431u },
+  { 1u, 11124670150219546624u, 23639869551611u },
+  { 1u, 4660270510079213568u, 29691603069577u },
+  { 1u, 10512811658240327680u, 10889252633770u },
+  { 1u, 17335421492027981824u, 31914569900661u },
+  { 1u, 2406048100922687488u, 8821939755082u },
+  { 1u, 16717361816799281152u, 22602130432128u },
+  { 1u, 0u, 8320906250000u },
+  { 1u, 0u, 18192000000000u },
+  { 1u, 0u, 8192000000000u },
+  { 6243818031634039731u, 532799u, 0u },
+  { 13375542212099755642u, 532799338478053u, 0u },
+  { 4178302638514372357u, 2029397100745764668u, 28883u },
+  { 16582883042055940397u, 5039966071400795647u, 28883110013837u },
+  { 249105909763128260u, 3565733123398713363u, 11149273217108u },
+  { 7880598198859449702u, 17425171035003227194u, 14420193298779u },
+  { 7091637383494449171u, 11143664031166919060u, 18779944620414u },
+  { 16292256723690133705u, 11104707169546721440u, 4478604099237u },
+  { 13389024727459675602u, 16637037508883047310u, 16037601987381u },
+  { 15655677172522696637u, 10010886293187014724u, 19253901895610u },
+  { 2011457966244023540u, 6990135274484513432u, 10170542691233u },
+  { 15555258228269091283u, 9743263370624878282u, 5025378935992u },
+  { 4300274920064435038u, 12479159277663184398u, 9400528183365u },
+  { 9794104511450507912u, 18110148890385196706u, 8261676496579u },
+  { 8176261716765346204u, 10137941106949968461u, 30403981753138u },
+  { 14874576803123561315u, 11700083049343353027u, 15154549578888u },
+  { 4380229696584308681u, 331016423255561256u, 23688634262773u },
+  { 12010886643710940142u, 4816500924675444151u, 25845017944436u },
+  { 11610869709383101990u, 5821384295095702061u, 8564261103038u },
+  { 3098404309740230453u, 18092342469158882124u, 9662315577874u },
+  { 3559121850889471740u, 9605049470247299234u, 16914980787850u },
+  { 2651714694156439955u, 2280815678355397982u, 22154520690775u },
+  { 11267407000129910149u, 12462548358655483501u, 87123643265u },
+  { 7211965740286565341u, 4759197897092509757u, 19329675596100u },
+  { 3237148456515875443u, 17815997546813700902u, 4420257996634u },
+  { 8497132610217881009u, 4843960043634012377u, 24410965807162u },
+  { 14661150793732068610u, 2528103283332604881u, 4154262591600u },
+  { 1569713226199400276u, 11120570748632847729u, 6256137048753u },
+  { 9246079808503403871u, 4562328015110379956u, 4785602847348u },
+  { 14161332341695133375u, 5141248920888817038u, 25204247324297u },
+  { 9366425992360185396u, 8592872240804005572u, 26249278707662u },
+  { 8616114226498040642u, 10487054656713417178u, 22478465820537u },
+  { 2538675302404277766u, 1644446826611415336u, 26489568504372u },
+  { 16696159951057017772u, 1797626109506716007u, 10804089145641u },
+  { 10239319135330389263u, 12215292615444398948u, 18729097449506u },
+  { 10420201236111532846u, 10340282557314804778u, 20514662192339u },
+  { 16535903638065585430u, 11764114832847570800u, 5331560547840u },
+  { 7749167407033248873u, 17655639885772262860u, 17920637733942u },
+  { 16287840116348887653u, 715743576333807110u, 3126957114156u },
+  { 17747626584403078711u, 372308926152947789u, 812038800537u },
+  { 17774646786764698508u, 6060466764684673052u, 17561020182907u },
+  { 1266163117857145495u, 11572859033087700957u, 12667328538561u },
+  { 2860847374574989598u, 5111758451970521720u, 10177627365945u },
+  { 17214183717534163566u, 17383823055587975166u, 8761277108980u },
+  { 3795544086770658984u, 2741262342010022193u, 21236942378936u },
+  { 4280805312323020757u, 6050502476329534393u, 6072148604129u },
+  { 18085286976669651232u, 8730295693304854984u, 13537327998396u },
+  { 9342386933358001338u, 15792227074130287739u, 26044473270277u },
+  { 8621025507191805879u, 1988982590356776290u, 24581856098345u },
+  { 3643512034373225522u, 5073466107538340137u, 30761107822962u },
+  { 2900317945650390245u, 14595658118580548015u, 6514275033148u },
+  { 16208091741834167244u, 941448444501371958u, 8252791232212u },
+  { 16916556950724956004u, 8127161660994330861u, 5844051036022u },
+  { 15634314440195658822u, 8292691576031153733u, 1910440574316u },
+  { 1274325414496220566u, 2292209526038386908u, 15724449547711u },
+  { 2628931516865619315u, 7307481695510573287u, 17855124260927u },
+  { 1753655405752996393u, 8919573504740483047u, 18495396139376u },
+  { 653335214629539541u, 10591914306600492282u, 20848483531048u },
+  { 17582172930721715911u, 1841491448367526172u, 31016574188825u },
+  { 7843844119576289537u, 8239745520774920688u, 32025099827451u },
+  { 13910931297779974145u, 13237266520178927257u, 30971446677499u },
+  { 13235211970086436865u, 17476100705217516616u, 20475717593655u },
+  { 10398307860193738753u, 10304616531271924006u, 10807947381317u },
+  { 11248039136520568833u, 9071244456804303702u, 19013558614381u },
+  { 7394910588142354433u, 6654031731482821871u, 14701491753147u },
+  { 4611686018427387905u, 17580815319366075194u, 4283360715782u },
+  { 1u, 3065052131487020672u, 9222953057908u },
+  { 1u, 18206524856374198272u, 15988166156808u },
+  { 1u, 2483155287104552960u, 25096986977690u },
+  { 1u, 15585306173849468928u, 26010134612117u },
+  { 1u, 11565498929785077760u, 2197844881140u },
+  { 1u, 5120592776320253952u, 28404626966953u },
+  { 1u, 11529215046068469760u, 18857277587890u },
+  { 1u, 0u, 434625000000u },
+  { 1u, 0u, 12864000000000u },
+  { 8783630742833231475u, 8129872718u, 0u },
+  { 12627031211078628538u, 8129872718476161576u, 0u },
+  { 10232149913123443096u, 3138241419126269405u, 440721283u },
+  { 4617037844039421666u, 4058923572937242630u, 24451170124408u },
+  { 881136925489955994u, 14509456511513385931u, 17016220034687u },
+  { 8184274632637976338u, 10483987021383928320u, 9855786559213u },
+  { 15609724908574838022u, 4514183645893091216u, 9965568338075u },
+  { 16397247593606623528u, 14642863624511008722u, 10395244714385u },
+  { 3478143698912471657u, 12086125304004423741u, 22929793791227u },
+  { 13445527379927430811u, 10637890455825493907u, 13563655190165u },
+  { 14324498919209401716u, 2646013451480719147u, 30357576681197u },
+  { 7353880858530514679u, 11548827236320600226u, 1773143440676u },
+  { 2783936965843184143u, 17781332092730659032u, 15652626063178u },
+  { 5930521044169667181u, 4265626489778160021u, 24394963927944u },
+  { 55114588488410739u, 6667757777421282990u, 17288231240075u },
+  { 15287535772110134151u, 7274725823996682999u, 16779361459873u },
+  { 14823499970099026912u, 2410625194521686942u, 7841394363677u },
+  { 10533252271301185824u, 11943072089108144695u, 3357130680253u },
+  { 14649130965827173532u, 4761143823321418989u, 26557647435235u },
+  { 16763015070915977882u, 15459315232326450212u, 13795258102123u },
+  { 15951227392148047585u, 24523125459153539u, 29035838051158u },
+  { 11415952557440771711u, 5440819988236855753u, 4950001329401u },
+  { 3476044533263847954u, 10467564053512693756u, 9465294947442u },
+  { 13485515529172990934u, 6871076032055617807u, 1138567447784u },
+  { 12743346276575664493u, 1169320966220598013u, 1256372481778u },
+  { 16416125828149543639u, 10984318066951368329u, 12018063389016u },
+  { 6156726117515185881u, 10570399486858572764u, 12632595461075u },
+  { 11075618467592345282u, 7094364928616190327u, 29651573022504u },
+  { 3859238015486139646u, 7388515112910810992u, 7976384586293u },
+  { 487657579981343134u, 15550497680181864816u, 25141400532206u },
+  { 7051079638071453339u, 7456150677843460482u, 29934842994168u },
+  { 1812737587127562206u, 3041080740649179185u, 24056404198738u },
+  { 9324676316676748252u, 5271772268411494429u, 17746164857317u },
+  { 244476519395679035u, 5774364062815752964u, 14821285783347u },
+  { 12405887123198103172u, 1500700881034895850u, 26419313028903u },
+  { 9759552710377435902u, 14267583125656472776u, 12071081353157u },
+  { 10217659897507686721u, 880160180882291116u, 8133773447231u },
+  { 17151644763603731798u, 228568602469306788u, 20543047713579u },
+  { 13280541683475872160u, 14166359783853976077u, 17195012390728u },
+  { 4619838537361265958u, 12788908042232637975u, 32584767959902u },
+  { 17283990265033765780u, 2864747425799182044u, 29534693288094u },
+  { 13436533141326503463u, 2466080270206014285u, 26782155298269u },
+  { 2305542726858501616u, 5977667861516595857u, 21981133686479u },
+  { 12191583581675240781u, 1709157886930944937u, 18127324050024u },
+  { 4879996991137921439u, 13033791119927934526u, 29288092653634u },
+  { 17998911870365299045u, 7330867507192762254u, 22594706563232u },
+  { 11275748645563725070u, 16142549409641162199u, 24736397407123u },
+  { 16528905128812858304u, 17881854144917060262u, 13203875089356u },
+  { 8730564948215996334u, 11056977450097139662u, 19404969377255u },
+  { 3580124484122580527u, 11546326256739568906u, 32231599399948u },
+  { 3185981102264198904u, 10868326166115077337u, 25612625927600u },
+  { 11596182741723070113u, 537741216162814909u, 23984589173142u },
+  { 1028466650630206112u, 13649411107084649782u, 29078029151009u },
+  { 15626384251731475277u, 14249142722365183560u, 11041739936058u },
+  { 12747197384606953883u, 14429363234440128403u, 4410772447574u },
+  { 16133890948736015962u, 5868326416354392586u, 24918782217348u },
+  { 15923049401626037056u, 8730389497443878988u, 3204318122612u },
+  { 12762343726729153321u, 18237636264943105245u, 21108473275362u },
+  { 13398328578990085346u, 17941059269099332967u, 9186988664242u },
+  { 12004838545699103499u, 14986774169663052911u, 9650972586771u },
+  { 10684992069244150785u, 12265538774301131121u, 29459812434655u },
+  { 13341509611717918721u, 5351840968169723156u, 17119664916189u },
+  { 4852237279994839041u, 4138102048829054605u, 18141290123880u },
+  { 355615732966359041u, 10429030894573121334u, 21096224326961u },
+  { 9455940736361955329u, 11819402534032950415u, 1329565358897u },
+  { 8538824893494460417u, 4500268696633908054u, 23345640731095u },
+  { 1u, 16287545861907743361u, 29143243960054u },
+  { 1u, 7321202034186897920u, 12022882949630u },
+  { 1u, 9842010373587468288u, 23038396883157u },
+  { 1u, 7995191713998045184u, 24789533536451u },
+  { 1u, 5307851769877889024u, 12483433420211u },
+  { 1u, 122336061752868864u, 21939287739221u },
+  { 1u, 3620894100405878784u, 19285006631851u },
+  { 1u, 9223372036854775808u, 17323196289062u },
+  { 1u, 0u, 4134500000000u },
+  { 1u, 0u, 24832000000000u },
+  { 238261857865922759u, 124052u, 0u },
+  { 3614331374170558493u, 124052012916201u, 0u },
+  { 7340179097900956741u, 16105764578170867312u, 6724u },
+  { 4036984566390784130u, 4789640137967142754u, 6724873095247u },
+  { 15837765959660962384u, 2774157292219835579u, 2127259646912u },
+  { 720700822499528353u, 2805058115868180325u, 15296150387368u },
+  { 16109614052603967788u, 2926001263883311189u, 15016152062505u },
+  { 12669438903888862990u, 6454163173365948791u, 23081158618846u },
+  { 3475987559660921713u, 13041201565617999883u, 11998349880886u },
+  { 3428288903825203805u, 8544898189331919615u, 28214706964953u },
+  { 16081165468963922162u, 499095508669105769u, 2521463219859u },
+  { 16186612222039795010u, 13629194593448681790u, 26259027056021u },
+  { 15048820634365437482u, 6866571903475395702u, 21909738840119u },
+  { 4725773876564847287u, 14089576522523423673u, 24631372237608u },
+  { 3363626812674219212u, 13946342412992318347u, 19240763797473u },
+  { 16354773841102877620u, 2207156295895089582u, 12257756032737u },
+  { 8331322549341208005u, 10168320316893799954u, 12001119650182u },
+  { 7077286064110573692u, 16698685230177433132u, 16774551225748u },
+  { 5543310244362305102u, 3883019953012795806u, 17812905237540u },
+  { 8945530543175666296u, 8172861839224077722u, 7204210498933u },
+  { 8251682338686945400u, 1393301508910945734u, 23925443051728u },
+  { 16846170074768072441u, 2664243674890886579u, 16592075531026u },
+  { 12104602938695355554u, 320478245848617285u, 8978144428939u },
+  { 2958789252842563935u, 9577009451903165280u, 907017373160u },
+  { 14627041612802023703u, 12606156149385409534u, 17896519170722u },
+  { 12576833924610055929u, 3555759513201385610u, 31394683381094u },
+  { 3736955734995811805u, 8346175825943737389u, 25958192758109u },
+  { 5870329639826664602u, 2245152665662170408u, 15709452447098u },
+  { 8029977022900414653u, 16300047166130971303u, 11642121709969u },
+  { 12209266030865562321u, 8425909234620695494u, 27025883627327u },
+  { 13943814987229337150u, 15994647848436727973u, 32575456769454u },
+  { 1743202190949560253u, 4995101339916844973u, 30126867071597u },
+  { 2314148066807295236u, 4171821070689661804u, 17005270784986u },
+  { 1370223917043113601u, 7436375519522025450u, 23514226154873u },
+  { 7055641065044049361u, 12621079379607294003u, 23929403126724u },
+  { 10144507079608194240u, 2289453691629111324u, 13252684190084u },
+  { 13379224502127989428u, 5782353876745547502u, 4484124111533u },
+  { 10494774745009621067u, 14063337749074597117u, 29357313462031u },
+  { 16865338824556559449u, 18395168839490516222u, 3855762375066u },
+  { 12256335404053838613u, 17536649142277446249u, 16794997204100u },
+  { 10870827333327147174u, 16761878575696252409u, 9348950663654u },
+  { 10614344922007061896u, 6187139092475583802u, 8678908663258u },
+  { 3643728753309585635u, 5102388114807045879u, 5594335405482u },
+  { 9487300118834871101u, 17467237234436139923u, 26026276601013u },
+  { 18320154797034469825u, 15583216540524721137u, 15541946900827u },
+  { 10344480035716192432u, 6962676884075724205u, 24923844767861u },
+  { 7338506172093617003u, 3716560433267163866u, 28789377447470u },
+  { 13449689548265359622u, 14685385340388788512u, 13870201475144u },
+  { 6903588496654490341u, 9072388690447733387u, 4168796096334u },
+  { 5551304119051878351u, 7209313286470119866u, 18254491815176u },
+  { 5537505831042332049u, 6751061678924804703u, 3336390817656u },
+  { 11222302790183530220u, 17408109614927018616u, 14200365975786u },
+  { 4987189330515082791u, 3107973491347263245u, 2282943695513u },
+  { 6217457725286076471u, 10464894108811890795u, 19097168483580u },
+  { 12075189532706461514u, 7014013644286026722u, 5372567303046u },
+  { 4182401387605670989u, 10125307405790654680u, 13190380230441u },
+  { 9821467853840260331u, 5941507023580301809u, 5929548894014u },
+  { 3809395597736176929u, 2585907420308851383u, 20286322089741u },
+  { 2695327344274108076u, 2716507284096775397u, 7949140182322u },
+  { 2049039534775963216u, 17515572055799773124u, 17714147262154u },
+  { 13939085361728514858u, 14042129320433390847u, 32458949521063u },
+  { 10742414586466416105u, 14329691251975215651u, 28327761225355u },
+  { 11424861868973953025u, 5938059251114281157u, 9867776814119u },
+  { 17236970050072608769u, 374239378431008410u, 27687321902837u },
+  { 14163683639308582913u, 6571213681080375906u, 7925020287557u },
+  { 11193264216003837953u, 8203093914929414316u, 25157356226207u },
+  { 180425460071530497u, 3384140698242159077u, 1695444690612u },
+  { 14555633995661443073u, 15708104262992392339u, 26292183454634u },
+  { 1u, 6977633374840693092u, 21418851538038u },
+  { 1u, 3513774131222996992u, 5238378258263u },
+  { 1u, 6175360505445613568u, 24407190482077u },
+  { 1u, 14651618829419937792u, 11421334766963u },
+  { 1u, 4876046272017989632u, 1395794265848u },
+  { 1u, 1163758291210207232u, 18168264330998u },
+  { 1u, 6989586621679009792u, 3830063087463u },
+  { 1u, 0u, 16231378906250u },
+  { 1u, 0u, 27786000000000u },
+  { 1u, 0u, 25600000000000u },
+  { 15990367102275697149u, 1892883497u, 0u },
+  { 10263815553021896227u, 1892883497866839537u, 0u },
+  { 532049305479086966u, 598770359572115836u, 102613420u },
+  { 11870322907995073886u, 4305483574047142354u, 16812032459406u },
+  { 4568068394059063915u, 4226671052077308582u, 654233400732u },
+  { 15588611498415546906u, 15720140621549509147u, 30108229128296u },
+  { 11634961482630740432u, 12600607290143663842u, 20584852190530u },
+  { 14991128823993784645u, 17165106022713035501u, 30018683080289u },
+  { 17509766187777006571u, 709728801086595329u, 3681930522262u },
+  { 462145815893956576u, 7391259029038204727u, 11926038474475u },
+  { 16230657095191378862u, 15390415266613931310u, 28395400680954u },
+  { 3203977811700385772u, 6933114926932425556u, 22010834316083u },
+  { 3727082276212535672u, 5415793541789158577u, 27443375844913u },
+  { 831809881052008046u, 3450251593839583839u, 11825293590756u },
+  { 121283794029788362u, 12601386910891705496u, 228187038513u },
+  { 11966754285770221232u, 4721616415599379159u, 25393683122553u },
+  { 13126975004693340451u, 14237259123740528841u, 18809255959338u },
+  { 16833977041359219456u, 11251177019260730132u, 6954771803363u },
+  { 18274054935972819301u, 6734413525777286475u, 27875609927528u },
+  { 1569067430865413325u, 13893626110531805095u, 24424365073288u },
+  { 15975369355368963166u, 11750495030895291635u, 9096753174980u },
+  { 1244585573620737047u, 255302693986517516u, 22980636995612u },
+  { 2549082536632790253u, 14260794353635751743u, 28700013839986u },
+  { 3746655130961409516u, 18060189810386682681u, 18034773079210u },
+  { 11568250500110470007u, 7306581702039577365u, 13482979044851u },
+  { 3759718285343528393u, 13645189798538877524u, 11763396090587u },
+  { 11900851589448237137u, 3276965937176395600u, 6875739707221u },
+  { 7108773064553186440u, 7607109964586895193u, 22357177644679u },
+  { 272091126117466621u, 9169175935521290048u, 13959412382257u },
+  { 9270028173743650707u, 8479959207342870921u, 31281497062023u },
+  { 4588350194514928444u, 14009930235017172690u, 14983459699509u },
+  { 8317057922943674293u, 15842038296166865138u, 31541759479839u },
+  { 8064278990718012954u, 15958900224649505157u, 4127858798616u },
+  { 1167384388957802652u, 12953671010612383616u, 12312865133714u },
+  { 9807868881399768444u, 10485540766716306242u, 21650702219912u },
+  { 7993530539393706891u, 17486721159867593989u, 14984568422303u },
+  { 15347583242702610955u, 10308672661578582510u, 16287947957053u },
+  { 13042118915559126605u, 13950743483734623530u, 9021558834264u },
+  { 1903239334377354925u, 11854867707176113179u, 17496756271319u },
+  { 1007001867355230611u, 2442895613864550555u, 14551642653666u },
+  { 11329529774654105524u, 10798037464824497904u, 17378132429636u },
+  { 13760522785342287590u, 16549117636990267711u, 2884585362783u },
+  { 16975056185200817325u, 13598041178803545610u, 5471897129464u },
+  { 12966424345554008937u, 7015438625573786615u, 4600737151289u },
+  { 4444366251523373820u, 17326861383395735848u, 14649380307689u },
+  { 4817274728143880615u, 13127486674043263785u, 745939291037u },
+  { 5269416789999253413u, 10396783820982000538u, 19357711642478u },
+  { 10559639091700904593u, 5138182658541635176u, 12142563610780u },
+  { 3583261159705225280u, 939110527697472142u, 20636278541440u },
+  { 12853076357172093167u, 13220419719172197648u, 19584050909283u },
+  { 8824974708583557828u, 642591523526308041u, 20579716680389u },
+  { 10307971220590942457u, 5375375054155313941u, 19141034834956u },
+  { 10406506234845598128u, 10735615293356187599u, 31756291399665u },
+  { 7197499407261443196u, 3712761968168232297u, 24561581978871u },
+  { 12742998964025366615u, 10892391673702153160u, 29943201269229u },
+  { 716503679434885394u, 14933464074609529598u, 1517590477735u },
+  { 5383830006308598785u, 11460856084543641998u, 31655809544709u },
+  { 8423179805497781467u, 4986089188064195161u, 29189621294253u },
+  { 4018368033383366926u, 9136382060493780916u, 9389270296436u },
+  { 10736512730237810605u, 17196927968026817159u, 26484495284263u },
+  { 6495199003836584015u, 2777532248940187393u, 30759932247333u },
+  { 9855457689127525402u, 17016660324636261859u, 15653150570324u },
+  { 16040396038123513505u, 11454066937726458967u, 14164922475004u },
+  { 11124670150219546625u, 16304538294728193019u, 8700620926212u },
+  { 4660270510079213569u, 477225254804269705u, 27908883870792u },
+  { 10512811658240327681u, 16623963762420415658u, 29768025870432u },
+  { 17335421492027981825u, 6028870737838350965u, 4192901186881u },
+  { 2406048100922687489u, 10697844435101014090u, 17729326825737u },
+  { 16717361816799281153u, 16093385409370038400u, 16649579931308u },
+  { 1u, 3214819937535739664u, 9900872424171u },
+  { 1u, 392881158472507392u, 23275174275738u },
+  { 1u, 5113911779440721920u, 10906021298130u },
+  { 1u, 1078066918344097792u, 32722277225713u },
+  { 1u, 13792099036473327616u, 21745058442124u },
+  { 1u, 17044435739737063424u, 27532747671186u },
+  { 1u, 16429131440647569408u, 1682923980712u },
+  { 1u, 0u, 1960890625000u },
+  { 1u, 0u, 27624000000000u },
+  { 1u, 0u, 4096000000000u },
+  { 2029397100745764669u, 28883u, 0u },
+  { 5039966071400795648u, 28883110013837u, 0u },
+  { 3565733123398713364u, 13955538481824938068u, 1565u },
+  { 17425171035003227195u, 184150331234437467u, 1565756531257u },
+  { 11143664031166919061u, 8474713092686451070u, 8761009982809u },
+  { 11104707169546721441u, 5794120790921920165u, 19801459415117u },
+  { 16637037508883047311u, 8449508120909171509u, 22605314099917u },
+  { 10010886293187014725u, 1036371308003960762u, 2765458048753u },
+  { 6990135274484513433u, 3356881401853350817u, 1777056181801u },
+  { 9743263370624878283u, 7992594745361507512u, 28201181976905u },
+  { 12479159277663184399u, 6195499076501676101u, 6473433279429u },
+  { 18110148890385196707u, 16947995613663524547u, 27589335858677u },
+  { 10137941106949968462u, 3328524238054767410u, 15861918752683u },
+  { 11700083049343353028u, 9287600978206088328u, 24491180439660u },
+  { 331016423255561257u, 16371058402373231861u, 14444503481857u },
+  { 4816500924675444152u, 5294334883099648372u, 15873887476854u },
+  { 5821384295095702062u, 1957594231379699134u, 7286287006469u },
+  { 18092342469158882125u, 17069658692001153554u, 31493106121395u },
+  { 9605049470247299235u, 16098219627031287434u, 15027925348051u },
+  { 2280815678355397983u, 11783880424925036631u, 28371872686234u },
+  { 12462548358655483502u, 15691846299990707073u, 8346638805437u },
+  { 4759197897092509758u, 8078335727205781828u, 27069850656692u },
+  { 17815997546813700903u, 5076337332452876122u, 8116437927457u },
+  { 4843960043634012378u, 3795121212639809594u, 17953275188798u },
+  { 2528103283332604882u, 3311101640636405872u, 5694205733933u },
+  { 11120570748632847730u, 11158720710813389489u, 11309179495179u },
+  { 4562328015110379957u, 15516358093706912372u, 25355604915461u },
+  { 5141248920888817039u, 13152597312045147785u, 29957841143457u },
+  { 8592872240804005573u, 18028330693862283214u, 18081713003728u },
+  { 10487054656713417179u, 4217468969964562297u, 7376977317765u },
+  { 1644446826611415337u, 18101588051855813172u, 20357228629450u },
+  { 1797626109506716008u, 10385260996060334377u, 3530981289054u },
+  { 12215292615444398949u, 12689135463608569890u, 11358562986126u },
+  { 10340282557314804779u, 15317502939974014163u, 10382687879411u },
+  { 11764114832847570801u, 4217781047687235072u, 16627830363498u },
+  { 17655639885772262861u, 13808021808730803254u, 5482228646368u },
+  { 715743576333807111u, 2539343062768485164u, 480748534362u },
+  { 372308926152947790u, 4924899063981720729u, 31322137658063u },
+  { 6060466764684673053u, 4095923277042463099u, 719266979313u },
+  { 11572859033087700958u, 14114881457761429441u, 7665222040445u },
+  { 5111758451970521721u, 811938597809496633u, 15229765169257u },
+  { 17383823055587975167u, 10763574153933968116u, 12393044015279u },
+  { 2741262342010022194u, 1294992382511028152u, 30895583494524u },
+  { 6050502476329534394u, 13346806017787344097u, 380070201677u },
+  { 8730295693304854985u, 209963244572403132u, 2381723531804u },
+  { 15792227074130287740u, 5448711433738248197u, 31260011382130u },
+  { 1988982590356776291u, 12641199846406813737u, 17778295375238u },
+  { 5073466107538340138u, 15031968058701224306u, 1414685280816u },
+  { 14595658118580548016u, 5512420273590935612u, 18992814884621u },
+  { 941448444501371959u, 15016047310179178196u, 1805298828901u },
+  { 8127161660994330862u, 14611094371241953142u, 1637814021555u },
+  { 8292691576031153734u, 18161973418992450924u, 11699792069012u },
+  { 2292209526038386909u, 16136842752334415295u, 16788984562551u },
+  { 7307481695510573288u, 8428261879898884159u, 887874779998u },
+  { 8919573504740483048u, 427163744377000304u, 31582456896992u },
+  { 10591914306600492283u, 18133690291208878376u, 24032023156592u },
+  { 1841491448367526173u, 8216147973992807705u, 6000983029320u },
+  { 8239745520774920689u, 2642844638019516667u, 13896445398274u },
+  { 13237266520178927258u, 16678094730186444795u, 3330143268894u },
+  { 17476100705217516617u, 17881523249794230839u, 12318904121326u },
+  { 10304616531271924007u, 13629342229085375045u, 30702969359317u },
+  { 9071244456804303703u, 13210443260614949229u, 3029738848122u },
+  { 6654031731482821872u, 2449007072574017723u, 32634716139564u },
+  { 17580815319366075195u, 7855652437551588358u, 12332132760939u },
+  { 3065052131487020673u, 17602326425457081972u, 32107425855771u },
+  { 18206524856374198273u, 10403568800782279176u, 31003954224027u },
+  { 2483155287104552961u, 14213733892224869786u, 7067563978594u },
+  { 15585306173849468929u, 4686440123407370389u, 28514770528058u },
+  { 11565498929785077761u, 2786847835008757492u, 10042254052428u },
+  { 5120592776320253953u, 15774751174054594985u, 19532151075323u },
+  { 11529215046068469761u, 12293144127751913906u, 12795855150974u },
+  { 1u, 9210502220027212352u, 8062666412678u },
+  { 1u, 15344061855423692800u, 4742499302325u },
+  { 1u, 16973151546382483456u, 31669831803259u },
+  { 1u, 473700988276965376u, 8571920116389u },
+  { 1u, 551941643004018688u, 27301025679382u },
+  { 1u, 7775464756655161344u, 2070029920816u },
+  { 1u, 1152921504606846976u, 27184421508789u },
+  { 1u, 0u, 5813062500000u },
+  { 1u, 0u, 32416000000000u },
+  { 1u, 0u, 16384000000000u },
+  { 3138241419126269406u, 440721283u, 0u },
+  { 4058923572937242631u, 440721283170124408u, 0u },
+  { 14509456511513385932u, 11689377117727893119u, 23891548u },
+  { 10483987021383928321u, 5573615327707145965u, 3676633682403u },
+  { 4514183645893091217u, 6362830259811330203u, 20963302146292u },
+  { 14642863624511008723u, 10001779276721838481u, 244344929719u },
+  { 12086125304004423742u, 500196847386014971u, 15799542197541u },
+  { 10637890455825493908u, 7937927040162428565u, 11557027115725u },
+  { 2646013451480719148u, 1822109481565357805u, 29389430315887u },
+  { 11548827236320600227u, 16989079705138609444u, 23407098776752u },
+  { 17781332092730659033u, 4464733211497815882u, 19632920979856u },
+  { 4265626489778160022u, 6893654443869913992u, 27024242033672u },
+  { 6667757777421282991u, 4065766281152938379u, 17416373705756u },
+  { 7274725823996683000u, 13691474144709910177u, 7196220405631u },
+  { 2410625194521686943u, 11274279502307822877u, 14207742216300u },
+  { 11943072089108144696u, 8864521312066135997u, 2156611179916u },
+  { 4761143823321418990u, 4229984937352377827u, 5516480546663u },
+  { 15459315232326450213u, 17209344240450367851u, 1895229307942u },
+  { 24523125459153540u, 11572742000227652438u, 15398932920420u },
+  { 5440819988236855754u, 16842857620008215801u, 14436627359600u },
+  { 10467564053512693757u, 2284574176604521586u, 10096913053141u },
+  { 6871076032055617808u, 5053397715646973160u, 30165123847014u },
+  { 1169320966220598014u, 1602776426344525554u, 21350273945239u },
+  { 10984318066951368330u, 3183251035022307672u, 3735086886684u },
+  { 10570399486858572765u, 7136968303064216531u, 28444172564384u },
+  { 7094364928616190328u, 17655754675011067688u, 14240386895826u },
+  { 7388515112910810993u, 14312921783468155445u, 20434957120378u },
+  { 15550497680181864817u, 11299806555567781102u, 13178775905044u },
+  { 7456150677843460483u, 14953422491222990328u, 8980612563740u },
+  { 3041080740649179186u, 10217254912957171026u, 17180810626657u },
+  { 5271772268411494430u, 12420523288841304549u, 18017553878498u },
+  { 5774364062815752965u, 12145838865906231091u, 3554673317916u },
+  { 1500700881034895851u, 4680318164314402599u, 22556658427244u },
+  { 14267583125656472777u, 1543110180559134661u, 25964253720556u },
+  { 880160180882291117u, 9358690719368040511u, 12268083652170u },
+  { 228568602469306789u, 8816397967831319339u, 9802507335640u },
+  { 14166359783853976078u, 9425827693105708872u, 14296477937891u },
+  { 12788908042232637976u, 2157568195316478814u, 12515510975143u },
+  { 2864747425799182045u, 4286797796325386398u, 31399116962006u },
+  { 2466080270206014286u, 3488331775574955485u, 30934232387774u },
+  { 5977667861516595858u, 8696333644583290575u, 20670189102844u },
+  { 1709157886930944938u, 9330352288020427368u, 26364471429191u },
+  { 13033791119927934527u, 670395575645755458u, 18503505799411u },
+  { 7330867507192762255u, 18022283012614742176u, 26867036342216u },
+  { 16142549409641162200u, 14227517313555248019u, 18376976989919u },
+  { 17881854144917060263u, 398198506470820812u, 32479771275259u },
+  { 11056977450097139663u, 5346002127318580711u, 12283021586384u },
+  { 11546326256739568907u, 508146445820912652u, 28624289807356u },
+  { 10868326166115077338u, 461003663573802416u, 15356027546674u },
+  { 537741216162814910u, 12516570736999723414u, 11314024991058u },
+  { 13649411107084649783u, 4725679038739852065u, 18770678524659u },
+  { 14249142722365183561u, 249914533022044474u, 10995256179574u },
+  { 14429363234440128404u, 18113043356400902486u, 15222013547893u },
+  { 5868326416354392587u, 15987785195166731396u, 21877981910047u },
+  { 8730389497443878989u, 1689126558419014260u, 5151866699572u },
+  { 18237636264943105246u, 3911501644840117218u, 16180091567734u },
+  { 17941059269099332968u, 937351999055340978u, 15990212042929u },
+  { 14986774169663052912u, 12690835287506088723u, 8369050813953u },
+  { 12265538774301131122u, 8642117585361945311u, 1537687971559u },
+  { 5351840968169723157u, 852795671714711261u, 26343468490133u },
+  { 4138102048829054606u, 18409228002197459560u, 23957046230145u },
+  { 10429030894573121335u, 12694558818532918577u, 31873997966249u },
+  { 11819402534032950416u, 9037436944992525105u, 2985688173412u },
+  { 4500268696633908055u, 8726837293146403287u, 2916489920438u },
+  { 16287545861907743362u, 11212714443130810102u, 32694473082797u },
+  { 7321202034186897921u, 17249566407149672958u, 18349607842467u },
+  { 9842010373587468289u, 12050015262384480469u, 29347935100868u },
+  { 7995191713998045185u, 5497811769035796675u, 8132653232636u },
+  { 5307851769877889025u, 3601713030613521843u, 12796298036973u },
+  { 122336061752868865u, 11492810877589244757u, 1773195249254u },
+  { 3620894100405878785u, 1334894880672465835u, 18022623026526u },
+  { 9223372036854775809u, 8914265169252978726u, 7518072364796u },
+  { 1u, 2412781015126204672u, 24316483243283u },
+  { 1u, 16907927604135854080u, 3347130797120u },
+  { 1u, 582661623752163328u, 19520916580592u },
+  { 1u, 16875106447933833216u, 26864031586149u },
+  { 1u, 10859603668659863552u, 22373914801353u },
+  { 1u, 9124292845052624896u, 29897588700294u },
+  { 1u, 4611686018427387904u, 29830494628906u },
+  { 1u, 0u, 11306250000000u },
+  { 1u, 0u, 22144000000000u },
+  { 16105764578170867313u, 6724u, 0u },
+  { 4789640137967142755u, 6724873095247u, 0u },
+  { 2774157292219835580u, 10258252416982858688u, 364u },
+  { 2805058115868180326u, 15124017020260858536u, 364556100977u },
+  { 2926001263883311190u, 9292149020256950825u, 9585819874605u },
+  { 6454163173365948792u, 13670547808946663134u, 29997503728407u },
+  { 13041201565617999884u, 12476385975098011190u, 19223741081881u },
+  { 8544898189331919616u, 17495761250558544345u, 10521676346238u },
+  { 499095508669105770u, 15811884619905328787u, 29566948447117u },
+  { 13629194593448681791u, 14749548012421961109u, 5005857163982u },
+  { 6866571903475395703u, 16830019933905838135u, 2766799574599u },
+  { 14089576522523423674u, 14125645420066589480u, 5703912357208u },
+  { 13946342412992318348u, 11248928007934717921u, 32088765752772u },
+  { 2207156295895089583u, 3999123909444218593u, 26052609805609u },
+  { 10168320316893799955u, 9830404118495707526u, 3369216792941u },
+  { 16698685230177433133u, 1552751233396819348u, 22893532907275u },
+  { 3883019953012795807u, 533459625314589732u, 1803084174813u },
+  { 8172861839224077723u, 4334414285144350069u, 5597028918904u },
+  { 1393301508910945735u, 4063549349824086224u, 9848234969069u },
+  { 2664243674890886580u, 12065400403337192210u, 2029220285451u },
+  { 320478245848617286u, 8490727532312396683u, 19467654066666u },
+  { 9577009451903165281u, 15232939898357073384u, 29162460283261u },
+  { 12606156149385409535u, 10274705531296479906u, 381825779326u },
+  { 3555759513201385611u, 17229694846968751462u, 1662556992902u },
+  { 8346175825943737390u, 4008312569853623645u, 30086934023629u },
+  { 2245152665662170409u, 14975301116396645754u, 19917217291059u },
+  { 16300047166130971304u, 3709495640947386769u, 23347811812700u },
+  { 8425909234620695495u, 11751189749081145151u, 1372201092161u },
+  { 15994647848436727974u, 14059340307863401902u, 1089637033272u },
+  { 4995101339916844974u, 5071490558333403757u, 9528762158365u },
+  { 4171821070689661805u, 1000551589374581722u, 19741274926054u },
+  { 7436375519522025451u, 6349134905478798713u, 27622054240010u },
+  { 12621079379607294004u, 16531659748157862852u, 7946344187292u },
+  { 2289453691629111325u, 12676530597133848964u, 17820896183070u },
+  { 5782353876745547503u, 11982532560860213933u, 17182687196100u },
+  { 14063337749074597118u, 13247472831467196175u, 29636649574391u },
+  { 18395168839490516223u, 3522803160250368410u, 24567718146941u },
+  { 17536649142277446250u, 18061437752470643844u, 29565190971541u },
+  { 16761878575696252410u, 8707212340910760422u, 8341979112502u },
+  { 6187139092475583803u, 15041513033182778842u, 9270472018926u },
+  { 5102388114807045880u, 7420938981520434602u, 3054815402055u },
+  { 17467237234436139924u, 5208273863954709685u, 22599402289908u },
+  { 15583216540524721138u, 16785770465564647771u, 31476282341091u },
+  { 6962676884075724206u, 5172659170249928821u, 14051909958440u },
+  { 3716560433267163867u, 9142242863270966830u, 31528280410415u },
+  { 14685385340388788513u, 12680735251818778696u, 18735495601978u },
+  { 9072388690447733388u, 8057021306884605774u, 24378687424035u },
+  { 7209313286470119867u, 4322337496068263176u, 1571436772000u },
+  { 6751061678924804704u, 3184614920862021496u, 15008234314385u },
+  { 17408109614927018617u, 14506848337426450666u, 6801172638320u },
+  { 3107973491347263246u, 3094889477073291929u, 10864786417824u },
+  { 10464894108811890796u, 13507987945737524476u, 10400167774294u },
+  { 7014013644286026723u, 15381476485461652358u, 18518732269493u },
+  { 10125307405790654681u, 1450121559278458665u, 26549833831511u },
+  { 5941507023580301810u, 4554290897204268862u, 5207078611247u },
+  { 2585907420308851384u, 4500844562381905677u, 10543246888604u },
+  { 2716507284096775398u, 11579050419802686770u, 20124243991272u },
+  { 17515572055799773125u, 432820685982957258u, 6888627701581u },
+  { 14042129320433390848u, 7415027179738099367u, 1869023463256u },
+  { 14329691251975215652u, 15966681066541229707u, 18264401969428u },
+  { 5938059251114281158u, 18195104872080403495u, 276865555514u },
+  { 374239378431008411u, 10063768545931337461u, 7226986358611u },
+  { 6571213681080375907u, 820918932432282181u, 26451545557986u },
+  { 8203093914929414317u, 9202676049547626143u, 3042044502104u },
+  { 3384140698242159078u, 5164955440108332724u, 24664498878068u },
+  { 15708104262992392340u, 8260709349022847914u, 13940279992795u },
+  { 6977633374840693093u, 2289138379252143222u, 25051447813951u },
+  { 3513774131222996993u, 3601837691939643223u, 26431124094440u },
+  { 6175360505445613569u, 9722482128342166685u, 15848195256012u },
+  { 14651618829419937793u, 5072917396656358771u, 28364527056812u },
+  { 4876046272017989633u, 2116149243790116600u, 14252275003403u },
+  { 1163758291210207233u, 6844481554588176118u, 28683114716680u },
+  { 6989586621679009793u, 10165505600021905255u, 7688371040088u },
+  { 1u, 14718021576747576458u, 28504551073162u },
+  { 1u, 7561552665065874432u, 9610797865548u },
+  { 1u, 6297697147637202944u, 23116409912591u },
+  { 1u, 8415423083120164864u, 15631341398846u },
+  { 1u, 8396537780938735616u, 11070456200999u },
+  { 1u, 3182426455434854400u, 32551455177225u },
+  { 1u, 15456353921135542272u, 14857172519683u },
+  { 1u, 0u, 2819837890625u },
+  { 1u, 0u, 4161000000000u },
+  { 1u, 0u, 18944000000000u },
+  { 598770359572115837u, 102613420u, 0u },
+  { 4305483574047142355u, 102613420032459406u, 0u },
+  { 4226671052077308583u, 11921540462811903388u, 5562684u },
+  { 15720140621549509148u, 8443546663331385448u, 24892646268003u },
+  { 12600607290143663843u, 14634374110169101634u, 7267457725581u },
+  { 17165106022713035502u, 2961588604514668129u, 29837793331010u },
+  { 709728801086595330u, 17545728162412441238u, 1858160548039u },
+  { 7391259029038204728u, 10632395565503704811u, 22727951155829u },
+  { 15390415266613931311u, 10002156882678339066u, 629576383318u },
+  { 6933114926932425557u, 1605508597904960307u, 15190542218011u },
+  { 5415793541789158578u, 9032184592935366193u, 29467087034795u },
+  { 3450251593839583840u, 16556529775140438244u, 22955489635707u },
+  { 12601386910891705497u, 10171722255181144881u, 11643897531277u },
+  { 4721616415599379160u, 6443956641899891065u, 19341551410168u },
+  { 14237259123740528842u, 9730895112967625514u, 7160349327589u },
+  { 11251177019260730133u, 1575423584597437667u, 229527512881u },
+  { 6734413525777286476u, 11995403745414602600u, 26417085403883u },
+  { 13893626110531805096u, 571174732588295048u, 21227650272140u },
+  { 11750495030895291636u, 5479657475026049476u, 19340030963444u },
+  { 255302693986517517u, 17431874865911328796u, 28404297052826u },
+  { 14260794353635751744u, 107474402343470706u, 12954944983830u },
+  { 18060189810386682682u, 467968190857491626u, 21270005826199u },
+  { 7306581702039577366u, 8468719053596077555u, 17047025368606u },
+  { 13645189798538877525u, 14829570309996911323u, 15902459090179u },
+  { 3276965937176395601u, 6571824786224568149u, 21763803912617u },
+  { 7607109964586895194u, 9609612307313309319u, 6569356259335u },
+  { 9169175935521290049u, 306705558563519025u, 28679520938127u },
+  { 8479959207342870922u, 11905480143462021767u, 26767016626541u },
+  { 14009930235017172691u, 14780046936904497973u, 2413645397371u },
+  { 15842038296166865139u, 16998289110762164255u, 32123801227949u },
+  { 15958900224649505158u, 2236697045053124632u, 21165921479099u },
+  { 12953671010612383617u, 14239508374947615890u, 10683121251589u },
+  { 10485540766716306243u, 14059868515203693192u, 13573771925295u },
+  { 17486721159867593990u, 8341975248733781919u, 5935762186999u },
+  { 10308672661578582511u, 6915197893244232509u, 8951452219384u },
+  { 13950743483734623531u, 17545233477015651416u, 14328374873628u },
+  { 11854867707176113180u, 11571430413267187927u, 19996951129012u },
+  { 2442895613864550556u, 11832777932478989282u, 11188627288499u },
+  { 10798037464824497905u, 859854094148897604u, 12723641456177u },
+  { 16549117636990267712u, 15584538270081455455u, 5681046612783u },
+  { 13598041178803545611u, 8859785838896878072u, 27439844839512u },
+  { 7015438625573786616u, 13178633065146988857u, 20568480289952u },
+  { 17326861383395735849u, 18097794031103509225u, 5280714415129u },
+  { 13127486674043263786u, 5273573188229548957u, 23577981083380u },
+  { 10396783820982000539u, 6861990474916736878u, 24308285880975u },
+  { 5138182658541635177u, 442320128801034396u, 14991371989249u },
+  { 939110527697472143u, 4224442404109634688u, 28929023978222u },
+  { 13220419719172197649u, 11137731946831269987u, 10990229007481u },
+  { 642591523526308042u, 12281537540778085061u, 11385603777658u },
+  { 5375375054155313942u, 2927386982056524812u, 25722665783484u },
+  { 10735615293356187600u, 5212559734266650609u, 20668158693966u },
+  { 3712761968168232298u, 7473113859396367607u, 21070282573429u },
+  { 10892391673702153161u, 1465662330831373805u, 18037405118314u },
+  { 14933464074609529599u, 2967660172424575911u, 28522079453714u },
+  { 11460856084543641999u, 5664471108763021829u, 530160877180u },
+  { 4986089188064195162u, 1938976321870898349u, 32380307071594u },
+  { 9136382060493780917u, 526083335791765364u, 25194105112117u },
+  { 17196927968026817160u, 14364344155833825319u, 1589028519034u },
+  { 2777532248940187394u, 77930725790563621u, 31866778692657u },
+  { 17016660324636261860u, 2034215816978413396u, 11313004224633u },
+  { 11454066937726458968u, 7445448169894978044u, 8313110275060u },
+  { 16304538294728193020u, 856259405382642948u, 9204403618554u },
+  { 477225254804269706u, 6942439247284270152u, 17146046417915u },
+  { 16623963762420415659u, 13147212023166898272u, 3067376350385u },
+  { 6028870737838350966u, 16274727726854882625u, 13489712711791u },
+  { 10697844435101014091u, 16663072075773788425u, 18543882254757u },
+  { 16093385409370038401u, 4460870390592054956u, 14757903306947u },
+  { 3214819937535739665u, 7983904592725007083u, 4291241824268u },
+  { 392881158472507393u, 4011658774656756378u, 20492432808335u },
+  { 5113911779440721921u, 17296951083721457618u, 6543217472457u },
+  { 1078066918344097793u, 2164084059451806961u, 13257937669597u },
+  { 13792099036473327617u, 17246689886320978828u, 19933117315231u },
+  { 17044435739737063425u, 2705199105376061074u, 30879934944932u },
+  { 16429131440647569409u, 6506690941780625320u, 5796146649137u },
+  { 1u, 13623203493051395048u, 6193352728422u },
+  { 1u, 3116056401352658944u, 24422738515341u },
+  { 1u, 18385792124762193920u, 21901168921755u },
+  { 1u, 4181922288964206592u, 19611996695788u },
+  { 1u, 10017085841446273024u, 11500226702461u },
+  { 1u, 10394589414947815424u, 27773543027311u },
+  { 1u, 5332261958806667264u, 4719563491821u },
+  { 1u, 0u, 18925289062500u },
+  { 1u, 0u, 16484000000000u },
+  { 1u, 0u, 26624000000000u },
+  { 184150331234437468u, 1565756531257u, 0u },
+  { 8474713092686451071u, 16230029065407647065u, 84u },
+  { 5794120790921920166u, 11268979530908588109u, 84879831638u },
+  { 8449508120909171510u, 8398592182943451853u, 29270610892604u },
+  { 1036371308003960763u, 9746397733838980849u, 22332455288594u },
+  { 3356881401853350818u, 15620721559122832937u, 32530528353279u },
+  { 7992594745361507513u, 9400582034686941513u, 15359846801012u },
+  { 6195499076501676102u, 4275757517036907461u, 24180509606573u },
+  { 16947995613663524548u, 8294247636849933813u, 685231789279u },
+  { 3328524238054767411u, 6461395910592585643u, 21727449632065u },
+  { 9287600978206088329u, 3277465786437613676u, 19777350272974u },
+  { 16371058402373231862u, 5444162732725091841u, 1998177671776u },
+  { 5294334883099648373u, 2015459160223423606u, 6752295128653u },
+  { 1957594231379699135u, 64606251342658309u, 3661109258260u },
+  { 17069658692001153555u, 16659120535676336819u, 26644003502311u },
+  { 16098219627031287435u, 15198424402827341523u, 14567903092733u },
+  { 11783880424925036632u, 14667106801873625242u, 24573823908237u },
+  { 15691846299990707074u, 17218470888281795005u, 31117795105452u },
+  { 8078335727205781829u, 3646492837611380660u, 6828933415177u },
+  { 5076337332452876123u, 15210346431419663905u, 265197676772u },
+  { 3795121212639809595u, 4798311068614465086u, 26852824554532u },
+  { 3311101640636405873u, 4476144302050520109u, 7204260116964u },
+  { 11158720710813389490u, 15349338236294030091u, 31204242652268u },
+  { 15516358093706912373u, 1849109400100467973u, 31852832089293u },
+  { 13152597312045147786u, 8072567488132073121u, 25805100240421u },
+  { 18028330693862283215u, 7534245381569551568u, 20005437614760u },
+  { 4217468969964562298u, 9902752818867785605u, 10920408432260u },
+  { 18101588051855813173u, 18265418239349722570u, 16004536829305u },
+  { 10385260996060334378u, 15181049292243774558u, 1401990170306u },
+  { 12689135463608569891u, 3007031305488345230u, 18114822966331u },
+  { 15317502939974014164u, 13044049173403156723u, 3131163011493u },
+  { 4217781047687235073u, 10894140560200439146u, 27045707119322u },
+  { 13808021808730803255u, 2519609804977766880u, 31450590572543u },
+  { 2539343062768485165u, 4033078983856257626u, 28671136588321u },
+  { 4924899063981720730u, 14852013390177731279u, 25121218633649u },
+  { 4095923277042463100u, 3149318605454646769u, 8113805129259u },
+  { 14114881457761429442u, 12804758719406947197u, 30251170724903u },
+  { 811938597809496634u, 1599072463025483881u, 31783694147361u },
+  { 10763574153933968117u, 16947001724000565423u, 7969086685891u },
+  { 1294992382511028153u, 5789512510588027260u, 17091918698804u },
+  { 13346806017787344098u, 1486388967014336845u, 6452313850102u },
+  { 209963244572403133u, 6636611676328753692u, 246080577307u },
+  { 5448711433738248198u, 16065546239078286706u, 7963359771439u },
+  { 12641199846406813738u, 13443068118389425542u, 31535870915006u },
+  { 15031968058701224307u, 17366168387386886704u, 12734728750182u },
+  { 5512420273590935613u, 12316846490780436237u, 17510941421874u },
+  { 15016047310179178197u, 3204762558153229925u, 28978667697586u },
+  { 14611094371241953143u, 7240286752342191539u, 13746173730526u },
+  { 18161973418992450925u, 5817569487036301716u, 24286392496731u },
+  { 16136842752334415296u, 15154129333497758583u, 12891315371073u },
+  { 8428261879898884160u, 5077078185598122846u, 31809821506997u },
+  { 427163744377000305u, 17251623686828449248u, 32181275228959u },
+  { 18133690291208878377u, 149227020557227888u, 31519935212394u },
+  { 8216147973992807706u, 18337618215715616328u, 11114008089612u },
+  { 2642844638019516668u, 7091510149678959874u, 5132994084275u },
+  { 16678094730186444796u, 9670643802242658334u, 32179384431535u },
+  { 17881523249794230840u, 18193072827214034926u, 13231524246650u },
+  { 13629342229085375046u, 3184327600656157653u, 29818986248454u },
+  { 13210443260614949230u, 2339932521065742202u, 14598172622745u },
+  { 2449007072574017724u, 2590809294167978028u, 16281126847996u },
+  { 7855652437551588359u, 4826183016162557291u, 17916140448053u },
+  { 17602326425457081973u, 10086761723642411291u, 26933261627905u },
+  { 10403568800782279177u, 13020388608239836059u, 29185546804448u },
+  { 14213733892224869787u, 14443010862637903714u, 23776705836680u },
+  { 4686440123407370390u, 13377352526475863866u, 30344782957187u },
+  { 2786847835008757493u, 10431249229400525900u, 19075725187733u },
+  { 15774751174054594986u, 14991479084325614075u, 23189565479153u },
+  { 12293144127751913907u, 11065124022527631230u, 6385812689709u },
+  { 9210502220027212353u, 3731777696781177478u, 21293599841575u },
+  { 15344061855423692801u, 5610673732075682741u, 23847202300074u },
+  { 16973151546382483457u, 8691928969451348347u, 8362304155232u },
+  { 473700988276965377u, 10854842279932258981u, 11872471190413u },
+  { 551941643004018689u, 1743273814993668118u, 2957588442179u },
+  { 7775464756655161345u, 16097761791670872624u, 11331094503062u },
+  { 1152921504606846977u, 6164631012187412149u, 24214872661415u },
+  { 1u, 14743658350051229344u, 7591334185316u },
+  { 1u, 12460398080097402880u, 2404799255320u },
+  { 1u, 7817557376784924672u, 4888675479533u },
+  { 1u, 10551811060799635456u, 28653423790634u },
+  { 1u, 14550367334964396032u, 2602572014823u },
+  { 1u, 13863205552953229312u, 25831788776993u },
+  { 1u, 16717361816799281152u, 3617751525878u },
+  { 1u, 0u, 27126906250000u },
+  { 1u, 0u, 25360000000000u },
+  { 1u, 0u, 8192000000000u },
+  { 11689377117727893120u, 23891548u, 0u },
+  { 5573615327707145966u, 23891548633682403u, 0u },
+  { 6362830259811330204u, 8238944519302512884u, 1295163u },
+  { 10001779276721838482u, 6286027332248911287u, 17211446634077u },
+  { 500196847386014972u, 9156529710624779557u, 9821340766224u },
+  { 7937927040162428566u, 4323412520594240205u, 4112496376470u },
+  { 1822109481565357806u, 6806208378361994095u, 14998234372662u },
+  { 16989079705138609445u, 9416247638783610032u, 6710368965295u },
+  { 4464733211497815883u, 6115733379167545744u, 4783510455807u },
+  { 6893654443869913993u, 14790201244338668552u, 1535331534570u },
+  { 4065766281152938380u, 562437013626985500u, 1770801778416u },
+  { 13691474144709910178u, 11123974150935885695u, 20208030489771u },
+  { 11274279502307822878u, 1030510643203901548u, 7339603031847u },
+  { 8864521312066135998u, 16722992302146655628u, 30503055864093u },
+  { 4229984937352377828u, 4100500183750346599u, 12573906555229u },
+  { 17209344240450367852u, 6916916512262994982u, 20829222288560u },
+  { 11572742000227652439u, 8758880652594329700u, 15536374966795u },
+  { 16842857620008215802u, 11145545910850398064u, 27147474819871u },
+  { 2284574176604521587u, 9298018546748126677u, 23327604201254u },
+  { 5053397715646973161u, 7558398166102299494u, 22310504046595u },
+  { 1602776426344525555u, 11251190985494793879u, 8195409741585u },
+  { 3183251035022307673u, 8783213473821028124u, 1809609928285u },
+  { 7136968303064216532u, 8965775170502211488u, 11869476138956u },
+  { 17655754675011067689u, 16486862026043543506u, 12236486035645u },
+  { 14312921783468155446u, 5631030086701167482u, 18621893754581u },
+  { 11299806555567781103u, 12297193745996161812u, 16085305258752u },
+  { 14953422491222990329u, 13728248668148515612u, 29440666632208u },
+  { 10217254912957171027u, 9617997187390457441u, 16744209851u },
+  { 12420523288841304550u, 5098869372565720546u, 23995521392672u },
+  { 12145838865906231092u, 10104716072592234524u, 24608276410262u },
+  { 4680318164314402600u, 16836061818389325164u, 28566547777755u },
+  { 1543110180559134662u, 18075926285797732332u, 18651912684739u },
+  { 9358690719368040512u, 8070207503465752138u, 17603979897927u },
+  { 8816397967831319340u, 7070994429849876440u, 27719437486825u },
+  { 9425827693105708873u, 2283833109793026275u, 2793383319376u },
+  { 2157568195316478815u, 17738319612117121703u, 22352123806840u },
+  { 4286797796325386399u, 18169686606761851094u, 17528961596232u },
+  { 3488331775574955486u, 11466470526171402430u, 31560984980684u },
+  { 8696333644583290576u, 14034319454541145852u, 27852621598612u },
+  { 9330352288020427369u, 1816164890687326279u, 20372760801982u },
+  { 670395575645755459u, 69265524766533875u, 12990098454496u },
+  { 18022283012614742177u, 11464858543059388360u, 14304003754891u },
+  { 14227517313555248020u, 18099930568206548703u, 2955621511226u },
+  { 398198506470820813u, 3584507478374264827u, 12346981199202u },
+  { 5346002127318580712u, 14152263865758609360u, 11618194316539u },
+  { 508146445820912653u, 8156769815283907580u, 23803767195761u },
+  { 461003663573802417u, 13092575967515323442u, 2161442179377u },
+  { 12516570736999723415u, 6836011762403297618u, 18737709749965u },
+  { 4725679038739852066u, 3628582693842725619u, 5837370580940u },
+  { 249914533022044475u, 18177040804706958198u, 24524196705861u },
+  { 18113043356400902487u, 9058223695590708597u, 30277985379356u },
+  { 15987785195166731397u, 8872073029829989407u, 9244491047290u },
+  { 1689126558419014261u, 12351687205040635700u, 24954480956042u },
+  { 3911501644840117219u, 1444809390327348854u, 4746669586305u },
+  { 937351999055340979u, 18281063520284483761u, 30593078323273u },
+  { 12690835287506088724u, 3724342979172566529u, 26697991018439u },
+  { 8642117585361945312u, 8393298459819009767u, 22471201897037u },
+  { 852795671714711262u, 4109020299005320597u, 14925455001621u },
+  { 18409228002197459561u, 13806101837217725569u, 2069222750436u },
+  { 12694558818532918578u, 5042945215360633769u, 30948748430280u },
+  { 9037436944992525106u, 16804411226311494500u, 3016273378607u },
+  { 8726837293146403288u, 17438373143924735926u, 15663910968957u },
+  { 11212714443130810103u, 6692547721635841965u, 24189945336102u },
+  { 17249566407149672959u, 17764669113019101859u, 20774362803738u },
+  { 12050015262384480470u, 5369339302956179396u, 28186963024642u },
+  { 5497811769035796676u, 15750654440029827580u, 6914291072466u },
+  { 3601713030613521844u, 1797446478114621165u, 32210853844688u },
+  { 11492810877589244758u, 15216987556348184166u, 22224097439768u },
+  { 1334894880672465836u, 6712390712027716958u, 28696824914548u },
+  { 8914265169252978727u, 11577151404196257532u, 8820363879429u },
+  { 2412781015126204673u, 3341803551819599123u, 25605627598635u },
+  { 16907927604135854081u, 10055859174736841792u, 22315181159533u },
+  { 582661623752163329u, 3189419561355864304u, 13421545129218u },
+  { 16875106447933833217u, 16039252755278157669u, 1282172898780u },
+  { 10859603668659863553u, 2136770613014852809u, 19932869489634u },
+  { 9124292845052624897u, 676890814385190022u, 29666115834567u },
+  { 4611686018427387905u, 10599411853602401322u, 21191036694324u },
+  { 1u, 17288593831004198528u, 28468574595267u },
+  { 1u, 9955930934115106816u, 10435937216549u },
+  { 1u, 7271002144398901248u, 10277539712097u },
+  { 1u, 1018306526491705344u, 3169394161816u },
+  { 1u, 7635545304950898688u, 30872055202507u },
+  { 1u, 7138205409382236160u, 17099413923740u },
+  { 1u, 11529215046068469760u, 10140386962890u },
+  { 1u, 0u, 11722625000000u },
+  { 1u, 0u, 8768000000000u },
+  { 15124017020260858537u, 364556100977u, 0u },
+  { 9292149020256950826u, 14067963577338393901u, 19u },
+  { 13670547808946663135u, 11987833700295232279u, 19762625833u },
+  { 12476385975098011191u, 1157564821789616409u, 15657649861767u },
+  { 17495761250558544346u, 13444999707600876414u, 29831062751714u },
+  { 15811884619905328788u, 11112172985081238413u, 2530728854894u },
+  { 14749548012421961110u, 10569810530998323918u, 17774602392104u },
+  { 16830019933905838136u, 432157407936452167u, 4648572990577u },
+  { 14125645420066589481u, 498436389338840408u, 13425023427300u },
+  { 11248928007934717922u, 14911426948331464132u, 8932027020290u },
+  { 3999123909444218594u, 11289286629309386025u, 13314808350074u },
+  { 9830404118495707527u, 8585846938949671277u, 1402611993454u },
+  { 1552751233396819349u, 3539240054795110155u, 2926465439695u },
+  { 533459625314589733u, 15086276895428384221u, 22479191862587u },
+  { 4334414285144350070u, 4373100781946775160u, 27963817828709u },
+  { 4063549349824086225u, 7641334842676479981u, 8549237066268u },
+  { 12065400403337192211u, 15789508886118288395u, 2588414237591u },
+  { 8490727532312396684u, 15503220643773215210u, 23447855950991u },
+  { 15232939898357073385u, 2306802766147092861u, 27791840431275u },
+  { 10274705531296479907u, 9732731949274302078u, 19627125052028u },
+  { 17229694846968751463u, 3340960519780464006u, 4732527612456u },
+  { 4008312569853623646u, 12667636658758471117u, 4648181113832u },
+  { 14975301116396645755u, 5241597110879083315u, 9192686713959u },
+  { 3709495640947386770u, 13750982959945975132u, 31847284147548u },
+  { 11751189749081145152u, 17510182991501919297u, 1372745442279u },
+  { 14059340307863401903u, 4713076077995320u, 9191949228922u },
+  { 5071490558333403758u, 6754138825162476829u, 23418000255496u },
+  { 1000551589374581723u, 6926614029468036070u, 10760366142599u },
+  { 6349134905478798714u, 17264140407302463242u, 13447375492498u },
+  { 16531659748157862853u, 14473418725401150876u, 5522935890926u },
+  { 12676530597133848965u, 4955079831783981854u, 17390784605601u },
+  { 11982532560860213934u, 17025700057891435460u, 28065268615415u },
+  { 13247472831467196176u, 10009639541620105207u, 18679922965049u },
+  { 3522803160250368411u, 15514935564819035005u, 14905542623646u },
+  { 18061437752470643845u, 4933964057061662869u, 16798841066342u },
+  { 8707212340910760423u, 8883627512403567670u, 21350267470727u },
+  { 15041513033182778843u, 7839816015800241134u, 17287481582412u },
+  { 7420938981520434603u, 14957794409124452423u, 25420424997277u },
+  { 5208273863954709686u, 12879759696803166964u, 27037810863659u },
+  { 16785770465564647772u, 4026219123777255139u, 11819698213172u },
+  { 5172659170249928822u, 831933496038128424u, 20788218261776u },
+  { 9142242863270966831u, 3475366245492345135u, 28944045099205u },
+  { 12680735251818778697u, 12493603011522682682u, 18629188399981u },
+  { 8057021306884605775u, 6700164817052829219u, 13165677279576u },
+  { 4322337496068263177u, 9831763923956546208u, 31064363216662u },
+  { 3184614920862021497u, 5274196415482534545u, 12054532980990u },
+  { 14506848337426450667u, 10866445785176386160u, 254285914760u },
+  { 3094889477073291930u, 6902947696630048928u, 8840589071206u },
+  { 13507987945737524477u, 8522495229499951190u, 21350374209544u },
+  { 15381476485461652359u, 2602092902237956021u, 30728462005392u },
+  { 1450121559278458666u, 16247433982783394903u, 29840141059738u },
+  { 4554290897204268863u, 1336068711258401071u, 1690880775161u },
+  { 4500844562381905678u, 17834558045405597340u, 5113072428429u },
+  { 11579050419802686771u, 16738188436991253224u, 9613966813328u },
+  { 432820685982957259u, 6325081030629066573u, 10384907379013u },
+  { 7415027179738099368u, 13424514135832053592u, 8517342883329u },
+  { 15966681066541229708u, 9805806462343119124u, 28161727744369u },
+  { 18195104872080403496u, 8711298243637091386u, 18801531573833u },
+  { 10063768545931337462u, 849005478996633427u, 22089472240424u },
+  { 820918932432282182u, 4408998975185226722u, 27432046024679u },
+  { 9202676049547626144u, 6808864300111454296u, 22503239012313u },
+  { 5164955440108332725u, 5847463286361142900u, 20441369109273u },
+  { 8260709349022847915u, 17157296797760086491u, 25369316991619u },
+  { 2289138379252143223u, 1946199918593304383u, 8835930098923u },
+  { 3601837691939643224u, 18289921372618702312u, 3307105503708u },
+  { 9722482128342166686u, 6255527309274279628u, 18908991498624u },
+  { 5072917396656358772u, 17300810161347049388u, 10624339112814u },
+  { 2116149243790116601u, 2482711717541965835u, 29550937878798u },
+  { 6844481554588176119u, 16430715468842343944u, 12558134588071u },
+  { 10165505600021905256u, 6281165097173774168u, 12967890710870u },
+  { 14718021576747576459u, 3777829102667703690u, 29014340502642u },
+  { 7561552665065874433u, 360899586823379532u, 1138204796526u },
+  { 6297697147637202945u, 14833976012226084111u, 26222019564405u },
+  { 8415423083120164865u, 17573641300485155646u, 21365804151450u },
+  { 8396537780938735617u, 15188118596864442151u, 12954952669003u },
+  { 3182426455434854401u, 17236563408043391497u, 5963823349558u },
+  { 15456353921135542273u, 12160827221836925699u, 32566934395974u },
+  { 1u, 12116242287960232001u, 23622659239764u },
+  { 1u, 10115477184738839040u, 28500656822810u },
+  { 1u, 17913083055990636544u, 6682548361116u },
+  { 1u, 4813057135950692352u, 22428971070178u },
+  { 1u, 2854265184216678400u, 29410260916350u },
+  { 1u, 12522997635717529600u, 6270154730025u },
+  { 1u, 2467972595799031808u, 27177678873062u },
+  { 1u, 9223372036854775808u, 8678133789062u },
+  { 1u, 0u, 29062500000000u },
+};
+
+constexpr uint32_t POW10[BLOCK_DIGITS + 1] = {
+  1u,       10u,       100u,       1000u,       10000u,
+  100000u,  1000000u,  10000000u,  100000000u,  1000000000u
+};
+
+// Count of decimal digits of x < 10^9, see decimal_length in itoa.cpp
+inline int
+decimal_length9(uint32_t x)
+{
+  const uint32_t t = ((32 - __builtin_clz(x | 1)) * 1233) >> 12;
+  return static_cast<int>(t + ((x | 1) >= POW10[t]));
+}
+
+// Write exactly count digits of x with leading zeros
+inline void
+write_digits(uint32_t x, uint32_t count, char8_t* buffer)
+{
+  char8_t* end = buffer + count;
+  for (; count >= 2; count -= 2) {
+    const uint32_t q = x / 100;
+    end -= 2;
+    memcpy(end, DIGIT_TABLE + (x - q * 100) * 2, 2);
+    x = q;
+  }
+  if (count != 0) {
+    end[-1] = u8'0' + static_cast<char8_t>(x);
+  }
+}
+
+// floor(m * mul / 2^j) mod 10^9, mul is 192-bit from the lowest part
+inline uint32_t
+mul_shift_mod1e9(uint64_t m, const uint64_t* mul, int j)
+{
+  assert(j >= 128 && j < 192);
+  using uint128_t = unsigned __int128;
+  const uint128_t b0 = static_cast<uint128_t>(m) * mul[0];
+  const uint128_t b1 = static_cast<uint128_t>(m) * mul[1];
+  const uint128_t b2 = static_cast<uint128_t>(m) * mul[2];
+  const uint128_t middle = b1 + static_cast<uint64_t>(b0 >> 64);
+  const uint128_t high =
+    (b2 + static_cast<uint64_t>(middle >> 64)) >> (j - 128);
+  // Fold the upper half with 2^64 mod 10^9
+  const uint64_t upper = static_cast<uint64_t>(high >> 64) % BLOCK;
+  const uint64_t lower = static_cast<uint64_t>(high) % BLOCK;
+  return static_cast<uint32_t>((upper * 709551616u + lower) % BLOCK);
+}
+
+/** Blocks of 9 decimal digits of m * 2^e.
+ */
+struct Blocks
+{
+  uint64_t m;
+  int32_t e;
+
+  Blocks(uint64_t mantissa, uint32_t exponent)
+  {
+    if (exponent == 0) {
+      m = mantissa;
+      e = 1 - EXPONENT_BIAS;
+    } else {
+      m = mantissa | (UINT64_C(1) << MANTISSA_BITS);
+      e = static_cast<int32_t>(exponent) - EXPONENT_BIAS;
+    }
+  }
+
+  int integer_row() const
+  {
+    return e <= 0 ? 0 : (e + EXPONENT_STEP - 1) / EXPONENT_STEP;
+  }
+
+  /** Blocks above the point, the highest ones may be zero.
+   */
+  int integer_count() const
+  {
+    if (e < -MANTISSA_BITS) {
+      return 0;
+    }
+    const int row = integer_row();
+    return POSITIVE_OFFSET[row + 1] - POSITIVE_OFFSET[row];
+  }
+
+  /** Block above the point, zero is the lowest.
+   */
+  uint32_t integer(int i) const
+  {
+    const int row = integer_row();
+    const int j = EXPONENT_STEP * row + ADDITIONAL_BITS - e;
+    return mul_shift_mod1e9(m, POSITIVE_SPLIT[POSITIVE_OFFSET[row] + i], j);
+  }
+
+  /** Blocks below the point up to the last nonzero one.
+   */
+  int fraction_count() const
+  {
+    if (e >= 0) {
+      return 0;
+    }
+    const int row = -e / EXPONENT_STEP;
+    return NEGATIVE_MIN_BLOCK[row] + NEGATIVE_OFFSET[row + 1] -
+           NEGATIVE_OFFSET[row];
+  }
+
+  /** Block below the point, zero is the highest, e < 0.
+   */
+  uint32_t fraction(int i) const
+  {
+    const int row = -e / EXPONENT_STEP;
+    const int first = NEGATIVE_MIN_BLOCK[row];
+    if (i < first) {
+      return 0;
+    }
+    const int j = ADDITIONAL_BITS - e - EXPONENT_STEP * row;
+    return mul_shift_mod1e9(m, NEGATIVE_SPLIT[NEGATIVE_OFFSET[row] + i - first],
+                            j);
+  }
+
+  /** Whether m * 2^e * 10^p is an integer, so no digits follow 10^-p.
+   */
+  bool exact(int32_t p) const
+  {
+    // 10^p brings p twos and p fives, or takes them for negative p
+    const int32_t twos = -e - p;
+    if (twos > 0 && (twos >= 64 || (m & ((UINT64_C(1) << twos) - 1)) != 0)) {
+      return false;
+    }
+    uint64_t rest = m;
+    for (int32_t fives = -p; fives > 0; --fives) {
+      if (rest % 5 != 0) {
+        return false;
+      }
+      rest /= 5;
+    }
+    return true;
+  }
+};
+
+// Decide rounding of kept digits by the next digit, ties go to even
+inline bool
+round_up(const Blocks& blocks, uint32_t next, char8_t last, int32_t p)
+{
+  if (next != 5) {
+    return next > 5;
+  }
+  return !blocks.exact(p) || ((last - u8'0') & 1) != 0;
+}
+
+// Add one to the digits, skipping the point, true if it carries out of them
+inline bool
+increment(char8_t* begin, char8_t* end)
+{
+  while (end != begin) {
+    --end;
+    if (*end == u8'.') {
+      continue;
+    }
+    if (*end != u8'9') {
+      ++*end;
+      return false;
+    }
+    *end = u8'0';
+  }
+  return true;
+}
+
+// inf and nan as printf writes them
+int
+write_special(bool sign, uint64_t mantissa, char8_t* buffer)
+{
+  *buffer = u8'-';
+  const char8_t* str = mantissa != 0 ? u8"nan" : u8"inf";
+  memcpy(buffer + sign, str, 3);
+  return sign + 3;
+}
+
+struct Decoded
+{
+  bool sign;
+  uint64_t mantissa;
+  uint32_t exponent;
+};
+
+inline Decoded
+decode(double x)
+{
+  uint64_t bits = 0;
+  memcpy(&bits, &x, sizeof(x));
+  return { (bits >> (MANTISSA_BITS + EXPONENT_BITS)) != 0,
+           bits & ((UINT64_C(1) << MANTISSA_BITS) - 1),
+           static_cast<uint32_t>((bits >> MANTISSA_BITS) & MAX_EXPONENT) };
+}
+}
+
+uint32_t
+dtoa_fixed_length(double x, uint32_t precision)
+{
+  // Integer part of x < 2^n rounds to at most 2^n
+  const Decoded d = decode(x);
+  const int32_t n = static_cast<int32_t>(d.exponent) - 1022;
+  const uint32_t digits =
+    n > 0 ? ((static_cast<uint32_t>(n) * 78913) >> 18) + 1 : 1;
+  return 2 + digits + precision;
+}
+
+int
+dtoa_fixed(double x, uint32_t precision, char8_t* buffer)
+{
+  const Decoded d = decode(x);
+  if (d.exponent == MAX_EXPONENT) {
+    return write_special(d.sign, d.mantissa, buffer);
+  }
+  char8_t* out = buffer;
+  if (d.sign) {
+    *out++ = u8'-';
+  }
+  char8_t* const begin = out;
+  if (d.exponent == 0 && d.mantissa == 0) {
+    *out++ = u8'0';
+    if (precision > 0) {
+      *out++ = u8'.';
+      memset(out, u8'0', precision);
+      out += precision;
+    }
+    return static_cast<int>(out - buffer);
+  }
+
+  const Blocks blocks(d.mantissa, d.exponent);
+  bool nonzero = false;
+  for (int i = blocks.integer_count() - 1; i >= 0; --i) {
+    const uint32_t digits = blocks.integer(i);
+    if (nonzero) {
+      write_digits(digits, BLOCK_DIGITS, out);
+      out += BLOCK_DIGITS;
+    } else if (digits != 0) {
+      const int length = decimal_length9(digits);
+      write_digits(digits, length, out);
+      out += length;
+      nonzero = true;
+    }
+  }
+  if (!nonzero) {
+    *out++ = u8'0';
+  }
+  char8_t* const point = out;
+  if (precision > 0) {
+    *out++ = u8'.';
+  }
+  const uint32_t full = precision / BLOCK_DIGITS;
+  const uint32_t count = static_cast<uint32_t>(blocks.fraction_count());
+  for (uint32_t i = 0; i < full && i < count; ++i) {
+    write_digits(blocks.fraction(i), BLOCK_DIGITS, out);
+    out += BLOCK_DIGITS;
+  }
+  if (full >= count) {
+    // The digits end before the last block, nothing to round
+    const uint32_t zeros = precision - count * BLOCK_DIGITS;
+    memset(out, u8'0', zeros);
+    return static_cast<int>(out + zeros - buffer);
+  }
+
+  // The last block is cut, its next digit rounds the kept ones
+  const uint32_t keep = precision - full * BLOCK_DIGITS;
+  const uint32_t digits = blocks.fraction(full);
+  write_digits(digits / POW10[BLOCK_DIGITS - keep], keep, out);
+  out += keep;
+  const uint32_t next = digits / POW10[BLOCK_DIGITS - 1 - keep] % 10;
+  const int32_t p = static_cast<int32_t>(precision) + 1;
+  if (round_up(blocks, next, out[-1], p) && increment(begin, out)) {
+    // All nines became zeros, one more integer digit
+    *begin = u8'1';
+    if (precision > 0) {
+      point[0] = u8'0';
+      point[1] = u8'.';
+    }
+    *out++ = u8'0';
+  }
+  return static_cast<int>(out - buffer);
+}
+
+int
+dtoa_exp(double x, uint32_t precision, char8_t* buffer)
+{
+  const Decoded d = decode(x);
+  if (d.exponent == MAX_EXPONENT) {
+    return write_special(d.sign, d.mantissa, buffer);
+  }
+  char8_t* out = buffer;
+  if (d.sign) {
+    *out++ = u8'-';
+  }
+
+  // Significant digits are written after the first char, the first digit
+  // moves before the point at the end
+  const uint32_t needed = precision + 1;
+  char8_t* const digits = out + 1;
+  int32_t exponent = 0;
+  if (d.exponent == 0 && d.mantissa == 0) {
+    memset(digits, u8'0', needed);
+  } else {
+    const Blocks blocks(d.mantissa, d.exponent);
+    const int integers = blocks.integer_count();
+    const int total = integers + blocks.fraction_count();
+    auto block = [&](int k) {
+      return k < integers ? blocks.integer(integers - 1 - k)
+                          : blocks.fraction(k - integers);
+    };
+
+    // The first nonzero block sets the exponent
+    int k = 0;
+    uint32_t rest = block(k);
+    while (rest == 0) {
+      rest = block(++k);
+    }
+    uint32_t length = static_cast<uint32_t>(decimal_length9(rest));
+    exponent =
+      BLOCK_DIGITS * (integers - 1 - k) + static_cast<int32_t>(length) - 1;
+    ++k;
+
+    uint32_t written = 0;
+    for (;;) {
+      if (length > needed - written) {
+        break;
+      }
+      write_digits(rest, length, digits + written);
+      written += length;
+      if (k == total) {
+        // The rest of the digits are zeros, nothing to round
+        memset(digits + written, u8'0', needed - written);
+        length = 0;
+        break;
+      }
+      rest = block(k++);
+      length = BLOCK_DIGITS;
+    }
+    if (length != 0) {
+      const uint32_t dropped = length - (needed - written);
+      write_digits(rest / POW10[dropped], needed - written, digits + written);
+      const uint32_t next = rest / POW10[dropped - 1] % 10;
+      const int32_t p = static_cast<int32_t>(needed) - exponent;
+      if (round_up(blocks, next, digits[needed - 1], p) &&
+          increment(digits, digits + needed)) {
+        digits[0] = u8'1';
+        ++exponent;
+      }
+    }
+  }
+
+  out[0] = digits[0];
+  out += 1;
+  if (precision > 0) {
+    out[0] = u8'.';
+    out += needed;
+  }
+  *out++ = u8'e';
+  *out++ = exponent < 0 ? u8'-' : u8'+';
+  const uint32_t e = static_cast<uint32_t>(exponent < 0 ? -exponent : exponent);
+  if (e >= 100) {
+    *out++ = u8'0' + static_cast<char8_t>(e / 100);
+  }
+  memcpy(out, DIGIT_TABLE + (e % 100) * 2, 2);
+  return static_cast<int>(out + 2 - buffer);
+}
+
+}
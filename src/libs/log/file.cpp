@@ -0,0 +1,250 @@
+/* extend - expansible programming language
+ * Copyright (C) 2022 Vladimir Liutov vs@lutov.net
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "file.h"
+
+#include <EASTL/algorithm.h>
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "posix.h"
+
+namespace extend::log {
+
+namespace {
+// Open pipes for crash handlers, which cannot take locks
+constexpr size_t MAX_PIPES = 16;
+eastl::atomic<MmapFilePipe*> live_pipes[MAX_PIPES];
+
+CrashChain crash_chain;
+
+void
+on_crash(int signal, siginfo_t* info, void* context)
+{
+  // SIGTERM handled by the application may not end the process, the files
+  // stay mapped and are truncated when the pipes are closed
+  if (signal != SIGTERM || !crash_chain.handled(signal)) {
+    for (auto& pipe : live_pipes) {
+      if (MmapFilePipe* p = pipe.load(eastl::memory_order_acquire)) {
+        p->truncate();
+      }
+    }
+  }
+  crash_chain.chain(signal, info, context);
+}
+
+size_t
+round_to_page(size_t size)
+{
+  const auto page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  return size == 0 ? page : (size + page - 1) / page * page;
+}
+
+eastl::fixed_string<char, 256>
+rotated_path(const char* path, unsigned index)
+{
+  eastl::fixed_string<char, 256> result(path);
+  if (index != 0) {
+    result.append_sprintf(".%u", index);
+  }
+  return result;
+}
+}
+
+MmapFilePipe::MmapFilePipe(const char* p,
+                           size_t max_size,
+                           unsigned count,
+                           size_t segment,
+                           Prefix line_prefix)
+  : path(p)
+  , file_size(max_size)
+  , file_count(count == 0 ? 1 : count)
+  , segment_size(round_to_page(segment))
+  , prefix(line_prefix)
+{
+  EA::Thread::AutoFutex guard(lock);
+  open_file();
+  for (auto& pipe : live_pipes) {
+    MmapFilePipe* expected = nullptr;
+    if (pipe.compare_exchange_strong(expected, this)) {
+      break;
+    }
+  }
+}
+
+MmapFilePipe::~MmapFilePipe()
+{
+  for (auto& pipe : live_pipes) {
+    MmapFilePipe* expected = this;
+    if (pipe.compare_exchange_strong(expected, nullptr)) {
+      break;
+    }
+  }
+  EA::Thread::AutoFutex guard(lock);
+  close_file();
+}
+
+void
+MmapFilePipe::log(LEVEL level, eastl::u8string_view str)
+{
+  char8_t head[Prefix::MAX_SIZE];
+  const size_t head_size = prefix.write(level, head);
+  log_prefixed(level, { head, head_size }, str);
+}
+
+void
+MmapFilePipe::log_prefixed(LEVEL,
+                           eastl::u8string_view head,
+                           eastl::u8string_view str)
+{
+  const size_t length = head.size() + str.size() + 1;
+  EA::Thread::AutoFutex guard(lock);
+  const size_t written = size.load(eastl::memory_order_relaxed);
+  if (written != 0 && written + length > file_size) {
+    rotate();
+  }
+  if (!is_open()) {
+    return;
+  }
+
+  write(head.data(), head.size());
+  write(str.data(), str.size());
+  write(u8"\n", 1);
+  committed.store(size.load(eastl::memory_order_relaxed),
+                  eastl::memory_order_release);
+}
+
+void
+MmapFilePipe::flush()
+{
+  EA::Thread::AutoFutex guard(lock);
+  if (segment != nullptr) {
+    msync(segment, segment_size, MS_ASYNC);
+  }
+}
+
+bool
+MmapFilePipe::is_open() const
+{
+  return fd.load(eastl::memory_order_relaxed) >= 0;
+}
+
+void
+MmapFilePipe::truncate()
+{
+  const int f = fd.load(eastl::memory_order_acquire);
+  if (f >= 0) {
+    ftruncate(f, committed.load(eastl::memory_order_acquire));
+  }
+}
+
+void
+MmapFilePipe::install_crash_handlers()
+{
+  crash_chain.install(on_crash);
+}
+
+void
+MmapFilePipe::open_file()
+{
+  const int f = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+  struct stat info;
+  if (f < 0 || fstat(f, &info) != 0) {
+    if (f >= 0) {
+      ::close(f);
+    }
+    return;
+  }
+  size.store(info.st_size, eastl::memory_order_relaxed);
+  committed.store(info.st_size, eastl::memory_order_relaxed);
+  fd.store(f, eastl::memory_order_release);
+}
+
+void
+MmapFilePipe::close_file()
+{
+  if (segment != nullptr) {
+    munmap(segment, segment_size);
+    segment = nullptr;
+  }
+  const int f = fd.exchange(-1, eastl::memory_order_acq_rel);
+  if (f >= 0) {
+    ftruncate(f, size.load(eastl::memory_order_relaxed));
+    ::close(f);
+  }
+}
+
+void
+MmapFilePipe::rotate()
+{
+  close_file();
+  for (unsigned i = file_count - 1; i != 0; --i) {
+    rename(rotated_path(path.c_str(), i - 1).c_str(),
+           rotated_path(path.c_str(), i).c_str());
+  }
+  if (file_count == 1) {
+    unlink(path.c_str());
+  }
+  open_file();
+}
+
+bool
+MmapFilePipe::map(size_t offset)
+{
+  if (segment != nullptr) {
+    munmap(segment, segment_size);
+    segment = nullptr;
+  }
+  const int f = fd.load(eastl::memory_order_relaxed);
+  if (posix_fallocate(f, offset, segment_size) != 0) {
+    return false;
+  }
+  void* data =
+    mmap(nullptr, segment_size, PROT_READ | PROT_WRITE, MAP_SHARED, f, offset);
+  if (data == MAP_FAILED) {
+    return false;
+  }
+  segment = static_cast<char8_t*>(data);
+  segment_offset = offset;
+  return true;
+}
+
+void
+MmapFilePipe::write(const char8_t* data, size_t count)
+{
+  size_t written = size.load(eastl::memory_order_relaxed);
+  while (count != 0) {
+    if (segment == nullptr || written >= segment_offset + segment_size) {
+      if (!map(written / segment_size * segment_size)) {
+        close_file();
+        return;
+      }
+    }
+    const size_t offset = written - segment_offset;
+    const size_t chunk = eastl::min(count, segment_size - offset);
+    memcpy(segment + offset, data, chunk);
+    data += chunk;
+    count -= chunk;
+    written += chunk;
+    size.store(written, eastl::memory_order_release);
+  }
+}
+
+}
@@ -0,0 +1,111 @@
+/* extend - expansible programming language
+ * Copyright (C) 2022 Vladimir Liutov vs@lutov.net
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <EASTL/atomic.h>
+#include <EASTL/fixed_string.h>
+#include <eathread/eathread_futex.h>
+
+#include "log.h"
+
+namespace extend::log {
+
+/** Write logs to memory mapped file with rotation.
+ *
+ * Lines are copied into a mapped segment of the file, there is no syscall
+ * per line. Segments are allocated on disk before mapping, so a full disk
+ * drops lines instead of SIGBUS. When the next line does not fit into the
+ * file size, files are rotated: path.N-1 becomes path.N, ..., path becomes
+ * path.1 and the oldest one is removed. Closed file is truncated to the
+ * written size, install_crash_handlers() does the same on fatal signals.
+ */
+struct MmapFilePipe : IPipe
+{
+  static constexpr size_t DEFAULT_FILE_SIZE = 64 << 20;
+  static constexpr unsigned DEFAULT_FILE_COUNT = 4;
+  static constexpr size_t DEFAULT_SEGMENT_SIZE = 1 << 20;
+
+  /** Open the file and append to it.
+   *
+   * @param path         File path, rotated files get a numeric suffix.
+   * @param file_size    Size to rotate at.
+   * @param file_count   Count of files to keep, including the current one.
+   * @param segment_size Size of mapping, rounded up to page size.
+   * @param prefix       Fields written before each line.
+   */
+  explicit MmapFilePipe(const char* path,
+                        size_t file_size = DEFAULT_FILE_SIZE,
+                        unsigned file_count = DEFAULT_FILE_COUNT,
+                        size_t segment_size = DEFAULT_SEGMENT_SIZE,
+                        Prefix prefix = {});
+
+  /** Unmap and truncate the file.
+   */
+  virtual ~MmapFilePipe() override;
+
+  virtual void log(LEVEL level, eastl::u8string_view str) override;
+
+  virtual void log_prefixed(LEVEL level,
+                            eastl::u8string_view head,
+                            eastl::u8string_view str) override;
+
+  /** Schedule write back of the current segment.
+   */
+  virtual void flush() override;
+
+  /** False if the file cannot be opened or mapped, lines are dropped.
+   */
+  bool is_open() const;
+
+  /** Truncate the file after the last complete line, async-signal-safe.
+   *
+   * For crash handlers: the mapped tail is cut off, so nothing should be
+   * logged after the call. A line being written by another thread is left
+   * out rather than cut.
+   */
+  void truncate();
+
+  /** Truncate every open MmapFilePipe on fatal signals and SIGTERM, then
+   * pass the signal to the handler installed before. SIGTERM with a
+   * handler of the application does not truncate, the process may go on.
+   */
+  static void install_crash_handlers();
+
+  const eastl::fixed_string<char, 256> path;
+  const size_t file_size;
+  const unsigned file_count;
+  const size_t segment_size;
+  const Prefix prefix;
+
+private:
+  void open_file();
+  void close_file();
+  void rotate();
+  bool map(size_t offset);
+  void write(const char8_t* data, size_t count);
+
+  EA::Thread::Futex lock;
+  eastl::atomic<int> fd{ -1 };
+  char8_t* segment = nullptr;
+  size_t segment_offset = 0;
+  eastl::atomic<size_t> size{ 0 };
+  /** Size up to the end of the last complete line. */
+  eastl::atomic<size_t> committed{ 0 };
+};
+
+}
@@ -0,0 +1,170 @@
+/* extend - expansible programming language
+ * Copyright (C) 2022 Vladimir Liutov vs@lutov.net
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "dtoa.h"
+
+#include <cstring>
+
+namespace extend::log {
+
+// A table of all two-digit numbers. This is used to speed up decimal digit
+// generation by copying pairs of digits into the final output.
+const char8_t DIGIT_TABLE[200] = {
+  u8'0', u8'0', u8'0', u8'1', u8'0', u8'2', u8'0', u8'3', u8'0', u8'4', u8'0',
+  u8'5', u8'0', u8'6', u8'0', u8'7', u8'0', u8'8', u8'0', u8'9', u8'1', u8'0',
+  u8'1', u8'1', u8'1', u8'2', u8'1', u8'3', u8'1', u8'4', u8'1', u8'5', u8'1',
+  u8'6', u8'1', u8'7', u8'1', u8'8', u8'1', u8'9', u8'2', u8'0', u8'2', u8'1',
+  u8'2', u8'2', u8'2', u8'3', u8'2', u8'4', u8'2', u8'5', u8'2', u8'6', u8'2',
+  u8'7', u8'2', u8'8', u8'2', u8'9', u8'3', u8'0', u8'3', u8'1', u8'3', u8'2',
+  u8'3', u8'3', u8'3', u8'4', u8'3', u8'5', u8'3', u8'6', u8'3', u8'7', u8'3',
+  u8'8', u8'3', u8'9', u8'4', u8'0', u8'4', u8'1', u8'4', u8'2', u8'4', u8'3',
+  u8'4', u8'4', u8'4', u8'5', u8'4', u8'6', u8'4', u8'7', u8'4', u8'8', u8'4',
+  u8'9', u8'5', u8'0', u8'5', u8'1', u8'5', u8'2', u8'5', u8'3', u8'5', u8'4',
+  u8'5', u8'5', u8'5', u8'6', u8'5', u8'7', u8'5', u8'8', u8'5', u8'9', u8'6',
+  u8'0', u8'6', u8'1', u8'6', u8'2', u8'6', u8'3', u8'6', u8'4', u8'6', u8'5',
+  u8'6', u8'6', u8'6', u8'7', u8'6', u8'8', u8'6', u8'9', u8'7', u8'0', u8'7',
+  u8'1', u8'7', u8'2', u8'7', u8'3', u8'7', u8'4', u8'7', u8'5', u8'7', u8'6',
+  u8'7', u8'7', u8'7', u8'8', u8'7', u8'9', u8'8', u8'0', u8'8', u8'1', u8'8',
+  u8'2', u8'8', u8'3', u8'8', u8'4', u8'8', u8'5', u8'8', u8'6', u8'8', u8'7',
+  u8'8', u8'8', u8'8', u8'9', u8'9', u8'0', u8'9', u8'1', u8'9', u8'2', u8'9',
+  u8'3', u8'9', u8'4', u8'9', u8'5', u8'9', u8'6', u8'9', u8'7', u8'9', u8'8',
+  u8'9', u8'9'
+};
+
+namespace {
+constexpr uint32_t POW10_32[10] = { 1U,         10U,        100U,
+                                    1000U,      10000U,     100000U,
+                                    1000000U,   10000000U,  100000000U,
+                                    1000000000U };
+
+constexpr uint64_t POW10_64[20] = { 1ULL,
+                                    10ULL,
+                                    100ULL,
+                                    1000ULL,
+                                    10000ULL,
+                                    100000ULL,
+                                    1000000ULL,
+                                    10000000ULL,
+                                    100000000ULL,
+                                    1000000000ULL,
+                                    10000000000ULL,
+                                    100000000000ULL,
+                                    1000000000000ULL,
+                                    10000000000000ULL,
+                                    100000000000000ULL,
+                                    1000000000000000ULL,
+                                    10000000000000000ULL,
+                                    100000000000000000ULL,
+                                    1000000000000000000ULL,
+                                    10000000000000000000ULL };
+
+// Count of decimal digits without a loop: 1233 / 4096 ~ log10(2) turns bit
+// length into digit count, which is off by at most one. Zero has one digit,
+// "| 1" makes it compare as one and does not change other results, because
+// powers of ten above one are even.
+inline int
+decimal_length(uint32_t x)
+{
+  const uint32_t t = ((32 - __builtin_clz(x | 1)) * 1233) >> 12;
+  return static_cast<int>(t + ((x | 1) >= POW10_32[t]));
+}
+
+inline int
+decimal_length(uint64_t x)
+{
+  const uint32_t t = ((64 - __builtin_clzll(x | 1)) * 1233) >> 12;
+  return static_cast<int>(t + ((x | 1) >= POW10_64[t]));
+}
+
+// Write digits of x backward, ending right before end.
+inline void
+write_digits(uint32_t x, char8_t* end)
+{
+  while (x >= 100) {
+    const uint32_t q = x / 100;
+    end -= 2;
+    memcpy(end, DIGIT_TABLE + (x - q * 100) * 2, 2);
+    x = q;
+  }
+  if (x >= 10) {
+    memcpy(end - 2, DIGIT_TABLE + x * 2, 2);
+  } else {
+    end[-1] = u8'0' + static_cast<char8_t>(x);
+  }
+}
+
+// Exactly 8 digits with leading zeros.
+inline void
+write_digits8(uint32_t x, char8_t* end)
+{
+  for (int i = 0; i < 4; ++i) {
+    const uint32_t q = x / 100;
+    end -= 2;
+    memcpy(end, DIGIT_TABLE + (x - q * 100) * 2, 2);
+    x = q;
+  }
+}
+
+inline void
+write_digits(uint64_t x, char8_t* end)
+{
+  // Keep divisions 32-bit, 64-bit value has at most two 8 digit tails
+  while (x > UINT32_MAX) {
+    const uint64_t q = x / 100000000;
+    write_digits8(static_cast<uint32_t>(x - q * 100000000), end);
+    end -= 8;
+    x = q;
+  }
+  write_digits(static_cast<uint32_t>(x), end);
+}
+}
+
+int
+utoa(uint32_t x, char8_t* buffer)
+{
+  const int length = decimal_length(x);
+  write_digits(x, buffer + length);
+  return length;
+}
+
+int
+utoa(uint64_t x, char8_t* buffer)
+{
+  const int length = decimal_length(x);
+  write_digits(x, buffer + length);
+  return length;
+}
+
+int
+itoa(int32_t x, char8_t* buffer)
+{
+  const bool sign = x < 0;
+  *buffer = u8'-';
+  const uint32_t u = sign ? 0U - static_cast<uint32_t>(x) : x;
+  return sign + utoa(u, buffer + sign);
+}
+
+int
+itoa(int64_t x, char8_t* buffer)
+{
+  const bool sign = x < 0;
+  *buffer = u8'-';
+  const uint64_t u = sign ? 0ULL - static_cast<uint64_t>(x) : x;
+  return sign + utoa(u, buffer + sign);
+}
+
+} // namespace extend::log
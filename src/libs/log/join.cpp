@@ -0,0 +1,105 @@
+/* extend - expansible programming language
+ * Copyright (C) 2022 Vladimir Liutov vs@lutov.net
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "join.h"
+
+#include "dtoa.h"
+#include "log.h"
+#include "write_join.h"
+
+namespace extend::log {
+
+namespace {
+template<typename T>
+int
+write_scalar(T x, char8_t* buffer)
+{
+  if constexpr (eastl::is_same_v<T, float>) {
+    return ftoa(x, buffer);
+  } else if constexpr (eastl::is_same_v<T, double>) {
+    return dtoa(x, buffer);
+  } else if constexpr (sizeof(T) == 8) {
+    if constexpr (eastl::is_signed_v<T>) {
+      return itoa(static_cast<int64_t>(x), buffer);
+    } else {
+      return utoa(static_cast<uint64_t>(x), buffer);
+    }
+  } else if constexpr (eastl::is_signed_v<T>) {
+    return itoa(static_cast<int32_t>(x), buffer);
+  } else {
+    return utoa(static_cast<uint32_t>(x), buffer);
+  }
+}
+}
+
+template<typename T>
+size_t
+write_join(const Join<T>& j, char8_t* buffer)
+{
+  return write_join_with<T, write_scalar<T>>(j, buffer);
+}
+
+template<typename T>
+void
+OStream::append(const Join<T>& j)
+{
+  if constexpr (eastl::is_floating_point_v<T>) {
+    if (float_format.notation != NOTATION::SHORTEST) {
+      // Precision bounds no length, format elements one by one
+      for (size_t i = 0; i < j.values.size(); ++i) {
+        if (i != 0) {
+          append(j.separator);
+        }
+        append(j.values[i]);
+      }
+      return;
+    }
+  }
+  const size_t size = line.size();
+  line.resize(size + join_capacity(j));
+  line.resize(size + write_join(j, line.data() + size));
+}
+
+template<typename T>
+void
+OStream::encode(const Join<T>& j)
+{
+  for (size_t i = 0; i < j.values.size(); ++i) {
+    if (i != 0) {
+      encode(j.separator);
+    }
+    encode(j.values[i]);
+  }
+}
+
+#define EXTEND_LOG_JOIN(T)                                                     \
+  template size_t write_join<T>(const Join<T>& j, char8_t* buffer);            \
+  template void OStream::append<T>(const Join<T>& j);                          \
+  template void OStream::encode<T>(const Join<T>& j);
+
+EXTEND_LOG_JOIN(int8_t)
+EXTEND_LOG_JOIN(int16_t)
+EXTEND_LOG_JOIN(int32_t)
+EXTEND_LOG_JOIN(int64_t)
+EXTEND_LOG_JOIN(uint8_t)
+EXTEND_LOG_JOIN(uint16_t)
+EXTEND_LOG_JOIN(uint32_t)
+EXTEND_LOG_JOIN(uint64_t)
+EXTEND_LOG_JOIN(float)
+EXTEND_LOG_JOIN(double)
+
+}
@@ -0,0 +1,116 @@
+/* extend - expansible programming language
+ * Copyright (C) 2022 Vladimir Liutov vs@lutov.net
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/** Bulk formatting of number arrays.
+ *
+ * The whole array is written into one buffer sized once up front, instead
+ * of growing the line and formatting each element on its own.
+ */
+
+#pragma once
+
+#include <EASTL/span.h>
+#include <EASTL/string_view.h>
+#include <EASTL/type_traits.h>
+#include <cinttypes>
+
+namespace extend::log {
+
+/** Elements of arrays joined with separator.
+ */
+template<typename T>
+struct Join
+{
+  eastl::span<const T> values;
+  eastl::u8string_view separator;
+};
+
+/** Most chars of one formatted element, dtoa and ftoa need them all as
+ * scratch space.
+ */
+template<typename T>
+constexpr size_t JOIN_ELEMENT_SIZE = 0;
+template<>
+constexpr size_t JOIN_ELEMENT_SIZE<int8_t> = 4;
+template<>
+constexpr size_t JOIN_ELEMENT_SIZE<int16_t> = 6;
+template<>
+constexpr size_t JOIN_ELEMENT_SIZE<int32_t> = 11;
+template<>
+constexpr size_t JOIN_ELEMENT_SIZE<int64_t> = 20;
+template<>
+constexpr size_t JOIN_ELEMENT_SIZE<uint8_t> = 3;
+template<>
+constexpr size_t JOIN_ELEMENT_SIZE<uint16_t> = 5;
+template<>
+constexpr size_t JOIN_ELEMENT_SIZE<uint32_t> = 10;
+template<>
+constexpr size_t JOIN_ELEMENT_SIZE<uint64_t> = 20;
+template<>
+constexpr size_t JOIN_ELEMENT_SIZE<float> = 16;
+template<>
+constexpr size_t JOIN_ELEMENT_SIZE<double> = 25;
+
+/** Fixed width integers, float and double can be joined.
+ */
+template<typename T>
+constexpr bool JOINABLE = JOIN_ELEMENT_SIZE<T> != 0;
+
+/** Chars past the last element that block stores may overwrite.
+ */
+constexpr size_t JOIN_SLACK = 16;
+
+/** Array argument: info << join(values, u8" ");
+ *
+ * Range is anything with data() and size(), e.g. eastl::vector or
+ * eastl::span. Text format writes "1, 2, 3", binary keeps the elements.
+ */
+template<typename Range>
+Join<typename Range::value_type>
+join(const Range& values, eastl::u8string_view separator = u8", ")
+{
+  using T = typename Range::value_type;
+  static_assert(JOINABLE<T>, "join formats integers, float and double");
+  return { eastl::span<const T>(values.data(), values.size()), separator };
+}
+
+/** Size of buffer for write_join.
+ */
+template<typename T>
+size_t
+join_capacity(const Join<T>& j)
+{
+  return j.values.size() * (JOIN_ELEMENT_SIZE<T> + j.separator.size()) +
+         JOIN_SLACK;
+}
+
+/** Format elements separated by the separator.
+ *
+ * Integers are written by SIMD blocks of up to 16 digits where SSE4.1 is
+ * available, floats use dtoa and ftoa. The engine is write_join_with() of
+ * write_join.h.
+ *
+ * @param  j      Elements and separator.
+ * @param  buffer At least join_capacity(j) chars, contents past the result
+ *                are unspecified.
+ * @return        Count of written chars.
+ */
+template<typename T>
+size_t
+write_join(const Join<T>& j, char8_t* buffer);
+
+}
@@ -0,0 +1,150 @@
+/* extend - expansible programming language
+ * Copyright (C) 2022 Vladimir Liutov vs@lutov.net
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "json.h"
+
+#include <cerrno>
+#include <unistd.h>
+
+#include "binary.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace extend::log {
+
+namespace {
+constexpr char8_t HEX_DIGITS[] = u8"0123456789abcdef";
+
+// Escape of chars below 0x20, quote and backslash
+void
+escape(char8_t c, JsonLine& out)
+{
+  out.push_back(u8'\\');
+  switch (c) {
+    case u8'"':
+    case u8'\\':
+      out.push_back(c);
+      break;
+    case u8'\b':
+      out.push_back(u8'b');
+      break;
+    case u8'\f':
+      out.push_back(u8'f');
+      break;
+    case u8'\n':
+      out.push_back(u8'n');
+      break;
+    case u8'\r':
+      out.push_back(u8'r');
+      break;
+    case u8'\t':
+      out.push_back(u8't');
+      break;
+    default:
+      out.append(u8"u00", 3);
+      out.push_back(HEX_DIGITS[c >> 4]);
+      out.push_back(HEX_DIGITS[c & 0xF]);
+  }
+}
+
+inline bool
+needs_escape(char8_t c)
+{
+  return c < 0x20 || c == u8'"' || c == u8'\\';
+}
+}
+
+void
+json_escape(eastl::u8string_view str, JsonLine& out)
+{
+  const char8_t* it = str.data();
+  const char8_t* const end = str.data() + str.size();
+#ifdef __SSE2__
+  const __m128i control = _mm_set1_epi8(0x1F);
+  const __m128i quote = _mm_set1_epi8('"');
+  const __m128i backslash = _mm_set1_epi8('\\');
+  while (end - it >= 16) {
+    const __m128i chunk =
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+    // Unsigned chunk <= 0x1F is max(chunk, 0x1F) == 0x1F
+    const __m128i special = _mm_or_si128(
+      _mm_cmpeq_epi8(_mm_max_epu8(chunk, control), control),
+      _mm_or_si128(_mm_cmpeq_epi8(chunk, quote),
+                   _mm_cmpeq_epi8(chunk, backslash)));
+    const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(special));
+    if (mask == 0) {
+      out.append(it, 16);
+      it += 16;
+      continue;
+    }
+    const int run = __builtin_ctz(mask);
+    out.append(it, run);
+    escape(it[run], out);
+    it += run + 1;
+  }
+#endif
+  while (it != end) {
+    const char8_t* run = it;
+    while (it != end && !needs_escape(*it)) {
+      ++it;
+    }
+    out.append(run, it - run);
+    if (it != end) {
+      escape(*it++, out);
+    }
+  }
+}
+
+JsonPipe::JsonPipe(int f)
+  : fd(f)
+{
+  describe_sites();
+}
+
+void
+JsonPipe::log(LEVEL level, eastl::u8string_view str)
+{
+  JsonLine json;
+  if (!to_json(level, str, json)) {
+    return;
+  }
+  json.push_back(u8'\n');
+
+  const char8_t* data = json.data();
+  size_t size = json.size();
+  while (size != 0) {
+    const ssize_t written = ::write(fd, data, size);
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return;
+    }
+    data += written;
+    size -= written;
+  }
+}
+
+FORMAT
+JsonPipe::format() const
+{
+  return FORMAT::BINARY;
+}
+
+}
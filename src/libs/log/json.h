@@ -0,0 +1,56 @@
+/* extend - expansible programming language
+ * Copyright (C) 2022 Vladimir Liutov vs@lutov.net
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/** NDJSON output of structured logs.
+ *
+ * Streams to JsonPipe use binary format, see binary.h, and the pipe turns
+ * every line into one JSON object, so fields are never parsed from text.
+ */
+
+#pragma once
+
+#include <EASTL/fixed_string.h>
+
+#include "log.h"
+
+namespace extend::log {
+
+using JsonLine = eastl::fixed_string<char8_t, 1024>;
+
+/** Append str to out as contents of JSON string.
+ *
+ * Quotes, backslashes and control chars are escaped, the rest is copied by
+ * runs found 16 bytes at a time.
+ */
+void
+json_escape(eastl::u8string_view str, JsonLine& out);
+
+/** Write logs as NDJSON to file descriptor.
+ *
+ * Every line is a JSON object written with single write call, see to_json.
+ */
+struct JsonPipe : IPipe
+{
+  explicit JsonPipe(int fd);
+
+  virtual void log(LEVEL level, eastl::u8string_view str) override;
+  virtual FORMAT format() const override;
+
+  int fd;
+};
+
+}
@@ -0,0 +1,164 @@
+/* extend - expansible programming language
+ * Copyright (C) 2022 Vladimir Liutov vs@lutov.net
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "line.h"
+
+#include <EASTL/allocator.h>
+#include <EASTL/atomic.h>
+
+namespace extend::log {
+
+namespace {
+using Allocator = LinePoolAllocator;
+
+constexpr size_t SIZE_COUNT =
+  __builtin_ctzll(Allocator::MAX_CHUNK_SIZE / Allocator::MIN_CHUNK_SIZE) + 1;
+
+eastl::atomic<uint64_t> spilled{ 0 };
+eastl::atomic<uint64_t> max_length{ 0 };
+eastl::atomic<uint64_t> bytes_pooled{ 0 };
+eastl::atomic<uint64_t> allocations{ 0 };
+
+struct Chunk
+{
+  Chunk* next;
+};
+
+/** Free chunks of the thread.
+ *
+ * Trivially destructible, so it is usable after the guard is destroyed at
+ * thread exit, then chunks go to the global allocator.
+ */
+struct Pool
+{
+  Chunk* free[SIZE_COUNT];
+  uint8_t count[SIZE_COUNT];
+  bool closed;
+  /** Longest line of the thread, only a longer one updates max_length. */
+  uint64_t longest;
+};
+
+thread_local Pool pool{};
+
+/** Return chunks of the pool at thread exit.
+ */
+struct PoolGuard
+{
+  ~PoolGuard()
+  {
+    for (size_t i = 0; i < SIZE_COUNT; ++i) {
+      while (Chunk* chunk = pool.free[i]) {
+        pool.free[i] = chunk->next;
+        bytes_pooled.fetch_sub(Allocator::MIN_CHUNK_SIZE << i,
+                               eastl::memory_order_relaxed);
+        eastl::allocator().deallocate(chunk, Allocator::MIN_CHUNK_SIZE << i);
+      }
+      pool.count[i] = 0;
+    }
+    pool.closed = true;
+  }
+};
+
+thread_local PoolGuard guard;
+
+size_t
+size_index(size_t n)
+{
+  if (n <= Allocator::MIN_CHUNK_SIZE) {
+    return 0;
+  }
+  const size_t bits = 64 - __builtin_clzll(n - 1);
+  return bits - __builtin_ctzll(Allocator::MIN_CHUNK_SIZE);
+}
+}
+
+void*
+LinePoolAllocator::allocate(size_t n, int flags)
+{
+  if (n > MAX_CHUNK_SIZE) {
+    allocations.fetch_add(1, eastl::memory_order_relaxed);
+    return eastl::allocator().allocate(n, flags);
+  }
+  const size_t index = size_index(n);
+  if (Chunk* chunk = pool.free[index]) {
+    pool.free[index] = chunk->next;
+    --pool.count[index];
+    bytes_pooled.fetch_sub(MIN_CHUNK_SIZE << index,
+                           eastl::memory_order_relaxed);
+    return chunk;
+  }
+  allocations.fetch_add(1, eastl::memory_order_relaxed);
+  return eastl::allocator().allocate(MIN_CHUNK_SIZE << index, flags);
+}
+
+void*
+LinePoolAllocator::allocate(size_t n, size_t, size_t, int flags)
+{
+  // Chunks of the global allocator are aligned enough for chars
+  return allocate(n, flags);
+}
+
+void
+LinePoolAllocator::deallocate(void* p, size_t n)
+{
+  if (n > MAX_CHUNK_SIZE) {
+    eastl::allocator().deallocate(p, n);
+    return;
+  }
+  const size_t index = size_index(n);
+  // Construct the guard before the pool keeps a chunk, it frees them at exit
+  (void)guard;
+  if (pool.closed || pool.count[index] == CHUNKS_PER_SIZE) {
+    eastl::allocator().deallocate(p, MIN_CHUNK_SIZE << index);
+    return;
+  }
+  auto* chunk = static_cast<Chunk*>(p);
+  chunk->next = pool.free[index];
+  pool.free[index] = chunk;
+  ++pool.count[index];
+  bytes_pooled.fetch_add(MIN_CHUNK_SIZE << index, eastl::memory_order_relaxed);
+}
+
+void
+count_line(const LineBuffer& line)
+{
+  const uint64_t size = line.size();
+  if (line.has_overflowed()) {
+    spilled.fetch_add(1, eastl::memory_order_relaxed);
+  }
+  if (size <= pool.longest) {
+    return;
+  }
+  pool.longest = size;
+  uint64_t longest = max_length.load(eastl::memory_order_relaxed);
+  while (size > longest && !max_length.compare_exchange_weak(
+                             longest, size, eastl::memory_order_relaxed)) {
+  }
+}
+
+LineStats
+line_stats()
+{
+  LineStats stats;
+  stats.spilled = spilled.load(eastl::memory_order_relaxed);
+  stats.max_length = max_length.load(eastl::memory_order_relaxed);
+  stats.bytes_pooled = bytes_pooled.load(eastl::memory_order_relaxed);
+  stats.allocations = allocations.load(eastl::memory_order_relaxed);
+  return stats;
+}
+
+}
@@ -0,0 +1,97 @@
+/* extend - expansible programming language
+ * Copyright (C) 2022 Vladimir Liutov vs@lutov.net
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <EASTL/fixed_string.h>
+#include <cinttypes>
+
+#ifndef EXTEND_LOG_LINE_CAPACITY
+#define EXTEND_LOG_LINE_CAPACITY 256
+#endif
+
+namespace extend::log {
+
+/** Inline capacity of stream lines.
+ *
+ * Set by EXTEND_LOG_LINE_CAPACITY build option, see line_stats() to tune it.
+ */
+constexpr size_t LINE_CAPACITY = EXTEND_LOG_LINE_CAPACITY;
+
+/** Overflow allocator of stream lines.
+ *
+ * Lines longer than LINE_CAPACITY take chunks from a pool of the thread and
+ * give them back when done, so in steady state they do not call the global
+ * allocator. Chunks are powers of two from MIN_CHUNK_SIZE to MAX_CHUNK_SIZE,
+ * bigger ones are not pooled.
+ */
+struct LinePoolAllocator
+{
+  static constexpr size_t MIN_CHUNK_SIZE = 512;
+  static constexpr size_t MAX_CHUNK_SIZE = 64 << 10;
+  /** Free chunks of each size kept by a thread. */
+  static constexpr size_t CHUNKS_PER_SIZE = 4;
+
+  explicit LinePoolAllocator(const char* = nullptr) {}
+  LinePoolAllocator(const LinePoolAllocator&, const char*) {}
+
+  void* allocate(size_t n, int flags = 0);
+  void* allocate(size_t n, size_t alignment, size_t offset, int flags = 0);
+  void deallocate(void* p, size_t n);
+
+  const char* get_name() const { return "extend::log::LinePoolAllocator"; }
+  void set_name(const char*) {}
+};
+
+inline bool
+operator==(const LinePoolAllocator&, const LinePoolAllocator&)
+{
+  return true;
+}
+
+inline bool
+operator!=(const LinePoolAllocator&, const LinePoolAllocator&)
+{
+  return false;
+}
+
+using LineBuffer =
+  eastl::fixed_string<char8_t, LINE_CAPACITY, true, LinePoolAllocator>;
+
+/** Counters of stream lines.
+ */
+struct LineStats
+{
+  /** Lines longer than LINE_CAPACITY. */
+  uint64_t spilled = 0;
+  /** Size of the longest line. */
+  uint64_t max_length = 0;
+  /** Size of free chunks in pools of all threads. */
+  uint64_t bytes_pooled = 0;
+  /** Chunks taken from the global allocator. */
+  uint64_t allocations = 0;
+};
+
+/** Count finished line, called by OStream.
+ */
+void
+count_line(const LineBuffer& line);
+
+LineStats
+line_stats();
+
+}
@@ -0,0 +1,1075 @@
+/* extend - expansible programming language
+ * Copyright (C) 2022 Vladimir Liutov vs@lutov.net
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <bench/bench.h>
+#include <charconv>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <eathread/eathread_thread.h>
+#include <fcntl.h>
+#include <llvm/Support/ConvertUTF.h>
+#include <unistd.h>
+
+#include "async.h"
+#include "binary.h"
+#include "clock.h"
+#include "compress.h"
+#include "dtoa.h"
+#include "file.h"
+#include "json.h"
+#include "log.h"
+#include "parse.h"
+#include "recorder.h"
+#include "tee.h"
+#include "uring.h"
+#include "utf.h"
+
+using namespace extend::log;
+
+namespace {
+/** Drop lines of binary format, to measure encoding alone.
+ */
+struct NullBinaryPipe : NullPipe
+{
+  virtual FORMAT format() const override { return FORMAT::BINARY; }
+};
+
+int
+dev_null()
+{
+  static const int fd = open("/dev/null", O_WRONLY | O_CLOEXEC);
+  return fd;
+}
+
+// Temporary file path, removed at exit, pipes keep writing to it meanwhile
+const char*
+temp_path()
+{
+  static char path[] = "/tmp/extend-bench-XXXXXX";
+  static const bool created = [] {
+    close(mkstemp(path));
+    atexit([] { unlink(path); });
+    return true;
+  }();
+  (void)created;
+  return path;
+}
+
+NullPipe null_pipe;
+NullBinaryPipe null_binary_pipe;
+
+template<typename T>
+void
+stream_text(uint64_t iterations, const T& x)
+{
+  OStreamFactory factory(LEVEL::INFO, null_pipe);
+  for (uint64_t i = 0; i < iterations; ++i) {
+    factory << x;
+  }
+}
+
+template<typename T>
+void
+stream_binary(uint64_t iterations, const T& x)
+{
+  OStreamFactory factory(LEVEL::INFO, null_binary_pipe);
+  for (uint64_t i = 0; i < iterations; ++i) {
+    factory << x;
+  }
+}
+
+void
+stream_line(uint64_t iterations, IPipe& pipe)
+{
+  OStreamFactory factory(LEVEL::INFO, pipe);
+  for (uint64_t i = 0; i < iterations; ++i) {
+    factory << u8"request " << i << u8" done in " << 12.5 << u8" ms";
+  }
+}
+
+struct Producer
+{
+  IPipe* pipe;
+  uint64_t lines;
+};
+
+intptr_t
+produce(void* context)
+{
+  const Producer& producer = *static_cast<Producer*>(context);
+  stream_line(producer.lines, *producer.pipe);
+  return 0;
+}
+
+// Split the lines between threads and wait for them
+void
+stream_threads(uint64_t iterations, IPipe& pipe, unsigned count)
+{
+  constexpr unsigned MAX_THREADS = 16;
+  EA::Thread::Thread threads[MAX_THREADS];
+  Producer producers[MAX_THREADS];
+  for (unsigned i = 0; i < count; ++i) {
+    producers[i] = { &pipe, iterations / count + (i < iterations % count) };
+    threads[i].Begin(&produce, &producers[i]);
+  }
+  for (unsigned i = 0; i < count; ++i) {
+    threads[i].WaitForEnd();
+  }
+  pipe.flush();
+}
+
+FdPipe&
+buffered_fd_pipe()
+{
+  static FdPipe pipe(dev_null(), FdPipe::DEFAULT_BUFFER_SIZE);
+  return pipe;
+}
+
+AsyncPipe&
+async_pipe()
+{
+  static FdPipe sink(dev_null(), FdPipe::DEFAULT_BUFFER_SIZE);
+  static AsyncPipe pipe(sink);
+  return pipe;
+}
+
+FlightRecorderPipe&
+recorder_pipe()
+{
+  static FlightRecorderPipe pipe(null_pipe, LEVEL::WARNING);
+  return pipe;
+}
+}
+
+// Arguments of every OStream::operator<< overload, text and binary format
+#define BENCH_ARG(name, value)                                                 \
+  EXTEND_BENCH("text << " name)                                                \
+  {                                                                            \
+    stream_text(iterations, value);                                            \
+  }                                                                            \
+  EXTEND_BENCH("binary << " name)                                              \
+  {                                                                            \
+    stream_binary(iterations, value);                                          \
+  }
+
+BENCH_ARG("char8_t", u8'x')
+BENCH_ARG("char16_t", u'я')
+BENCH_ARG("char32_t", U'\U0001f600')
+BENCH_ARG("u8string_view", eastl::u8string_view(u8"the quick brown fox"))
+BENCH_ARG("u16string_view", eastl::u16string_view(u"the quick brown fox"))
+BENCH_ARG("u32string_view", eastl::u32string_view(U"the quick brown fox"))
+BENCH_ARG("int8_t", static_cast<int8_t>(-42))
+BENCH_ARG("int16_t", static_cast<int16_t>(-4242))
+BENCH_ARG("int32_t", static_cast<int32_t>(-424242))
+BENCH_ARG("int64_t", static_cast<int64_t>(-4242424242424242))
+BENCH_ARG("uint8_t", static_cast<uint8_t>(42))
+BENCH_ARG("uint16_t", static_cast<uint16_t>(4242))
+BENCH_ARG("uint32_t", static_cast<uint32_t>(424242))
+BENCH_ARG("uint64_t", static_cast<uint64_t>(4242424242424242))
+BENCH_ARG("float", 3.14159f)
+BENCH_ARG("double", 2.718281828459045)
+BENCH_ARG("long double", 1.4142135623730951L)
+BENCH_ARG("Site", EXTEND_LOG_SITE)
+BENCH_ARG("Field<double>", field(u8"latency_us", 123.4))
+
+// Fixed notation is set per line, so the bench formats a double with it
+EXTEND_BENCH("text << fixed(3) << double")
+{
+  OStreamFactory factory(LEVEL::INFO, null_pipe);
+  for (uint64_t i = 0; i < iterations; ++i) {
+    factory << fixed(3) << 2.718281828459045;
+  }
+}
+
+EXTEND_BENCH("binary << fixed(3) << double")
+{
+  OStreamFactory factory(LEVEL::INFO, null_binary_pipe);
+  for (uint64_t i = 0; i < iterations; ++i) {
+    factory << fixed(3) << 2.718281828459045;
+  }
+}
+
+EXTEND_BENCH("append_sprintf int64 and int32")
+{
+  eastl::fixed_string<char8_t, 256> line;
+  for (uint64_t i = 0; i < iterations; ++i) {
+    const auto x = static_cast<int64_t>(1234567890123 + i);
+    line.clear();
+    line.append_sprintf(u8"%I64d", x);
+    line.append_sprintf(u8"%I32d", static_cast<int32_t>(x));
+    extend::bench::keep(line.size());
+  }
+}
+
+EXTEND_BENCH("itoa int64 and int32")
+{
+  eastl::fixed_string<char8_t, 256> line;
+  for (uint64_t i = 0; i < iterations; ++i) {
+    const auto x = static_cast<int64_t>(1234567890123 + i);
+    line.clear();
+    size_t size = line.size();
+    line.resize(size + 21);
+    line.resize(itoa(x, line.begin() + size) + size);
+    size = line.size();
+    line.resize(size + 11);
+    line.resize(itoa(static_cast<int32_t>(x), line.begin() + size) + size);
+    extend::bench::keep(line.size());
+  }
+}
+
+EXTEND_BENCH("dtoa")
+{
+  char8_t buffer[32];
+  double x = 1.0;
+  for (uint64_t i = 0; i < iterations; ++i) {
+    x = x * 1.0000001 + 0.1;
+    extend::bench::keep(dtoa(x, buffer));
+  }
+}
+
+// Doubles of random bits, every exponent is as likely
+template<typename F>
+void
+format_random_doubles(uint64_t iterations, F format)
+{
+  uint64_t bits = 0x9E3779B97F4A7C15;
+  for (uint64_t i = 0; i < iterations; ++i) {
+    bits ^= bits << 13;
+    bits ^= bits >> 7;
+    bits ^= bits << 17;
+    double x;
+    memcpy(&x, &bits, sizeof(x));
+    extend::bench::keep(format(x));
+  }
+}
+
+EXTEND_BENCH("dtoa random bits")
+{
+  char8_t buffer[32];
+  format_random_doubles(iterations, [&](double x) { return dtoa(x, buffer); });
+}
+
+EXTEND_BENCH("std::to_chars random bits")
+{
+  char buffer[32];
+  format_random_doubles(iterations, [&](double x) {
+    return std::to_chars(buffer, buffer + sizeof(buffer), x).ptr - buffer;
+  });
+}
+
+EXTEND_BENCH("snprintf %.17g random bits")
+{
+  char buffer[32];
+  format_random_doubles(iterations, [&](double x) {
+    return snprintf(buffer, sizeof(buffer), "%.17g", x);
+  });
+}
+
+// Latencies in ms below 10 s, as fixed(3) writes them
+template<typename F>
+void
+format_latencies(uint64_t iterations, F format)
+{
+  uint64_t bits = 0x9E3779B97F4A7C15;
+  for (uint64_t i = 0; i < iterations; ++i) {
+    bits ^= bits << 13;
+    bits ^= bits >> 7;
+    bits ^= bits << 17;
+    const double x = static_cast<double>(bits >> 11) * 0x1p-53 * 10000.0;
+    extend::bench::keep(format(x));
+  }
+}
+
+EXTEND_BENCH("dtoa_fixed(3) latencies")
+{
+  char8_t buffer[32];
+  format_latencies(iterations,
+                   [&](double x) { return dtoa_fixed(x, 3, buffer); });
+}
+
+EXTEND_BENCH("snprintf %.3f latencies")
+{
+  char buffer[32];
+  format_latencies(iterations, [&](double x) {
+    return snprintf(buffer, sizeof(buffer), "%.3f", x);
+  });
+}
+
+EXTEND_BENCH("dtoa_exp(6) random bits")
+{
+  char8_t buffer[32];
+  format_random_doubles(iterations,
+                        [&](double x) { return dtoa_exp(x, 6, buffer); });
+}
+
+EXTEND_BENCH("snprintf %.6e random bits")
+{
+  char buffer[32];
+  format_random_doubles(iterations, [&](double x) {
+    return snprintf(buffer, sizeof(buffer), "%.6e", x);
+  });
+}
+
+EXTEND_BENCH("dtoa_exp(16) random bits")
+{
+  char8_t buffer[32];
+  format_random_doubles(iterations,
+                        [&](double x) { return dtoa_exp(x, 16, buffer); });
+}
+
+EXTEND_BENCH("snprintf %.16e random bits")
+{
+  char buffer[32];
+  format_random_doubles(iterations, [&](double x) {
+    return snprintf(buffer, sizeof(buffer), "%.16e", x);
+  });
+}
+
+// Texts of dtoa for random doubles, parsed back
+struct DoubleTexts
+{
+  static constexpr size_t COUNT = 1024;
+
+  DoubleTexts()
+  {
+    uint64_t bits = 0x9E3779B97F4A7C15;
+    for (size_t i = 0; i < COUNT;) {
+      bits ^= bits << 13;
+      bits ^= bits >> 7;
+      bits ^= bits << 17;
+      double x;
+      memcpy(&x, &bits, sizeof(x));
+      if (x - x == 0) {
+        const int length = dtoa(x, texts[i]);
+        texts[i][length] = u8'\0';
+        lengths[i++] = length;
+      }
+    }
+  }
+
+  char8_t texts[COUNT][32];
+  size_t lengths[COUNT];
+};
+
+const DoubleTexts&
+double_texts()
+{
+  static const DoubleTexts texts;
+  return texts;
+}
+
+EXTEND_BENCH("parse_double random bits")
+{
+  const DoubleTexts& texts = double_texts();
+  for (uint64_t i = 0; i < iterations; ++i) {
+    const size_t index = i % DoubleTexts::COUNT;
+    extend::bench::keep(
+      parse_double({ texts.texts[index], texts.lengths[index] }).value);
+  }
+}
+
+EXTEND_BENCH("strtod random bits")
+{
+  const DoubleTexts& texts = double_texts();
+  for (uint64_t i = 0; i < iterations; ++i) {
+    const char8_t* text = texts.texts[i % DoubleTexts::COUNT];
+    extend::bench::keep(strtod(reinterpret_cast<const char*>(text), nullptr));
+  }
+}
+
+EXTEND_BENCH("parse_double short decimals")
+{
+  static const char8_t* const texts[] = { u8"0.5",  u8"12.25", u8"3.14159",
+                                          u8"100",  u8"1e-3",  u8"-42.0",
+                                          u8"0.01", u8"99.99" };
+  for (uint64_t i = 0; i < iterations; ++i) {
+    const char8_t* text = texts[i % 8];
+    const size_t length = strlen(reinterpret_cast<const char*>(text));
+    extend::bench::keep(parse_double({ text, length }).value);
+  }
+}
+
+EXTEND_BENCH("strtod short decimals")
+{
+  static const char* const texts[] = { "0.5",  "12.25", "3.14159", "100",
+                                       "1e-3", "-42.0", "0.01",    "99.99" };
+  for (uint64_t i = 0; i < iterations; ++i) {
+    extend::bench::keep(strtod(texts[i % 8], nullptr));
+  }
+}
+
+// Random integers written in one line separated by spaces, as a lexer or a
+// log reader sees them: uniform bit length spreads the decimal digit counts
+// from 1 to 20, small ones have 1 to 3 digits as most literals
+struct IntegerTexts
+{
+  static constexpr size_t COUNT = 1024;
+
+  IntegerTexts(bool small, int base)
+  {
+    uint64_t bits = 0x9E3779B97F4A7C15;
+    char* out = line;
+    for (size_t i = 0; i < COUNT; ++i) {
+      bits ^= bits << 13;
+      bits ^= bits >> 7;
+      bits ^= bits << 17;
+      const uint64_t value = small ? bits % 1000 : bits >> (bits % 64);
+      starts[i] = size_t(out - line);
+      out = std::to_chars(out, line + sizeof(line), value, base).ptr;
+      *out++ = ' ';
+    }
+    *out = '\0';
+    end = size_t(out - line);
+  }
+
+  char line[COUNT * 66];
+  size_t starts[COUNT];
+  size_t end;
+};
+
+const IntegerTexts&
+integer_texts(bool small, int base = 10)
+{
+  static const IntegerTexts decimal(false, 10);
+  static const IntegerTexts decimal_small(true, 10);
+  static const IntegerTexts hexadecimal(false, 16);
+  return base == 16 ? hexadecimal : small ? decimal_small : decimal;
+}
+
+void
+bench_parse_integer(const IntegerTexts& texts, uint64_t iterations, int base)
+{
+  const char8_t* line = reinterpret_cast<const char8_t*>(texts.line);
+  for (uint64_t i = 0; i < iterations; ++i) {
+    const size_t start = texts.starts[i % IntegerTexts::COUNT];
+    extend::bench::keep(
+      parse_integer<uint64_t>({ line + start, texts.end - start }, base).value);
+  }
+}
+
+void
+bench_strtoull(const IntegerTexts& texts, uint64_t iterations, int base)
+{
+  for (uint64_t i = 0; i < iterations; ++i) {
+    const char* text = texts.line + texts.starts[i % IntegerTexts::COUNT];
+    extend::bench::keep(strtoull(text, nullptr, base));
+  }
+}
+
+void
+bench_from_chars(const IntegerTexts& texts, uint64_t iterations, int base)
+{
+  for (uint64_t i = 0; i < iterations; ++i) {
+    const char* text = texts.line + texts.starts[i % IntegerTexts::COUNT];
+    uint64_t value = 0;
+    std::from_chars(text, texts.line + texts.end, value, base);
+    extend::bench::keep(value);
+  }
+}
+
+EXTEND_BENCH("parse_integer uint64")
+{
+  bench_parse_integer(integer_texts(false), iterations, 10);
+}
+
+EXTEND_BENCH("strtoull uint64")
+{
+  bench_strtoull(integer_texts(false), iterations, 10);
+}
+
+EXTEND_BENCH("from_chars uint64")
+{
+  bench_from_chars(integer_texts(false), iterations, 10);
+}
+
+EXTEND_BENCH("parse_integer small")
+{
+  bench_parse_integer(integer_texts(true), iterations, 10);
+}
+
+EXTEND_BENCH("strtoull small")
+{
+  bench_strtoull(integer_texts(true), iterations, 10);
+}
+
+EXTEND_BENCH("from_chars small")
+{
+  bench_from_chars(integer_texts(true), iterations, 10);
+}
+
+EXTEND_BENCH("parse_integer hex")
+{
+  bench_parse_integer(integer_texts(false, 16), iterations, 16);
+}
+
+EXTEND_BENCH("strtoull hex")
+{
+  bench_strtoull(integer_texts(false, 16), iterations, 16);
+}
+
+EXTEND_BENCH("from_chars hex")
+{
+  bench_from_chars(integer_texts(false, 16), iterations, 16);
+}
+
+// Arrays of metrics snapshots: uniform bit length spreads digit counts
+// from 1 to 20, small ones are counters of 1 to 3 digits
+template<typename T>
+struct Array
+{
+  static constexpr size_t COUNT = 256;
+
+  explicit Array(bool small)
+  {
+    uint64_t bits = 0x9E3779B97F4A7C15;
+    for (T& value : values) {
+      bits ^= bits << 13;
+      bits ^= bits >> 7;
+      bits ^= bits << 17;
+      if constexpr (eastl::is_floating_point_v<T>) {
+        value = static_cast<T>(bits >> 11) / static_cast<T>(1ULL << 40);
+      } else {
+        value = static_cast<T>(small ? bits % 1000 : bits >> (bits % 64));
+      }
+    }
+  }
+
+  eastl::span<const T> span() const { return values; }
+
+  T values[COUNT];
+};
+
+template<typename T>
+const Array<T>&
+array(bool small = false)
+{
+  static const Array<T> uniform(false);
+  static const Array<T> counters(true);
+  return small ? counters : uniform;
+}
+
+template<typename T>
+void
+stream_join(uint64_t iterations, const Array<T>& a)
+{
+  OStreamFactory factory(LEVEL::INFO, null_pipe);
+  for (uint64_t i = 0; i < iterations; ++i) {
+    factory << join(a.span());
+  }
+}
+
+template<typename T>
+void
+stream_chained(uint64_t iterations, const Array<T>& a)
+{
+  OStreamFactory factory(LEVEL::INFO, null_pipe);
+  for (uint64_t i = 0; i < iterations; ++i) {
+    OStream out(factory);
+    out << a.values[0];
+    for (size_t k = 1; k < Array<T>::COUNT; ++k) {
+      out << u8", " << a.values[k];
+    }
+  }
+}
+
+// One line of 256 elements per iteration
+#define BENCH_ARRAY(name, T, small)                                            \
+  EXTEND_BENCH("join " name)                                                   \
+  {                                                                            \
+    stream_join(iterations, array<T>(small));                                  \
+  }                                                                            \
+  EXTEND_BENCH("chained << " name)                                             \
+  {                                                                            \
+    stream_chained(iterations, array<T>(small));                               \
+  }
+
+BENCH_ARRAY("uint64 x256", uint64_t, false)
+BENCH_ARRAY("int32 counters x256", int32_t, true)
+BENCH_ARRAY("double x256", double, false)
+
+EXTEND_BENCH("ftoa")
+{
+  char8_t buffer[32];
+  float x = 1.0f;
+  for (uint64_t i = 0; i < iterations; ++i) {
+    x = x * 1.0001f + 0.1f;
+    extend::bench::keep(ftoa(x, buffer));
+  }
+}
+
+// Wide strings of 256 code units, in-tree transcoder against LLVM
+template<typename Char>
+eastl::basic_string_view<Char>
+alphabet(Char (&text)[256], bool ascii)
+{
+  const char32_t first = ascii ? U'a' : U'а';
+  for (size_t i = 0; i < 256; ++i) {
+    text[i] = static_cast<Char>(first + i % 26);
+  }
+  return { text, 256 };
+}
+
+template<typename Char>
+void
+transcode(uint64_t iterations, bool ascii)
+{
+  Char text[256];
+  const eastl::basic_string_view<Char> str = alphabet(text, ascii);
+  char8_t buffer[256 * 4];
+  for (uint64_t i = 0; i < iterations; ++i) {
+    if constexpr (sizeof(Char) == 2) {
+      extend::bench::keep(utf16_to_utf8(str, buffer).size);
+    } else {
+      extend::bench::keep(utf32_to_utf8(str, buffer).size);
+    }
+  }
+}
+
+template<typename Char>
+void
+transcode_llvm(uint64_t iterations, bool ascii)
+{
+  Char text[256];
+  const Char* str = alphabet(text, ascii).data();
+  llvm::UTF8 buffer[256 * 4];
+  for (uint64_t i = 0; i < iterations; ++i) {
+    llvm::UTF8* target = buffer;
+    if constexpr (sizeof(Char) == 2) {
+      const auto* source = reinterpret_cast<const llvm::UTF16*>(str);
+      llvm::ConvertUTF16toUTF8(&source,
+                               source + 256,
+                               &target,
+                               target + sizeof(buffer),
+                               llvm::ConversionFlags::strictConversion);
+    } else {
+      const auto* source = reinterpret_cast<const llvm::UTF32*>(str);
+      llvm::ConvertUTF32toUTF8(&source,
+                               source + 256,
+                               &target,
+                               target + sizeof(buffer),
+                               llvm::ConversionFlags::strictConversion);
+    }
+    extend::bench::keep(target - buffer);
+  }
+}
+
+EXTEND_BENCH("utf16_to_utf8 ascii")
+{
+  transcode<char16_t>(iterations, true);
+}
+
+EXTEND_BENCH("utf16_to_utf8 cyrillic")
+{
+  transcode<char16_t>(iterations, false);
+}
+
+EXTEND_BENCH("utf32_to_utf8 ascii")
+{
+  transcode<char32_t>(iterations, true);
+}
+
+EXTEND_BENCH("utf32_to_utf8 cyrillic")
+{
+  transcode<char32_t>(iterations, false);
+}
+
+EXTEND_BENCH("LLVM ConvertUTF16toUTF8 ascii")
+{
+  transcode_llvm<char16_t>(iterations, true);
+}
+
+EXTEND_BENCH("LLVM ConvertUTF16toUTF8 cyrillic")
+{
+  transcode_llvm<char16_t>(iterations, false);
+}
+
+EXTEND_BENCH("LLVM ConvertUTF32toUTF8 ascii")
+{
+  transcode_llvm<char32_t>(iterations, true);
+}
+
+EXTEND_BENCH("LLVM ConvertUTF32toUTF8 cyrillic")
+{
+  transcode_llvm<char32_t>(iterations, false);
+}
+
+EXTEND_BENCH("disabled stream")
+{
+  OStreamFactory factory(LEVEL::DEBUG, null_pipe);
+  set_level(LEVEL::INFO);
+  for (uint64_t i = 0; i < iterations; ++i) {
+    factory << u8"request " << i;
+  }
+  set_level(LEVEL::DEBUG);
+}
+
+EXTEND_BENCH("disabled default stream")
+{
+  init_default_pipe<NullPipe>();
+  set_level(LEVEL::INFO);
+  for (uint64_t i = 0; i < iterations; ++i) {
+    debug << 1 << 2.0 << u8"text";
+  }
+  set_level(LEVEL::DEBUG);
+  init_default_pipe<CErrPipe>();
+}
+
+EXTEND_BENCH("disabled channel stream")
+{
+  init_default_pipe<NullPipe>();
+  set_level(LEVEL::INFO);
+  for (uint64_t i = 0; i < iterations; ++i) {
+    channel<"bench.disabled">.debug << 1 << 2.0 << u8"text";
+  }
+  set_level(LEVEL::DEBUG);
+  init_default_pipe<CErrPipe>();
+}
+
+// Lines dropped by the limit of their site
+EXTEND_BENCH("site 1 of 1000")
+{
+  OStreamFactory factory(LEVEL::INFO, null_pipe);
+  for (uint64_t i = 0; i < iterations; ++i) {
+    factory << EXTEND_LOG_SITE_EVERY(1000) << 1 << 2.0 << u8"text";
+  }
+}
+
+EXTEND_BENCH("site 1 per second")
+{
+  OStreamFactory factory(LEVEL::INFO, null_pipe);
+  for (uint64_t i = 0; i < iterations; ++i) {
+    factory << EXTEND_LOG_SITE_RATE(1, 1) << 1 << 2.0 << u8"text";
+  }
+}
+
+EXTEND_BENCH("site unlimited")
+{
+  OStreamFactory factory(LEVEL::INFO, null_pipe);
+  for (uint64_t i = 0; i < iterations; ++i) {
+    factory << EXTEND_LOG_SITE << 1 << 2.0 << u8"text";
+  }
+}
+
+EXTEND_BENCH("Prefix level tag")
+{
+  for (uint64_t i = 0; i < iterations; ++i) {
+    extend::bench::keep(IPipe::linePrefix(LEVEL::INFO).size());
+  }
+}
+
+EXTEND_BENCH("Prefix level, time and thread")
+{
+  char8_t out[Prefix::MAX_SIZE];
+  const Prefix full{ true, true };
+  for (uint64_t i = 0; i < iterations; ++i) {
+    extend::bench::keep(full.write(LEVEL::INFO, out));
+  }
+}
+
+EXTEND_BENCH("Clock::system")
+{
+  for (uint64_t i = 0; i < iterations; ++i) {
+    extend::bench::keep(Clock::system());
+  }
+}
+
+EXTEND_BENCH("Clock::now")
+{
+  for (uint64_t i = 0; i < iterations; ++i) {
+    extend::bench::keep(Clock::now());
+  }
+}
+
+// Blocks of CompressPipe, log lines of repeating words
+const eastl::u8string&
+lz_text()
+{
+  static const eastl::u8string text = [] {
+    eastl::u8string text;
+    for (int32_t i = 0; text.size() < CompressPipe::DEFAULT_BLOCK_SIZE; ++i) {
+      text.append_sprintf(u8"[I] request %I32d latency_us=%I32d\n", i, i * 7);
+    }
+    return text;
+  }();
+  return text;
+}
+
+EXTEND_BENCH("lz_compress 64 KiB")
+{
+  const eastl::u8string& text = lz_text();
+  eastl::u8string packed(lz_bound(text.size()), u8'\0');
+  for (uint64_t i = 0; i < iterations; ++i) {
+    extend::bench::keep(lz_compress(
+      { text.data(), text.size() }, packed.data(), packed.size()));
+  }
+}
+
+EXTEND_BENCH("lz_decompress 64 KiB")
+{
+  const eastl::u8string& text = lz_text();
+  eastl::u8string packed(lz_bound(text.size()), u8'\0');
+  const size_t size =
+    lz_compress({ text.data(), text.size() }, packed.data(), packed.size());
+  eastl::u8string unpacked(text.size(), u8'\0');
+  for (uint64_t i = 0; i < iterations; ++i) {
+    extend::bench::keep(lz_decompress(
+      { packed.data(), size }, unpacked.data(), unpacked.size()));
+  }
+}
+
+// Lines of every pipe
+EXTEND_BENCH("pipe NullPipe")
+{
+  stream_line(iterations, null_pipe);
+}
+
+EXTEND_BENCH("pipe BufferPipe")
+{
+  static BufferPipe<true> pipe;
+  OStreamFactory factory(LEVEL::INFO, pipe);
+  for (uint64_t i = 0; i < iterations; ++i) {
+    factory << u8"request " << i << u8" done in " << 12.5 << u8" ms";
+    if (pipe.buffer.size() > 3000) {
+      pipe.buffer.clear();
+    }
+  }
+}
+
+EXTEND_BENCH("pipe CErrPipe")
+{
+  const int saved = dup(STDERR_FILENO);
+  dup2(dev_null(), STDERR_FILENO);
+  {
+    CErrPipe pipe;
+    stream_line(iterations, pipe);
+  }
+  dup2(saved, STDERR_FILENO);
+  close(saved);
+}
+
+EXTEND_BENCH("pipe FdPipe writev per line")
+{
+  static FdPipe pipe(dev_null());
+  stream_line(iterations, pipe);
+}
+
+EXTEND_BENCH("pipe FdPipe buffered")
+{
+  stream_line(iterations, buffered_fd_pipe());
+}
+
+EXTEND_BENCH("pipe FdPipe with time and thread")
+{
+  static FdPipe pipe(
+    dev_null(), FdPipe::DEFAULT_BUFFER_SIZE, 100, { true, true });
+  stream_line(iterations, pipe);
+}
+
+EXTEND_BENCH("pipe AsyncPipe")
+{
+  stream_line(iterations, async_pipe());
+  async_pipe().flush();
+}
+
+EXTEND_BENCH("pipe MmapFilePipe")
+{
+  static MmapFilePipe pipe(temp_path(), 16 << 20, 2);
+  stream_line(iterations, pipe);
+}
+
+EXTEND_BENCH("pipe UringFilePipe")
+{
+  static UringFilePipe pipe(temp_path());
+  stream_line(iterations, pipe);
+}
+
+EXTEND_BENCH("pipe UringFilePipe with pwrite")
+{
+  static UringFilePipe pipe(temp_path(),
+                            UringFilePipe::DEFAULT_BUFFER_SIZE,
+                            UringFilePipe::DEFAULT_BUFFER_COUNT,
+                            UringFilePipe::DEFAULT_DELAY_MS,
+                            {},
+                            false);
+  stream_line(iterations, pipe);
+}
+
+EXTEND_BENCH("pipe CompressPipe")
+{
+  static CompressPipe pipe(dev_null());
+  stream_line(iterations, pipe);
+}
+
+EXTEND_BENCH("pipe JsonPipe")
+{
+  static JsonPipe pipe(dev_null());
+  stream_line(iterations, pipe);
+}
+
+EXTEND_BENCH("pipe BinaryPipe")
+{
+  static BinaryPipe pipe(dev_null());
+  stream_line(iterations, pipe);
+}
+
+EXTEND_BENCH("pipe FlightRecorderPipe")
+{
+  stream_line(iterations, recorder_pipe());
+}
+
+EXTEND_BENCH("pipe TeePipe")
+{
+  static const TeeSink sinks[] = { { &buffered_fd_pipe(), LEVEL::INFO },
+                                   { &recorder_pipe(), LEVEL::DEBUG } };
+  static TeePipe pipe(sinks, { true, true });
+  stream_line(iterations, pipe);
+}
+
+// One tee against a stream per sink, of the same three sinks
+FdPipe&
+timed_fd_pipe()
+{
+  static FdPipe pipe(
+    dev_null(), FdPipe::DEFAULT_BUFFER_SIZE, 1000, { true, true });
+  return pipe;
+}
+
+EXTEND_BENCH("TeePipe of 3 sinks")
+{
+  static const TeeSink sinks[] = { { &timed_fd_pipe(), LEVEL::INFO },
+                                   { &recorder_pipe(), LEVEL::DEBUG },
+                                   { &null_pipe, LEVEL::INFO } };
+  static TeePipe pipe(sinks, { true, true });
+  stream_line(iterations, pipe);
+}
+
+EXTEND_BENCH("3 separate streams")
+{
+  OStreamFactory to_file(LEVEL::INFO, timed_fd_pipe());
+  OStreamFactory to_recorder(LEVEL::INFO, recorder_pipe());
+  OStreamFactory to_null(LEVEL::INFO, null_pipe);
+  for (uint64_t i = 0; i < iterations; ++i) {
+    to_file << u8"request " << i << u8" done in " << 12.5 << u8" ms";
+    to_recorder << u8"request " << i << u8" done in " << 12.5 << u8" ms";
+    to_null << u8"request " << i << u8" done in " << 12.5 << u8" ms";
+  }
+}
+
+// Default streams, owned pipes are called by type, others through IPipe
+void
+default_line(uint64_t iterations)
+{
+  for (uint64_t i = 0; i < iterations; ++i) {
+    info << u8"request " << i << u8" done in " << 12.5 << u8" ms";
+  }
+}
+
+EXTEND_BENCH("default streams NullPipe")
+{
+  init_default_pipe<NullPipe>();
+  default_line(iterations);
+  init_default_pipe<CErrPipe>();
+}
+
+EXTEND_BENCH("default streams BufferPipe")
+{
+  init_default_pipe<BufferPipe<true>>();
+  BufferPipe<true>& pipe = *get_default_pipe<BufferPipe<true>>();
+  for (uint64_t i = 0; i < iterations; ++i) {
+    info << u8"request " << i << u8" done in " << 12.5 << u8" ms";
+    if (pipe.buffer.size() > 3000) {
+      pipe.buffer.clear();
+    }
+  }
+  init_default_pipe<CErrPipe>();
+}
+
+EXTEND_BENCH("default streams bound to NullPipe")
+{
+  init_default_streams(null_pipe);
+  default_line(iterations);
+  init_default_pipe<CErrPipe>();
+}
+
+intptr_t
+produce_default(void* context)
+{
+  default_line(*static_cast<uint64_t*>(context));
+  return 0;
+}
+
+// Split the lines of default streams between threads, every line reads the
+// current pipe under the epoch guard
+void
+default_threads(uint64_t iterations, unsigned count)
+{
+  constexpr unsigned MAX_THREADS = 16;
+  init_default_pipe<NullPipe>();
+  EA::Thread::Thread threads[MAX_THREADS];
+  uint64_t lines[MAX_THREADS];
+  for (unsigned i = 0; i < count; ++i) {
+    lines[i] = iterations / count + (i < iterations % count);
+    threads[i].Begin(&produce_default, &lines[i]);
+  }
+  for (unsigned i = 0; i < count; ++i) {
+    threads[i].WaitForEnd();
+  }
+  init_default_pipe<CErrPipe>();
+}
+
+EXTEND_BENCH("threads 1 default streams NullPipe")
+{
+  default_threads(iterations, 1);
+}
+
+EXTEND_BENCH("threads 4 default streams NullPipe")
+{
+  default_threads(iterations, 4);
+}
+
+EXTEND_BENCH("threads 16 default streams NullPipe")
+{
+  default_threads(iterations, 16);
+}
+
+// Producer threads
+#define BENCH_THREADS(name, pipe)                                              \
+  EXTEND_BENCH("threads 1 " name)                                              \
+  {                                                                            \
+    stream_threads(iterations, pipe, 1);                                       \
+  }                                                                            \
+  EXTEND_BENCH("threads 2 " name)                                              \
+  {                                                                            \
+    stream_threads(iterations, pipe, 2);                                       \
+  }                                                                            \
+  EXTEND_BENCH("threads 4 " name)                                              \
+  {                                                                            \
+    stream_threads(iterations, pipe, 4);                                       \
+  }                                                                            \
+  EXTEND_BENCH("threads 8 " name)                                              \
+  {                                                                            \
+    stream_threads(iterations, pipe, 8);                                       \
+  }                                                                            \
+  EXTEND_BENCH("threads 16 " name)                                             \
+  {                                                                            \
+    stream_threads(iterations, pipe, 16);                                      \
+  }
+
+BENCH_THREADS("FdPipe buffered", buffered_fd_pipe())
+BENCH_THREADS("AsyncPipe", async_pipe())
+BENCH_THREADS("FlightRecorderPipe", recorder_pipe())
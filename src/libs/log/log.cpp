@@ -17,69 +17,780 @@
 
 #include "log.h"
 
+#include <EASTL/algorithm.h>
 #include <EASTL/fixed_string.h>
+#include <EASTL/fixed_vector.h>
 #include <cassert>
-#include <iostream>
-#include <llvm/Support/ConvertUTF.h>
+#include <cerrno>
+#include <cstdlib>
+#include <sys/uio.h>
+#include <unistd.h>
 
+#include "clock.h"
 #include "dtoa.h"
+#include "posix.h"
+#include "utf.h"
 
 namespace extend::log {
 
+namespace {
 using Pipe =
   eastl::variant<CErrPipe, NullPipe, BufferPipe<true>, BufferPipe<false>>;
-Pipe default_pipe{};
-
-OStreamFactory debug = eastl::visit(
-  [](auto&& pipe) -> OStreamFactory {
-    return OStreamFactory(LEVEL::DEBUG, pipe);
-  },
-  default_pipe);
-OStreamFactory info = OStreamFactory(LEVEL::INFO, eastl::get<0>(default_pipe));
-OStreamFactory warning =
-  OStreamFactory(LEVEL::WARNING, eastl::get<0>(default_pipe));
-OStreamFactory error =
-  OStreamFactory(LEVEL::ERROR, eastl::get<0>(default_pipe));
-OStreamFactory fatal =
-  OStreamFactory(LEVEL::FATAL, eastl::get<0>(default_pipe));
-
-eastl::u8string
-IPipe::linePrefix(LEVEL level)
-{
-  switch (level) {
-    case LEVEL::DEBUG:
-      return u8"[D] ";
-    case LEVEL::INFO:
-      return u8"[I] ";
-    case LEVEL::WARNING:
-      return u8"[W] ";
-    case LEVEL::ERROR:
-      return u8"[E] ";
-    case LEVEL::FATAL:
-      return u8"[F] ";
-    default:;
-  }
-  return u8"";
+
+constexpr size_t STAGING_SIZE = 4096;
+constexpr size_t STAGING_LINES = 64;
+
+/** Write the line to the pipe by its own type, without virtual calls.
+ *
+ * Pipes of the variant are called by qualified names, so the compiler
+ * inlines them and drops NullPipe, other pipes are called through IPipe.
+ */
+template<typename T>
+void
+pipe_log(T& pipe, LEVEL level, eastl::u8string_view str)
+{
+  if constexpr (eastl::is_same_v<T, IPipe>) {
+    pipe.log(level, str);
+  } else if constexpr (!eastl::is_same_v<T, NullPipe>) {
+    pipe.T::log(level, str);
+  }
+}
+
+template<typename T>
+void
+pipe_log_batch(T& pipe, eastl::span<const Line> lines)
+{
+  if constexpr (eastl::is_same_v<T, IPipe>) {
+    pipe.log_batch(lines);
+  } else if constexpr (eastl::is_base_of_v<FdPipe, T>) {
+    pipe.FdPipe::log_batch(lines);
+  } else if constexpr (!eastl::is_same_v<T, NullPipe>) {
+    // Pipes without Prefix ignore the head, see IPipe::log_prefixed
+    for (const Line& line : lines) {
+      pipe.T::log(line.level, line.str);
+    }
+  }
+}
+
+template<typename T>
+void
+pipe_flush(T& pipe)
+{
+  if constexpr (eastl::is_same_v<T, IPipe>) {
+    pipe.flush();
+  } else {
+    pipe.T::flush();
+  }
+}
+
+/** Call f with the alternative of the variant, a chain of direct calls.
+ */
+template<size_t I = 0, typename F>
+void
+visit_pipe(Pipe& pipe, F& f)
+{
+  if constexpr (I < eastl::variant_size<Pipe>::value) {
+    if (pipe.index() == I) {
+      f(eastl::get<I>(pipe));
+    } else {
+      visit_pipe<I + 1>(pipe, f);
+    }
+  }
+}
+
+/** Read side record of a thread, see DefaultPipe::Guard.
+ */
+struct EpochReader
+{
+  /** Epoch the thread reads in, odd, or zero outside of guards. */
+  eastl::atomic<uint32_t> epoch{ 0 };
+  /** Taken by a live thread, records of exited threads are reused. */
+  eastl::atomic<bool> used{ true };
+  EpochReader* next = nullptr;
+  /** Nested guards of the thread and the slot of the outer one. */
+  uint32_t depth = 0;
+  uint32_t index = 0;
+};
+
+/** Record of the calling thread.
+ */
+EpochReader&
+thread_reader();
+
+/** Pipe of default streams, forwards lines to the current pipe.
+ *
+ * The current pipe is replaced with epoch-based reclamation. Every thread
+ * has its own record, where a reader stores the epoch it sees and then
+ * checks the epoch again, so readers share no cache line. The writer
+ * prepares the other slot, starts the next epoch and waits until no record
+ * holds the previous one, only then the old pipe is destroyed. Readers
+ * never wait for each other or for the writer.
+ */
+struct DefaultPipe final : IPipe
+{
+  struct Slot
+  {
+    IPipe* pipe = nullptr;
+    /** Variant holding the pipe, null for pipes of init_default_streams. */
+    Pipe* owned = nullptr;
+    FORMAT format = FORMAT::TEXT;
+
+    /** Call f with the pipe by its own type if it is owned, else as IPipe.
+     */
+    template<typename F>
+    void visit(F&& f) const
+    {
+      if (owned != nullptr) {
+        visit_pipe(*owned, f);
+      } else {
+        f(*pipe);
+      }
+    }
+  };
+
+  /** Read side section, the slot is alive until the guard is gone.
+   */
+  struct Guard
+  {
+    explicit Guard(DefaultPipe& p)
+      : self(p)
+      , reader(thread_reader())
+    {
+      if (reader.depth++ != 0) {
+        index = reader.index;
+        return;
+      }
+      for (;;) {
+        const uint32_t seen = self.epoch.load(eastl::memory_order_acquire);
+        reader.epoch.store(seen | 1, eastl::memory_order_seq_cst);
+        if (self.epoch.load(eastl::memory_order_seq_cst) == seen) {
+          index = (seen >> 1) & 1;
+          break;
+        }
+      }
+      reader.index = index;
+    }
+
+    ~Guard()
+    {
+      if (--reader.depth == 0) {
+        reader.epoch.store(0, eastl::memory_order_release);
+      }
+    }
+
+    const Slot& slot() const { return self.slots[index]; }
+
+    DefaultPipe& self;
+    EpochReader& reader;
+    uint32_t index = 0;
+  };
+
+  DefaultPipe()
+  {
+    slots[0].pipe = &eastl::get<CErrPipe>(owned[0]);
+    slots[0].owned = &owned[0];
+  }
+
+  virtual void log(LEVEL level, eastl::u8string_view str) override
+  {
+    Guard guard(*this);
+    guard.slot().visit([&](auto& pipe) { pipe_log(pipe, level, str); });
+  }
+
+  virtual void log_batch(eastl::span<const Line> lines) override
+  {
+    Guard guard(*this);
+    guard.slot().visit([&](auto& pipe) { pipe_log_batch(pipe, lines); });
+  }
+
+  virtual void publish(LEVEL level,
+                       FORMAT format,
+                       eastl::u8string_view str) override;
+
+  virtual void flush() override;
+
+  /** Format of the current pipe without a guard, publish() drops lines of
+   * the format of a pipe replaced since then.
+   */
+  virtual FORMAT format() const override
+  {
+    return current_format.load(eastl::memory_order_relaxed);
+  }
+
+  /** Make the pipe current, call under the lock.
+   *
+   * @param holder Variant holding the pipe, lines are then dispatched
+   *               without virtual calls.
+   */
+  void replace(IPipe& pipe, Pipe* holder = nullptr)
+  {
+    // Epochs go by two, so records of readers are odd and never zero.
+    // Readers of the epoch before the current one were waited for by the
+    // previous call, the other slot is free.
+    const uint32_t current = epoch.load(eastl::memory_order_relaxed);
+    Slot& slot = slots[((current + 2) >> 1) & 1];
+    slot.pipe = &pipe;
+    slot.owned = holder;
+    slot.format = pipe.format();
+    current_format.store(slot.format, eastl::memory_order_relaxed);
+    if (slot.format == FORMAT::BINARY) {
+      describe_sites();
+    }
+    epoch.store(current + 2, eastl::memory_order_seq_cst);
+    wait(current | 1);
+  }
+
+  void wait(uint32_t seen) const
+  {
+    for (const EpochReader* reader = readers.load(eastl::memory_order_acquire);
+         reader != nullptr;
+         reader = reader->next) {
+      while (reader->epoch.load(eastl::memory_order_seq_cst) == seen) {
+        EA::Thread::ThreadSleep();
+      }
+    }
+  }
+
+  /** Record for the calling thread, a free one or a new one.
+   *
+   * Records are never freed, there are as many as threads at the peak.
+   */
+  EpochReader& acquire_reader()
+  {
+    for (EpochReader* reader = readers.load(eastl::memory_order_acquire);
+         reader != nullptr;
+         reader = reader->next) {
+      bool expected = false;
+      if (!reader->used.load(eastl::memory_order_relaxed) &&
+          reader->used.compare_exchange_strong(
+            expected, true, eastl::memory_order_acquire)) {
+        return *reader;
+      }
+    }
+    auto* reader = new EpochReader;
+    reader->next = readers.load(eastl::memory_order_relaxed);
+    while (!readers.compare_exchange_weak(reader->next,
+                                          reader,
+                                          eastl::memory_order_release,
+                                          eastl::memory_order_relaxed)) {
+    }
+    return *reader;
+  }
+
+  eastl::atomic<uint32_t> epoch{ 0 };
+  eastl::atomic<FORMAT> current_format{ FORMAT::TEXT };
+  eastl::atomic<EpochReader*> readers{ nullptr };
+  Slot slots[2];
+
+  // Pipes of init_default_pipe, the other one is empty between calls
+  EA::Thread::Futex lock;
+  Pipe owned[2];
+  uint32_t owned_index = 0;
+};
+
+DefaultPipe default_pipe;
+
+/** Lines of default streams, staged by the thread.
+ */
+struct Staging
+{
+  struct Staged
+  {
+    LEVEL level;
+    FORMAT format;
+    uint32_t size;
+  };
+
+  ~Staging()
+  {
+    publish();
+    if (record != nullptr) {
+      record->used.store(false, eastl::memory_order_release);
+      record = nullptr;
+    }
+  }
+
+  /** Epoch record of the thread, taken on first use.
+   */
+  EpochReader& reader()
+  {
+    if (record == nullptr) {
+      record = &default_pipe.acquire_reader();
+    }
+    return *record;
+  }
+
+  /** Write staged lines to the current pipe.
+   */
+  void publish()
+  {
+    if (lines.empty()) {
+      return;
+    }
+    DefaultPipe::Guard guard(default_pipe);
+    eastl::fixed_vector<Line, STAGING_LINES, false> batch;
+    size_t offset = 0;
+    for (const Staged& staged : lines) {
+      if (staged.format == guard.slot().format) {
+        const eastl::u8string_view str(text.data() + offset, staged.size);
+        batch.push_back({ staged.level, str });
+      } else if (staged.format == FORMAT::BINARY) {
+        // The line of the replaced pipe may describe a site
+        describe_sites();
+      }
+      offset += staged.size;
+    }
+    const eastl::span<const Line> span(batch.data(), batch.size());
+    guard.slot().visit([&](auto& pipe) { pipe_log_batch(pipe, span); });
+    lines.clear();
+    text.clear();
+  }
+
+  bool enabled = false;
+  eastl::fixed_string<char8_t, STAGING_SIZE> text;
+  eastl::fixed_vector<Staged, STAGING_LINES, false> lines;
+  EpochReader* record = nullptr;
+};
+
+thread_local Staging staging;
+
+EpochReader&
+thread_reader()
+{
+  return staging.reader();
+}
+
+void
+DefaultPipe::publish(LEVEL level, FORMAT format, eastl::u8string_view str)
+{
+  Staging& staged = staging;
+  if (!staged.enabled) {
+    Guard guard(*this);
+    if (guard.slot().format == format) {
+      guard.slot().visit([&](auto& pipe) { pipe_log(pipe, level, str); });
+    } else if (format == FORMAT::BINARY) {
+      // The line of the replaced pipe may describe a site
+      describe_sites();
+    }
+    return;
+  }
+
+  const size_t size = staged.text.size() + str.size();
+  if (staged.lines.size() == STAGING_LINES ||
+      (!staged.lines.empty() && size > STAGING_SIZE)) {
+    staged.publish();
+  }
+  staged.text.append(str.data(), str.size());
+  staged.lines.push_back({ level, format, static_cast<uint32_t>(str.size()) });
+  if (level >= LEVEL::ERROR) {
+    staged.publish();
+  }
+}
+
+void
+DefaultPipe::flush()
+{
+  staging.publish();
+  Guard guard(*this);
+  guard.slot().visit([](auto& pipe) { pipe_flush(pipe); });
+}
+}
+
+LevelOStreamFactory<LEVEL::DEBUG> debug(default_pipe);
+LevelOStreamFactory<LEVEL::INFO> info(default_pipe);
+LevelOStreamFactory<LEVEL::WARNING> warning(default_pipe);
+LevelOStreamFactory<LEVEL::ERROR> error(default_pipe);
+LevelOStreamFactory<LEVEL::FATAL> fatal(default_pipe);
+
+Channel default_channel;
+
+// Never registered, so set_level does not change it
+Channel report_channel;
+
+namespace {
+// Lowest level written at runtime, see set_level
+eastl::atomic<LEVEL> level_threshold{ LEVEL::DEBUG };
+
+constexpr eastl::string_view LEVEL_NAMES[] = {
+  "debug", "info", "warning", "error", "fatal"
+};
+
+// Registered channels, pushed at construction and never removed
+Channel* channels = nullptr;
+
+// Guards channels and their levels, locals are ready during static init
+EA::Thread::Futex&
+channels_lock()
+{
+  static EA::Thread::Futex lock;
+  return lock;
+}
+
+bool
+parse_levels(eastl::string_view name, uint32_t& levels)
+{
+  if (name == "off") {
+    levels = 0;
+    return true;
+  }
+  for (size_t i = 0; i < eastl::size(LEVEL_NAMES); ++i) {
+    if (name == LEVEL_NAMES[i]) {
+      levels = levels_from(static_cast<LEVEL>(i));
+      return true;
+    }
+  }
+  return false;
+}
+
+// Call f(name, levels) for each name=level of the comma separated list
+template<typename F>
+bool
+for_each_channel_spec(eastl::string_view spec, F&& f)
+{
+  while (!spec.empty()) {
+    const size_t end = eastl::min(spec.find(','), spec.size());
+    const eastl::string_view entry = spec.substr(0, end);
+    spec.remove_prefix(eastl::min(end + 1, spec.size()));
+    if (entry.empty()) {
+      continue;
+    }
+    const size_t separator = entry.find('=');
+    uint32_t levels = 0;
+    if (separator == 0 || separator == eastl::string_view::npos ||
+        !parse_levels(entry.substr(separator + 1), levels)) {
+      return false;
+    }
+    f(entry.substr(0, separator), levels);
+  }
+  return true;
+}
+}
+
+// Site id 0 is reserved for statements without EXTEND_LOG_SITE
+static eastl::atomic<uint32_t> site_count{ 0 };
+
+// Sites with limit, pushed at construction and never removed
+static eastl::atomic<const Site*> limited_sites{ nullptr };
+
+// Report of the site as a warning, regardless of set_level
+static void
+write_suppressed(IPipe& pipe, const Site& site, uint64_t count)
+{
+  OStreamFactory factory(LEVEL::WARNING, pipe, report_channel);
+  factory << u8"suppressed " << count << u8" messages from "
+          << eastl::u8string_view(reinterpret_cast<const char8_t*>(site.file))
+          << u8':' << site.line;
+}
+
+void
+set_level(LEVEL level)
+{
+  EA::Thread::AutoFutex guard(channels_lock());
+  level_threshold.store(level, eastl::memory_order_relaxed);
+  default_channel.mask.store(levels_from(level), eastl::memory_order_relaxed);
+  for (Channel* channel = channels; channel != nullptr;
+       channel = channel->next) {
+    if (!channel->configured) {
+      channel->mask.store(levels_from(level), eastl::memory_order_relaxed);
+    }
+  }
+}
+
+LEVEL
+get_level()
+{
+  return level_threshold.load(eastl::memory_order_relaxed);
+}
+
+Channel::Channel(const char* n)
+  : name(n)
+  , mask(0)
+{
+  EA::Thread::AutoFutex guard(channels_lock());
+  mask.store(levels_from(level_threshold.load(eastl::memory_order_relaxed)),
+             eastl::memory_order_relaxed);
+  next = channels;
+  channels = this;
+
+  if (const char* spec = getenv("EXTEND_LOG_CHANNELS")) {
+    for_each_channel_spec(
+      spec, [this](eastl::string_view channel, uint32_t levels) {
+        if (channel == name) {
+          mask.store(levels, eastl::memory_order_relaxed);
+          configured = true;
+        }
+      });
+  }
+}
+
+void
+Channel::set_level(LEVEL level)
+{
+  set_levels(levels_from(level));
+}
+
+void
+Channel::set_levels(uint32_t levels)
+{
+  EA::Thread::AutoFutex guard(channels_lock());
+  mask.store(levels, eastl::memory_order_relaxed);
+  configured = true;
+}
+
+void
+Channel::reset()
+{
+  EA::Thread::AutoFutex guard(channels_lock());
+  mask.store(levels_from(level_threshold.load(eastl::memory_order_relaxed)),
+             eastl::memory_order_relaxed);
+  configured = false;
+}
+
+bool
+configure_channels(eastl::string_view spec)
+{
+  EA::Thread::AutoFutex guard(channels_lock());
+  return for_each_channel_spec(
+    spec, [](eastl::string_view name, uint32_t levels) {
+      for (Channel* channel = channels; channel != nullptr;
+           channel = channel->next) {
+        if (name == channel->name) {
+          channel->mask.store(levels, eastl::memory_order_relaxed);
+          channel->configured = true;
+        }
+      }
+    });
+}
+
+ChannelStreams::ChannelStreams(const char* name)
+  : channel(name)
+  , debug(default_pipe, channel)
+  , info(default_pipe, channel)
+  , warning(default_pipe, channel)
+  , error(default_pipe, channel)
+  , fatal(default_pipe, channel)
+{}
+
+void
+IPipe::log_batch(eastl::span<const Line> lines)
+{
+  for (const Line& line : lines) {
+    if (line.head.empty()) {
+      log(line.level, line.str);
+    } else {
+      log_prefixed(line.level, line.head, line.str);
+    }
+  }
+}
+
+void
+IPipe::log_prefixed(LEVEL level, eastl::u8string_view, eastl::u8string_view str)
+{
+  log(level, str);
+}
+
+void
+IPipe::publish(LEVEL level, FORMAT, eastl::u8string_view str)
+{
+  log(level, str);
+}
+
+void
+IPipe::flush()
+{}
+
+FORMAT
+IPipe::format() const
+{
+  return FORMAT::TEXT;
+}
+
+Site::Site(const char* f, uint32_t l)
+  : Site(f, l, Limit{})
+{}
+
+Site::Site(const char* f, uint32_t l, Limit lim)
+  : file(f)
+  , line(l)
+  , id(site_count.fetch_add(1, eastl::memory_order_relaxed) + 1)
+  , limit(lim)
+{
+  if (limit.every > 1 || limit.per_second != 0) {
+    next_limited = limited_sites.load(eastl::memory_order_relaxed);
+    while (!limited_sites.compare_exchange_weak(
+      next_limited, this, eastl::memory_order_release)) {
+    }
+  }
+}
+
+bool
+Site::allow() const
+{
+  if (limit.every > 1 &&
+      sampled.fetch_add(1, eastl::memory_order_relaxed) % limit.every != 0) {
+    suppressed.fetch_add(1, eastl::memory_order_relaxed);
+    return false;
+  }
+  if (limit.per_second == 0) {
+    return true;
+  }
+
+  // The line conforms if it is at most burst - 1 intervals early
+  constexpr int64_t NS_PER_SECOND = 1000000000;
+  const int64_t interval = NS_PER_SECOND / limit.per_second;
+  const int64_t tolerance =
+    interval * (limit.burst == 0 ? 0 : limit.burst - 1);
+  const int64_t now = Clock::now();
+  int64_t expected = arrival.load(eastl::memory_order_relaxed);
+  for (;;) {
+    if (expected - now > tolerance) {
+      suppressed.fetch_add(1, eastl::memory_order_relaxed);
+      return false;
+    }
+    const int64_t next = eastl::max(expected, now) + interval;
+    if (arrival.compare_exchange_weak(
+          expected, next, eastl::memory_order_relaxed)) {
+      return true;
+    }
+  }
+}
+
+void
+report_suppressed()
+{
+  for (const Site* site = limited_sites.load(eastl::memory_order_acquire);
+       site != nullptr;
+       site = site->next_limited) {
+    const uint64_t count =
+      site->suppressed.exchange(0, eastl::memory_order_relaxed);
+    if (count != 0) {
+      write_suppressed(default_pipe, *site, count);
+    }
+  }
 }
 
 void
 NullPipe::log(LEVEL, eastl::u8string_view)
 {}
+namespace {
+iovec
+chunk(eastl::u8string_view str)
+{
+  return { const_cast<char8_t*>(str.data()), str.size() };
+}
+}
+
+FdPipe::FdPipe(int f, size_t size, int64_t delay, Prefix p)
+  : fd(f)
+  , buffer_size(size)
+  , delay_ms(delay)
+  , prefix(p)
+{}
+
+FdPipe::~FdPipe()
+{
+  flush();
+}
+
 void
-CErrPipe::log(LEVEL level, eastl::u8string_view str)
+FdPipe::log(LEVEL level, eastl::u8string_view str)
 {
-  eastl::u8string prefix = linePrefix(level);
-  std::cerr.write(reinterpret_cast<const char*>(prefix.c_str()), prefix.size());
-  std::cerr.write(reinterpret_cast<const char*>(str.data()), str.size());
-  std::cerr << std::endl;
+  char8_t head[Prefix::MAX_SIZE];
+  const size_t head_size = prefix.write(level, head);
+  write_line(level, { head, head_size }, str);
 }
 
+void
+FdPipe::log_prefixed(LEVEL level,
+                     eastl::u8string_view head,
+                     eastl::u8string_view str)
+{
+  write_line(level, head, str);
+}
+
+void
+FdPipe::write_line(LEVEL level,
+                   eastl::u8string_view head,
+                   eastl::u8string_view str)
+{
+  EA::Thread::AutoFutex guard(lock);
+
+  // The line goes out together with the buffer, so it is never copied when
+  // written right away
+  const size_t size = head.size() + str.size() + 1;
+  if (buffer_size == 0 || level >= LEVEL::ERROR ||
+      buffer.size() + size > buffer_size ||
+      (!buffer.empty() && EA::Thread::GetThreadTime() >= deadline)) {
+    char8_t newline = u8'\n';
+    iovec iov[] = {
+      chunk(buffer), chunk(head), chunk(str), { &newline, 1 }
+    };
+    write_all(fd, iov, 4);
+    buffer.clear();
+    return;
+  }
+
+  if (buffer.empty()) {
+    deadline = EA::Thread::GetThreadTime() + delay_ms;
+  }
+  buffer.append(head.data(), head.size());
+  buffer.append(str.data(), str.size());
+  buffer.push_back(u8'\n');
+}
+
+void
+FdPipe::log_batch(eastl::span<const Line> lines)
+{
+  EA::Thread::AutoFutex guard(lock);
+  if (buffer.empty()) {
+    deadline = EA::Thread::GetThreadTime() + delay_ms;
+  }
+  bool urgent = false;
+  char8_t head[Prefix::MAX_SIZE];
+  for (const Line& line : lines) {
+    if (line.head.empty()) {
+      buffer.append(head, prefix.write(line.level, head));
+    } else {
+      buffer.append(line.head.data(), line.head.size());
+    }
+    buffer.append(line.str.data(), line.str.size());
+    buffer.push_back(u8'\n');
+    urgent |= line.level >= LEVEL::ERROR;
+  }
+  if (buffer_size == 0 || urgent || buffer.size() >= buffer_size ||
+      EA::Thread::GetThreadTime() >= deadline) {
+    write_buffer();
+  }
+}
+
+void
+FdPipe::flush()
+{
+  EA::Thread::AutoFutex guard(lock);
+  write_buffer();
+}
+
+void
+FdPipe::write_buffer()
+{
+  if (!buffer.empty()) {
+    iovec iov = chunk(buffer);
+    write_all(fd, &iov, 1);
+    buffer.clear();
+  }
+}
+
+CErrPipe::CErrPipe()
+  : FdPipe(STDERR_FILENO)
+{}
+
 template<bool enable_prefix>
 void
 BufferPipe<enable_prefix>::log(LEVEL level, eastl::u8string_view str)
 {
+  EA::Thread::AutoFutex guard(lock);
   if constexpr (enable_prefix) {
-    eastl::u8string prefix = linePrefix(level);
+    const eastl::u8string_view prefix = linePrefix(level);
     buffer.append(prefix.data(), prefix.size());
   }
   buffer.append(str.data(), str.size());
@@ -90,23 +801,42 @@ template<typename T>
 void
 init_default_pipe()
 {
-  default_pipe.emplace<T>();
-  eastl::visit(
-    [](auto&& pipe) {
-      debug = OStreamFactory(LEVEL::DEBUG, pipe);
-      info = OStreamFactory(LEVEL::INFO, pipe);
-      warning = OStreamFactory(LEVEL::WARNING, pipe);
-      error = OStreamFactory(LEVEL::ERROR, pipe);
-      fatal = OStreamFactory(LEVEL::FATAL, pipe);
-    },
-    default_pipe);
+  EA::Thread::AutoFutex guard(default_pipe.lock);
+  const uint32_t next = default_pipe.owned_index ^ 1;
+  Pipe& pipe = default_pipe.owned[next];
+  pipe.emplace<T>();
+  default_pipe.replace(eastl::get<T>(pipe), &pipe);
+  default_pipe.owned[default_pipe.owned_index].emplace<NullPipe>();
+  default_pipe.owned_index = next;
+}
+
+void
+init_default_streams(IPipe& pipe)
+{
+  EA::Thread::AutoFutex guard(default_pipe.lock);
+  default_pipe.replace(pipe);
 }
 
 template<typename T>
 T*
 get_default_pipe()
 {
-  return eastl::get_if<T>(&default_pipe);
+  return eastl::get_if<T>(&default_pipe.owned[default_pipe.owned_index]);
+}
+
+void
+set_thread_staging(bool enable)
+{
+  if (!enable) {
+    staging.publish();
+  }
+  staging.enabled = enable;
+}
+
+void
+flush_thread()
+{
+  staging.publish();
 }
 
 template void
@@ -127,178 +857,227 @@ get_default_pipe<BufferPipe<false>>();
 template BufferPipe<true>*
 get_default_pipe<BufferPipe<true>>();
 
-OStream&
-OStream::operator<<(int8_t x)
+void
+OStream::append(int8_t x)
 {
-  line.append_sprintf(u8"%I8d", x);
-  return *this;
+  ssize_t oldSize = line.size();
+  line.resize(oldSize + 11);
+  line.resize(itoa(static_cast<int32_t>(x), line.begin() + oldSize) + oldSize);
 }
 
-OStream&
-OStream::operator<<(uint8_t x)
+void
+OStream::append(uint8_t x)
 {
-  line.append_sprintf(u8"%I8u", x);
-  return *this;
+  ssize_t oldSize = line.size();
+  line.resize(oldSize + 11);
+  line.resize(utoa(static_cast<uint32_t>(x), line.begin() + oldSize) +
+              oldSize);
 }
 
-OStream&
-OStream::operator<<(int16_t x)
+void
+OStream::append(int16_t x)
 {
-  line.append_sprintf(u8"%I16d", x);
-  return *this;
+  ssize_t oldSize = line.size();
+  line.resize(oldSize + 11);
+  line.resize(itoa(static_cast<int32_t>(x), line.begin() + oldSize) + oldSize);
 }
 
-OStream&
-OStream::operator<<(uint16_t x)
+void
+OStream::append(uint16_t x)
 {
-  line.append_sprintf(u8"%I16u", x);
-  return *this;
+  ssize_t oldSize = line.size();
+  line.resize(oldSize + 11);
+  line.resize(utoa(static_cast<uint32_t>(x), line.begin() + oldSize) +
+              oldSize);
 }
 
-OStream&
-OStream::operator<<(uint32_t x)
+void
+OStream::append(uint32_t x)
 {
-  line.append_sprintf(u8"%I32u", x);
-  return *this;
+  ssize_t oldSize = line.size();
+  line.resize(oldSize + 11);
+  line.resize(utoa(x, line.begin() + oldSize) + oldSize);
 }
 
-OStream&
-OStream::operator<<(int32_t x)
+void
+OStream::append(int32_t x)
 {
-  line.append_sprintf(u8"%I32d", x);
-  return *this;
+  ssize_t oldSize = line.size();
+  line.resize(oldSize + 11);
+  line.resize(itoa(x, line.begin() + oldSize) + oldSize);
 }
 
-OStream&
-OStream::operator<<(uint64_t x)
+void
+OStream::append(uint64_t x)
 {
-  line.append_sprintf(u8"%I64u", x);
-  return *this;
+  ssize_t oldSize = line.size();
+  line.resize(oldSize + 21);
+  line.resize(utoa(x, line.begin() + oldSize) + oldSize);
 }
 
-OStream&
-OStream::operator<<(int64_t x)
+void
+OStream::append(int64_t x)
 {
-  line.append_sprintf(u8"%I64d", x);
-  return *this;
+  ssize_t oldSize = line.size();
+  line.resize(oldSize + 21);
+  line.resize(itoa(x, line.begin() + oldSize) + oldSize);
 }
 
-OStream&
-OStream::operator<<(double x)
+void
+OStream::append(double x)
 {
   ssize_t oldSize = line.size();
-  line.resize(oldSize + 25);
-  line.resize(dtoa(x, line.begin() + oldSize) + oldSize);
-  return *this;
+  const uint32_t precision = float_format.precision;
+  switch (float_format.notation) {
+    case NOTATION::SHORTEST:
+      line.resize(oldSize + 25);
+      line.resize(dtoa(x, line.begin() + oldSize) + oldSize);
+      break;
+    case NOTATION::FIXED:
+      line.resize(oldSize + dtoa_fixed_length(x, precision));
+      line.resize(dtoa_fixed(x, precision, line.begin() + oldSize) + oldSize);
+      break;
+    case NOTATION::SCIENTIFIC:
+      line.resize(oldSize + precision + 8);
+      line.resize(dtoa_exp(x, precision, line.begin() + oldSize) + oldSize);
+      break;
+  }
 }
 
-OStream&
-OStream::operator<<(float x)
+void
+OStream::append(float x)
 {
+  if (float_format.notation != NOTATION::SHORTEST) {
+    append(static_cast<double>(x));
+    return;
+  }
   ssize_t oldSize = line.size();
   line.resize(oldSize + 16);
   line.resize(ftoa(x, line.begin() + oldSize) + oldSize);
-  return *this;
 }
 
-OStream&
-OStream::operator<<(long double x)
+void
+OStream::append(long double x)
 {
-  return operator<<(static_cast<double>(x));
+  append(static_cast<double>(x));
 }
 
-OStream&
-OStream::operator<<(char8_t c)
+void
+OStream::append(char8_t c)
 {
   line.append_sprintf(u8"%c", c);
-  return *this;
 }
 
-template<typename LLVMCharType, typename F, F convert, typename T>
-static inline void
-append_string(eastl::fixed_string<char8_t, 256>& line, T str)
+void
+OStream::append(char16_t c)
 {
-  ssize_t old_size = line.size();
-  line.resize(line.size() + str.size() * UNI_MAX_UTF8_BYTES_PER_CODE_POINT);
-  llvm::UTF8* storage_ptr =
-    reinterpret_cast<llvm::UTF8*>(line.data() + old_size);
-  const LLVMCharType* source_ptr =
-    reinterpret_cast<const LLVMCharType*>(str.data());
-  llvm::ConversionResult errorCode =
-    convert(&source_ptr,
-            reinterpret_cast<const LLVMCharType*>(str.end()),
-            &storage_ptr,
-            reinterpret_cast<llvm::UTF8*>(line.end()),
-            llvm::ConversionFlags::strictConversion);
-  (void)errorCode;
-  assert(errorCode == llvm::ConversionResult::conversionOK);
-  line.resize(reinterpret_cast<char8_t*>(storage_ptr) - line.begin());
+  if (c < 0x80) {
+    line.push_back(static_cast<char8_t>(c));
+    return;
+  }
+  char8_t buffer[UTF8_PER_UTF16];
+  const Transcoded result = utf16_to_utf8({ &c, 1 }, buffer);
+  assert(result.valid);
+  line.append(buffer, result.size);
 }
 
-OStream&
-OStream::operator<<(char16_t c)
+void
+OStream::append(char32_t c)
 {
-  eastl::array<char16_t, 1> str = { c };
-  append_string<llvm::UTF16,
-                decltype(llvm::ConvertUTF16toUTF8),
-                llvm::ConvertUTF16toUTF8>(line, str);
-  return *this;
+  if (c < 0x80) {
+    line.push_back(static_cast<char8_t>(c));
+    return;
+  }
+  char8_t buffer[UTF8_PER_UTF32];
+  const Transcoded result = utf32_to_utf8({ &c, 1 }, buffer);
+  assert(result.valid);
+  line.append(buffer, result.size);
 }
 
-OStream&
-OStream::operator<<(char32_t c)
+void
+OStream::append(eastl::u8string_view str)
 {
-  eastl::array<char32_t, 1> str = { c };
-  append_string<llvm::UTF32,
-                decltype(llvm::ConvertUTF32toUTF8),
-                llvm::ConvertUTF32toUTF8>(line, str);
-  return *this;
+  line.append(str.data(), str.size());
 }
 
-OStream&
-OStream::operator<<(eastl::u8string_view str)
+void
+OStream::append(eastl::u16string_view str)
 {
-  line.append(str.data(), str.size());
-  return *this;
+  const size_t size = line.size();
+  line.resize(size + str.size() * UTF8_PER_UTF16);
+  const Transcoded result = utf16_to_utf8(str, line.data() + size);
+  assert(result.valid);
+  line.resize(size + result.size);
 }
 
-OStream&
-OStream::operator<<(eastl::u16string_view str)
+void
+OStream::append(eastl::u32string_view str)
 {
-  append_string<llvm::UTF16,
-                decltype(llvm::ConvertUTF16toUTF8),
-                llvm::ConvertUTF16toUTF8>(line, str);
-  return *this;
+  const size_t size = line.size();
+  line.resize(size + str.size() * UTF8_PER_UTF32);
+  const Transcoded result = utf32_to_utf8(str, line.data() + size);
+  assert(result.valid);
+  line.resize(size + result.size);
+}
+
+void
+OStream::append(FieldKey key)
+{
+  if (!line.empty()) {
+    line.push_back(u8' ');
+  }
+  line.append(key.name.data(), key.name.size());
+  line.push_back(u8'=');
 }
 
 OStream&
-OStream::operator<<(eastl::u32string_view str)
+OStream::operator<<(const Site& site)
 {
-  append_string<llvm::UTF32,
-                decltype(llvm::ConvertUTF32toUTF8),
-                llvm::ConvertUTF32toUTF8>(line, str);
+  if (!enable) {
+    return *this;
+  }
+  if (!site.allow()) {
+    enable = false;
+    return *this;
+  }
+
+  const uint64_t count =
+    site.suppressed.exchange(0, eastl::memory_order_relaxed);
+  if (count != 0) {
+    write_suppressed(pipe, site, count);
+  }
+  if (format == FORMAT::TEXT) {
+    append(site);
+  } else {
+    encode(site);
+  }
   return *this;
 }
 
 OStream::OStream(OStreamFactory& f)
   : level(f.level)
   , pipe(f.pipe)
-  , enable(true)
-{}
-
-OStream::OStream(OStream&& s)
-  : level(s.level)
-  , pipe(s.pipe)
-  , enable(true)
-  , line(eastl::move(s.line))
+  , enable(f.enabled())
 {
-  s.enable = false;
+  if (enable) {
+    // DefaultPipe is final, calls through it are direct
+    if (&pipe.get() == &default_pipe) {
+      format = default_pipe.format();
+    } else {
+      format = pipe.get().format();
+    }
+  }
 }
 
 OStream::~OStream()
 {
   if (enable) {
-    pipe.get().log(level, line);
+    count_line(line);
+    if (&pipe.get() == &default_pipe) {
+      default_pipe.publish(level, format, line);
+    } else {
+      pipe.get().publish(level, format, line);
+    }
   }
 }
 }
@@ -17,10 +17,17 @@
 
 #pragma once
 
+#include <EASTL/atomic.h>
 #include <EASTL/fixed_string.h>
 #include <EASTL/internal/functional_base.h>
+#include <EASTL/span.h>
 #include <EASTL/string.h>
 #include <EASTL/variant.h>
+#include <eathread/eathread.h>
+#include <eathread/eathread_futex.h>
+
+#include "join.h"
+#include "line.h"
 
 namespace extend::log {
 
@@ -33,6 +40,246 @@ enum struct LEVEL
   FATAL
 };
 
+#ifndef EXTEND_LOG_MIN_LEVEL
+#define EXTEND_LOG_MIN_LEVEL DEBUG
+#endif
+
+/** Lowest level compiled in, streams below it are removed by the compiler.
+ *
+ * Set by EXTEND_LOG_MIN_LEVEL build option.
+ */
+constexpr LEVEL MIN_LEVEL = LEVEL::EXTEND_LOG_MIN_LEVEL;
+
+/** Skip formatting of streams below the level, the lowest level written at
+ * runtime.
+ */
+void
+set_level(LEVEL level);
+
+LEVEL
+get_level();
+
+/** How stream arguments are written into the line.
+ */
+enum struct FORMAT
+{
+  TEXT,
+  /** Tagged raw values, formatted offline by logdecode, see binary.h. */
+  BINARY
+};
+
+/** Limit of lines from one site, see EXTEND_LOG_SITE_EVERY and
+ * EXTEND_LOG_SITE_RATE.
+ */
+struct Limit
+{
+  /** Write 1 of every N lines, 0 and 1 write all. */
+  uint32_t every = 0;
+  /** Lines per second, 0 for unlimited. */
+  uint32_t per_second = 0;
+  /** Lines written at once before the rate applies. */
+  uint32_t burst = 1;
+};
+
+/** Static info about a log statement, see EXTEND_LOG_SITE.
+ */
+struct Site
+{
+  const char* file;
+  uint32_t line;
+  uint32_t id;
+  /** Generation of binary output the site was described in, binary streams
+   * write file and line of the site once per generation, see describe_sites.
+   */
+  mutable eastl::atomic<uint32_t> described{ 0 };
+
+  const Limit limit;
+  /** Lines of the site dropped by the limit since the last report. */
+  mutable eastl::atomic<uint64_t> suppressed{ 0 };
+  /** Next site with limit, see report_suppressed. */
+  const Site* next_limited = nullptr;
+
+  Site(const char* f, uint32_t l);
+  Site(const char* f, uint32_t l, Limit limit);
+
+  /** Check the limit, lock-free. Dropped lines are counted in suppressed.
+   */
+  bool allow() const;
+
+private:
+  mutable eastl::atomic<uint64_t> sampled{ 0 };
+  /** Theoretical arrival time of the next line in ns, GCRA token bucket. */
+  mutable eastl::atomic<int64_t> arrival{ 0 };
+};
+
+/** Static call site of the log statement.
+ *
+ * Stream it first: debug << EXTEND_LOG_SITE << x;
+ */
+#define EXTEND_LOG_SITE                                                        \
+  ([]() -> const ::extend::log::Site& {                                        \
+    static const ::extend::log::Site site(__FILE__, __LINE__);                 \
+    return site;                                                               \
+  }())
+
+/** Start a new generation of binary output, binary streams describe every
+ * site again with the next line of it.
+ *
+ * Pipes call it when a binary output opens or misses lines: a describing
+ * line may be lost or written before the output.
+ */
+void
+describe_sites();
+
+/** Call site that writes 1 of every n lines.
+ *
+ * Stream it first, the rest of the stream is not formatted when the line
+ * is dropped: warning << EXTEND_LOG_SITE_EVERY(100) << x;
+ */
+#define EXTEND_LOG_SITE_EVERY(n)                                               \
+  ([]() -> const ::extend::log::Site& {                                        \
+    static const ::extend::log::Site site(                                     \
+      __FILE__, __LINE__, ::extend::log::Limit{ (n), 0, 1 });                  \
+    return site;                                                               \
+  }())
+
+/** Call site that writes at most per_second lines per second on average
+ * and up to burst lines at once, the same way as EXTEND_LOG_SITE_EVERY.
+ */
+#define EXTEND_LOG_SITE_RATE(per_second, burst)                                \
+  ([]() -> const ::extend::log::Site& {                                        \
+    static const ::extend::log::Site site(                                     \
+      __FILE__, __LINE__, ::extend::log::Limit{ 0, (per_second), (burst) });   \
+    return site;                                                               \
+  }())
+
+/** Key of structured field, see field().
+ */
+struct FieldKey
+{
+  eastl::u8string_view name;
+};
+
+/** Structured field, see field().
+ */
+template<typename T>
+struct Field
+{
+  FieldKey key;
+  T value;
+};
+
+/** Key/value argument: info << field(u8"latency_us", 123.4);
+ *
+ * Text format writes it as " key=value", binary keeps the key, so
+ * JsonPipe writes the field as a member of the JSON object. Keys level,
+ * site, file, line and msg of the object itself get a '_' in front.
+ *
+ * The value is copied, arrays decay to pointers, so the field may be kept
+ * and streamed later. The key is a view, it should outlive the field.
+ */
+template<typename T>
+Field<eastl::decay_t<const T>>
+field(eastl::u8string_view key, const T& value)
+{
+  return { { key }, value };
+}
+
+/** Notation of floating point arguments, see fixed().
+ */
+enum struct NOTATION : uint8_t
+{
+  /** Shortest digits that read back to the same value, the default. */
+  SHORTEST,
+  /** Digits after the point, as printf "%.*f". */
+  FIXED,
+  /** One digit before the point and the exponent, as printf "%.*e". */
+  SCIENTIFIC
+};
+
+/** Largest precision of fixed() and scientific(): the smallest subnormal
+ * double has 1074 digits after the point, more digits are only zeros.
+ */
+constexpr uint32_t MAX_PRECISION = 1074;
+
+/** Notation and precision of floating point arguments, see fixed().
+ */
+struct FloatFormat
+{
+  NOTATION notation = NOTATION::SHORTEST;
+  uint32_t precision = 0;
+};
+
+/** Write the following floats of the line with precision digits after the
+ * point: info << fixed(3) << 2.0 / 3; writes "0.667".
+ *
+ * Output is the same as printf "%.*f" of glibc: digits are exact and ties
+ * are rounded to even. Floats are promoted to double, as printf does.
+ * Precision is capped at MAX_PRECISION.
+ */
+constexpr FloatFormat
+fixed(uint32_t precision = 6)
+{
+  return { NOTATION::FIXED,
+           precision < MAX_PRECISION ? precision : MAX_PRECISION };
+}
+
+/** Write the following floats the same as printf "%.*e", e.g. "6.667e-01".
+ * Precision is capped at MAX_PRECISION.
+ */
+constexpr FloatFormat
+scientific(uint32_t precision = 6)
+{
+  return { NOTATION::SCIENTIFIC,
+           precision < MAX_PRECISION ? precision : MAX_PRECISION };
+}
+
+/** Write the following floats with the shortest digits again.
+ */
+constexpr FloatFormat
+shortest()
+{
+  return {};
+}
+
+/** Tags of levels, "[D] " to "[F] ".
+ */
+inline constexpr eastl::u8string_view LEVEL_TAGS[] = {
+  u8"[D] ", u8"[I] ", u8"[W] ", u8"[E] ", u8"[F] "
+};
+
+/** Line prefix: level tag, optional timestamp and thread id.
+ *
+ * For example "[I] 2022-10-16T12:34:56.123456 4242 ". The timestamp is UTC
+ * from Clock, the thread caches the formatted date and time and rewrites
+ * only the microseconds until the second changes. The thread id is
+ * formatted once per thread.
+ */
+struct Prefix
+{
+  /** Longest prefix, the size of the buffer for write().
+   */
+  static constexpr size_t MAX_SIZE = 64;
+
+  bool time = false;
+  bool thread = false;
+
+  /** Write the prefix into out, MAX_SIZE chars at least.
+   * @return Count of written chars.
+   */
+  size_t write(LEVEL level, char8_t* out) const;
+};
+
+/** Line of a batch, see IPipe::log_batch.
+ */
+struct Line
+{
+  LEVEL level;
+  eastl::u8string_view str;
+  /** Prefix built by the caller, see IPipe::log_prefixed, or empty. */
+  eastl::u8string_view head = {};
+};
+
 /** Write to file or stream
  */
 struct IPipe
@@ -47,24 +294,161 @@ struct IPipe
   /** Write one line to file or stream.
    */
   virtual void log(LEVEL level, eastl::u8string_view str) = 0;
-  static eastl::u8string linePrefix(LEVEL level);
+
+  /** Write lines of one thread in order, by default one by one.
+   */
+  virtual void log_batch(eastl::span<const Line> lines);
+
+  /** Write line after the prefix built by the caller, once for several
+   * pipes, see TeePipe. Pipes with Prefix write head instead of their own,
+   * by default log() is called and head is ignored.
+   */
+  virtual void log_prefixed(LEVEL level,
+                            eastl::u8string_view head,
+                            eastl::u8string_view str);
+
+  /** Write line of the stream, formatted as the pipe format was at the
+   * start of the stream.
+   *
+   * Calls log() by default, the pipe of default streams drops lines of the
+   * format of the pipe it has replaced since the start.
+   */
+  virtual void publish(LEVEL level, FORMAT format, eastl::u8string_view str);
+
+  /** Write buffered lines, if any.
+   */
+  virtual void flush();
+
+  /** Expected format of lines.
+   */
+  virtual FORMAT format() const;
+
+  /** Level tag, for pipes without Prefix.
+   */
+  static constexpr eastl::u8string_view linePrefix(LEVEL level)
+  {
+    const auto index = static_cast<size_t>(level);
+    return index < eastl::size(LEVEL_TAGS) ? LEVEL_TAGS[index] : u8"";
+  }
 };
 
+/** Mask of levels from the level up, e.g. for Channel::set_levels.
+ */
+constexpr uint32_t
+levels_from(LEVEL level)
+{
+  return (1u << (static_cast<uint32_t>(LEVEL::FATAL) + 1)) -
+         (1u << static_cast<uint32_t>(level));
+}
+
+/** Named subsystem with its own runtime levels, see channel.
+ *
+ * A channel follows set_level until its levels are set, by the calls below
+ * or by EXTEND_LOG_CHANNELS environment variable read at construction, e.g.
+ * EXTEND_LOG_CHANNELS=lexer=debug,parser=off.
+ */
+struct Channel
+{
+  const char* const name;
+  /** Bit per written level, 1 << LEVEL. */
+  eastl::atomic<uint32_t> mask;
+
+  /** Register the channel, it should live until exit.
+   */
+  explicit Channel(const char* name);
+
+  /** Channel of the default streams and of factories without channel.
+   */
+  constexpr Channel()
+    : name("")
+    , mask(levels_from(LEVEL::DEBUG))
+  {}
+
+  Channel(const Channel&) = delete;
+  Channel& operator=(const Channel&) = delete;
+
+  /** Single relaxed load.
+   */
+  bool enabled(LEVEL level) const
+  {
+    return (mask.load(eastl::memory_order_relaxed) >>
+            static_cast<uint32_t>(level)) &
+           1;
+  }
+
+  /** Write the level and above, regardless of set_level.
+   */
+  void set_level(LEVEL level);
+
+  /** Write levels of the mask, regardless of set_level.
+   */
+  void set_levels(uint32_t levels);
+
+  /** Follow set_level again.
+   */
+  void reset();
+
+private:
+  friend void set_level(LEVEL level);
+  friend bool configure_channels(eastl::string_view spec);
+
+  bool configured = false;
+  Channel* next = nullptr;
+};
+
+/** Channel of the default streams.
+ */
+extern Channel default_channel;
+
+/** Channel of reports of the library itself, always on: counts of dropped
+ * and suppressed lines are written regardless of set_level.
+ */
+extern Channel report_channel;
+
+/** Set levels of registered channels by a list of name=level, the same as
+ * EXTEND_LOG_CHANNELS. Level is debug, info, warning, error, fatal or off.
+ * Unknown names are skipped.
+ *
+ * @return False if the list is malformed, the entries before the error are
+ *         applied.
+ */
+bool
+configure_channels(eastl::string_view spec);
+
 /** Info to create an output stream
  */
 struct OStreamFactory
 {
   LEVEL level;
   eastl::reference_wrapper<IPipe> pipe;
+  const Channel* channel;
 
-  OStreamFactory(LEVEL l, IPipe& p)
+  OStreamFactory(LEVEL l, IPipe& p, const Channel& c = default_channel)
     : level(l)
     , pipe(p)
+    , channel(&c)
   {}
   OStreamFactory(OStreamFactory&& s) = default;
   OStreamFactory& operator=(OStreamFactory&& s) = default;
   OStreamFactory(const OStreamFactory&) = delete;
   OStreamFactory& operator=(const OStreamFactory&) = delete;
+
+  /** Check runtime levels of the channel, single relaxed load.
+   */
+  bool enabled() const { return channel->enabled(level); }
+};
+
+/** Factory with level known at compile time.
+ *
+ * Streams below MIN, MIN_LEVEL by default, are compiled to nothing.
+ */
+template<LEVEL L, LEVEL MIN = MIN_LEVEL>
+struct LevelOStreamFactory : OStreamFactory
+{
+  explicit LevelOStreamFactory(IPipe& p, const Channel& c = default_channel)
+    : OStreamFactory(L, p, c)
+  {}
+  using OStreamFactory::operator=;
 };
 
 /** Output stream.
@@ -73,64 +457,246 @@ struct OStream
 {
   LEVEL level = LEVEL::DEBUG;
   eastl::reference_wrapper<IPipe> pipe;
+  FORMAT format = FORMAT::TEXT;
   bool enable = false;
-  eastl::fixed_string<char8_t, 256> line;
+  /** Notation of floats, set by fixed() and scientific(). */
+  FloatFormat float_format;
+  LineBuffer line;
 
   /** Build stream from factory.
-   *
-   * Factory creates stream in OStreamFactory::operator<<
    */
   OStream(OStreamFactory& f);
 
-  /** Move stream.
+  /** Build stream from factory and stream the first argument.
    *
-   * Factory moves out stream from OStreamFactory::operator<<
+   * OStreamFactory::operator<< returns it as prvalue, so the line is built
+   * in place: the stream is neither moved nor copied.
    */
-  OStream(OStream&& s);
+  template<typename T>
+  OStream(OStreamFactory& f, const T& x)
+    : OStream(f)
+  {
+    *this << x;
+  }
 
   /** Write message to log.
    */
   ~OStream();
 
+  OStream(OStream&& s) = delete;
   OStream& operator=(OStream&& s) = delete;
   OStream(const OStream&) = delete;
   OStream& operator=(const OStream&) = delete;
 
-  OStream& operator<<(char8_t c);
-  OStream& operator<<(char16_t c);
-  OStream& operator<<(char32_t c);
+  /** Check limit of the site, disable the stream if the line is dropped.
+   *
+   * The first line after dropped ones is preceded by a line with their
+   * count.
+   */
+  OStream& operator<<(const Site& site);
+
+  /** Format x, disabled stream skips formatting.
+   */
+  template<typename T>
+  OStream& operator<<(const T& x)
+  {
+    if (enable) {
+      if (format == FORMAT::TEXT) {
+        append(x);
+      } else {
+        encode(x);
+      }
+    }
+    return *this;
+  }
+
+  void append(char8_t c);
+  void append(char16_t c);
+  void append(char32_t c);
+
+  void append(eastl::u8string_view str);
+  void append(eastl::u16string_view str);
+  void append(eastl::u32string_view str);
+
+  void append(int8_t x);
+  void append(int16_t x);
+  void append(int32_t x);
+  void append(int64_t x);
+
+  void append(uint8_t x);
+  void append(uint16_t x);
+  void append(uint32_t x);
+  void append(uint64_t x);
+
+  void append(float x);
+  void append(double x);
+  void append(long double x);
+
+  /** Sites are used by binary format only.
+   */
+  void append(const Site&) {}
+
+  /** Notation of the following floats.
+   */
+  void append(FloatFormat f) { float_format = f; }
+
+  /** Space unless the line is empty, the key and '='.
+   */
+  void append(FieldKey key);
+
+  template<typename T>
+  void append(const Field<T>& f)
+  {
+    append(f.key);
+    append(f.value);
+  }
+
+  /** Elements and separators formatted into one reserved block, see join().
+   */
+  template<typename T>
+  void append(const Join<T>& j);
+
+  /** Binary format, see binary.h
+   */
+  void encode(char8_t c);
+  void encode(char16_t c);
+  void encode(char32_t c);
+
+  void encode(eastl::u8string_view str);
+  void encode(eastl::u16string_view str);
+  void encode(eastl::u32string_view str);
+
+  void encode(int8_t x);
+  void encode(int16_t x);
+  void encode(int32_t x);
+  void encode(int64_t x);
+
+  void encode(uint8_t x);
+  void encode(uint16_t x);
+  void encode(uint32_t x);
+  void encode(uint64_t x);
+
+  void encode(float x);
+  void encode(double x);
+  void encode(long double x);
+
+  void encode(const Site& site);
 
-  OStream& operator<<(eastl::u8string_view str);
-  OStream& operator<<(eastl::u16string_view str);
-  OStream& operator<<(eastl::u32string_view str);
+  void encode(FloatFormat f);
 
-  OStream& operator<<(int8_t x);
-  OStream& operator<<(int16_t x);
-  OStream& operator<<(int32_t x);
-  OStream& operator<<(int64_t x);
+  void encode(FieldKey key);
 
-  OStream& operator<<(uint8_t x);
-  OStream& operator<<(uint16_t x);
-  OStream& operator<<(uint32_t x);
-  OStream& operator<<(uint64_t x);
+  template<typename T>
+  void encode(const Field<T>& f)
+  {
+    encode(f.key);
+    encode(f.value);
+  }
 
-  OStream& operator<<(float x);
-  OStream& operator<<(double x);
-  OStream& operator<<(long double x);
+  /** Each element and separator as its own argument.
+   */
+  template<typename T>
+  void encode(const Join<T>& j);
+};
+
+/** Stream of level below MIN_LEVEL, compiled to nothing.
+ */
+struct NullOStream
+{
+  template<typename T>
+  constexpr const NullOStream& operator<<(const T&) const
+  {
+    return *this;
+  }
 };
 
 template<typename T>
 OStream
 operator<<(OStreamFactory& factory, const T& x)
 {
-  return eastl::move(OStream(factory) << x);
+  return OStream(factory, x);
+}
+
+template<LEVEL L, LEVEL MIN, typename T>
+auto
+operator<<(LevelOStreamFactory<L, MIN>& factory, const T& x)
+{
+  if constexpr (L < MIN) {
+    return NullOStream();
+  } else {
+    return OStream(factory, x);
+  }
+}
+
+/** Whether streams of the factory are compiled in, see EXTEND_LOG.
+ */
+constexpr bool
+compiled_in(const OStreamFactory&)
+{
+  return true;
+}
+
+template<LEVEL L, LEVEL MIN>
+constexpr bool
+compiled_in(const LevelOStreamFactory<L, MIN>&)
+{
+  return L >= MIN;
 }
 
-extern OStreamFactory debug;
-extern OStreamFactory info;
-extern OStreamFactory warning;
-extern OStreamFactory error;
-extern OStreamFactory fatal;
+/** Stream statement that evaluates its arguments only if the line is
+ * written: EXTEND_LOG(debug) << expensive();
+ *
+ * Below the minimum level of the factory the statement is compiled to
+ * nothing, below the runtime levels of its channel it costs one relaxed
+ * load. Plain debug << expensive(); calls expensive() in both cases.
+ */
+#define EXTEND_LOG(factory)                                                    \
+  if (!::extend::log::compiled_in(factory) || !(factory).enabled()) {          \
+  } else                                                                       \
+    (factory)
+
+extern LevelOStreamFactory<LEVEL::DEBUG> debug;
+extern LevelOStreamFactory<LEVEL::INFO> info;
+extern LevelOStreamFactory<LEVEL::WARNING> warning;
+extern LevelOStreamFactory<LEVEL::ERROR> error;
+extern LevelOStreamFactory<LEVEL::FATAL> fatal;
+
+/** Default streams of a channel.
+ */
+struct ChannelStreams
+{
+  Channel channel;
+  LevelOStreamFactory<LEVEL::DEBUG> debug;
+  LevelOStreamFactory<LEVEL::INFO> info;
+  LevelOStreamFactory<LEVEL::WARNING> warning;
+  LevelOStreamFactory<LEVEL::ERROR> error;
+  LevelOStreamFactory<LEVEL::FATAL> fatal;
+
+  explicit ChannelStreams(const char* name);
+};
+
+/** Name of a channel as template argument.
+ */
+template<size_t N>
+struct ChannelName
+{
+  constexpr ChannelName(const char (&str)[N])
+  {
+    for (size_t i = 0; i < N; ++i) {
+      value[i] = str[i];
+    }
+  }
+
+  char value[N];
+};
+
+/** Streams of the channel: channel<"lexer">.debug << x;
+ *
+ * Lines go to the default pipe, each statement checks the levels of the
+ * channel with a single relaxed load.
+ */
+template<ChannelName NAME>
+inline ChannelStreams channel{ NAME.value };
 
 /** Ignore logs completely.
  */
@@ -139,11 +705,67 @@ struct NullPipe : IPipe
   virtual void log(LEVEL level, eastl::u8string_view str) override;
 };
 
-/** Print logs to cerr. Default pipe.
+/** Print logs to file descriptor.
+ *
+ * Every write is a single writev call under a lock, so lines of concurrent
+ * threads never interleave. Without buffer each line is written at once.
+ * With buffer lines are written by batches: when the buffer is full, when
+ * the oldest buffered line is older than the delay, on flush() and right
+ * away at ERROR and FATAL. The delay is checked by the next line, a pipe
+ * that may stay idle should be flushed, e.g. by AsyncPipe writer.
  */
-struct CErrPipe : IPipe
+struct FdPipe : IPipe
 {
+  static constexpr size_t DEFAULT_BUFFER_SIZE = 4096;
+  static constexpr int64_t DEFAULT_DELAY_MS = 100;
+
+  /** @param fd          File descriptor, the pipe does not close it.
+   *  @param buffer_size Batch size in bytes, zero disables buffering.
+   *  @param delay_ms    How long a line may wait in the buffer.
+   *  @param prefix      Fields written before each line.
+   */
+  explicit FdPipe(int fd,
+                  size_t buffer_size = 0,
+                  int64_t delay_ms = DEFAULT_DELAY_MS,
+                  Prefix prefix = {});
+
+  /** Write buffered lines.
+   */
+  virtual ~FdPipe() override;
+
   virtual void log(LEVEL level, eastl::u8string_view str) override;
+
+  /** Copy the lines into the buffer and write them with one call.
+   */
+  virtual void log_batch(eastl::span<const Line> lines) override;
+
+  virtual void log_prefixed(LEVEL level,
+                            eastl::u8string_view head,
+                            eastl::u8string_view str) override;
+
+  virtual void flush() override;
+
+  const int fd;
+  const size_t buffer_size;
+  const int64_t delay_ms;
+  const Prefix prefix;
+
+private:
+  void write_line(LEVEL level,
+                  eastl::u8string_view head,
+                  eastl::u8string_view str);
+  void write_buffer();
+
+  EA::Thread::Futex lock;
+  eastl::fixed_string<char8_t, DEFAULT_BUFFER_SIZE> buffer;
+  EA::Thread::ThreadTime deadline{};
+};
+
+/** Print logs to stderr without buffering. Default pipe.
+ */
+struct CErrPipe : FdPipe
+{
+  CErrPipe();
 };
 
 /** Print logs to buffer.
@@ -156,13 +778,53 @@ struct BufferPipe : IPipe
 
   virtual void log(LEVEL level, eastl::u8string_view str) override;
   eastl::fixed_string<char8_t, 4096> buffer;
+
+private:
+  EA::Thread::Futex lock;
 };
 
+/** Replace the default pipe with new T.
+ *
+ * Safe while other threads log: streams started before the call finish
+ * with the old pipe, which is destroyed after the last of them. Default
+ * streams call the pipe by its type, without virtual calls.
+ */
 template<typename T>
 void
 init_default_pipe();
 
+/** Bind default streams to the pipe, safe the same way.
+ *
+ * The pipe should outlive streams, e.g. AsyncPipe over the default pipe.
+ */
+void
+init_default_streams(IPipe& pipe);
+
+/** Pipe created by init_default_pipe, valid until the next call of it.
+ */
 template<typename T>
 T*
 get_default_pipe();
+
+/** Write counts of lines dropped by limits of sites to default streams.
+ *
+ * Counts are also written by the next line of the site, call it
+ * periodically to report sites that stopped logging.
+ */
+void
+report_suppressed();
+
+/** Stage lines of default streams in a buffer of the calling thread.
+ *
+ * Staged lines are written to the default pipe by batches: when the buffer
+ * is full, at ERROR and FATAL, on flush_thread(), on flush of the default
+ * pipe from this thread and at thread exit. Off by default.
+ */
+void
+set_thread_staging(bool enable);
+
+/** Write lines staged by the calling thread.
+ */
+void
+flush_thread();
 }
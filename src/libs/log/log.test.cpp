@@ -16,9 +16,35 @@
  */
 
 #include "log.h"
+#include <EASTL/numeric_limits.h>
+#include <EASTL/type_traits.h>
 #include <catch2/catch_test_macros.hpp>
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <ctime>
+#include <eathread/eathread.h>
+#include <eathread/eathread_thread.h>
+#include <csignal>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
 #include <utils/eastl_io.h>
 
+#include "async.h"
+#include "binary.h"
+#include "clock.h"
+#include "compress.h"
+#include "dtoa.h"
+#include "file.h"
+#include "json.h"
+#include "parse.h"
+#include "recorder.h"
+#include "tee.h"
+#include "uring.h"
+#include "utf.h"
+
 using namespace extend::log;
 
 TEST_CASE("Pipe should log integer consts", "log")
@@ -43,6 +69,104 @@ TEST_CASE("Pipe should log different levels", "log")
   REQUIRE(pipe->buffer == u8"[D] 10\n[I] 20\n[W] 30\n[E] 40\n[F] 50\n");
 }
 
+TEST_CASE("Levels below threshold are skipped", "log")
+{
+  init_default_pipe<BufferPipe<true>>();
+  set_level(LEVEL::WARNING);
+  debug << 10;
+  info << 20;
+  warning << 30;
+  error << 40;
+  fatal << 50;
+  set_level(LEVEL::DEBUG);
+  BufferPipe<true>* pipe = get_default_pipe<BufferPipe<true>>();
+  REQUIRE(pipe != nullptr);
+  REQUIRE(pipe->buffer == u8"[W] 30\n[E] 40\n[F] 50\n");
+}
+
+TEST_CASE("Arguments of skipped streams are not evaluated", "log")
+{
+  BufferPipe<> pipe;
+  // Factories of a build with EXTEND_LOG_MIN_LEVEL=INFO
+  LevelOStreamFactory<LEVEL::DEBUG, LEVEL::INFO> elided(pipe);
+  LevelOStreamFactory<LEVEL::INFO, LEVEL::INFO> kept(pipe);
+  REQUIRE(!compiled_in(elided));
+  REQUIRE(compiled_in(kept));
+  int calls = 0;
+  auto count = [&calls] { return ++calls; };
+
+  EXTEND_LOG(elided) << count();
+  REQUIRE(calls == 0);
+  EXTEND_LOG(kept) << count();
+  REQUIRE(calls == 1);
+
+  set_level(LEVEL::WARNING);
+  EXTEND_LOG(kept) << count();
+  set_level(LEVEL::DEBUG);
+  REQUIRE(calls == 1);
+
+  // Plain streams drop the line but evaluate the arguments
+  elided << count();
+  REQUIRE(calls == 2);
+  REQUIRE(pipe.buffer == u8"1\n");
+}
+
+TEST_CASE("Channels have their own levels", "log")
+{
+  init_default_pipe<BufferPipe<true>>();
+  auto& lexer = channel<"test.lexer">;
+  auto& parser = channel<"test.parser">;
+  REQUIRE(&lexer == &channel<"test.lexer">);
+  REQUIRE(eastl::string_view(lexer.channel.name) == "test.lexer");
+
+  set_level(LEVEL::WARNING);
+  lexer.channel.set_level(LEVEL::DEBUG);
+  debug << 1;
+  lexer.debug << 2;
+  parser.debug << 3;
+  parser.warning << 4;
+
+  REQUIRE(configure_channels("test.lexer=error,,unknown=debug"));
+  lexer.warning << 5;
+  lexer.error << 6;
+  REQUIRE(configure_channels("test.parser=off"));
+  parser.fatal << 7;
+  REQUIRE(!configure_channels("test.parser=verbose"));
+  REQUIRE(!configure_channels("=debug"));
+
+  setenv("EXTEND_LOG_CHANNELS", "test.other=debug,test.env=fatal", 1);
+  static Channel from_env("test.env");
+  unsetenv("EXTEND_LOG_CHANNELS");
+  REQUIRE(from_env.mask == levels_from(LEVEL::FATAL));
+
+  set_level(LEVEL::INFO);
+  lexer.warning << 8;
+  parser.channel.reset();
+  parser.info << 9;
+  lexer.channel.reset();
+  lexer.info << 10;
+  lexer.channel.set_levels(1u << static_cast<uint32_t>(LEVEL::DEBUG));
+  lexer.debug << 11;
+  lexer.info << 12;
+  lexer.channel.reset();
+  set_level(LEVEL::DEBUG);
+
+  BufferPipe<true>* pipe = get_default_pipe<BufferPipe<true>>();
+  REQUIRE(pipe != nullptr);
+  REQUIRE(pipe->buffer == u8"[D] 2\n[W] 4\n[E] 6\n[I] 9\n[I] 10\n[D] 11\n");
+}
+
+TEST_CASE("Stream is built in place", "log")
+{
+  // Factories return the stream as prvalue, it cannot be moved or copied
+  static_assert(!eastl::is_move_constructible<OStream>::value);
+  static_assert(!eastl::is_copy_constructible<OStream>::value);
+
+  init_default_pipe<BufferPipe<>>();
+  debug << 1 << u8' ' << 2.5 << u8' ' << u8"three";
+  REQUIRE(get_default_pipe<BufferPipe<>>()->buffer == u8"1 2.5 three\n");
+}
+
 struct ExpectLog
 {
   decltype(BufferPipe<>::buffer) expected;
@@ -124,6 +248,47 @@ TEST_CASE("Integer limits", "log")
   }
 }
 
+TEST_CASE("Integers match printf", "log")
+{
+  char expected[32];
+  char8_t actual[32];
+  // Every digit count and its neighbours
+  uint64_t power = 1;
+  for (int i = 0; i < 20; ++i, power *= 10) {
+    for (uint64_t x : { power - 1, power, power + 1 }) {
+      snprintf(expected, sizeof(expected), "%llu", (unsigned long long)x);
+      REQUIRE(eastl::u8string_view(actual, utoa(x, actual)) ==
+              reinterpret_cast<const char8_t*>(expected));
+
+      const auto s = static_cast<int64_t>(x);
+      snprintf(expected, sizeof(expected), "%lld", (long long)-s);
+      REQUIRE(eastl::u8string_view(actual, itoa(-s, actual)) ==
+              reinterpret_cast<const char8_t*>(expected));
+
+      const auto u = static_cast<uint32_t>(x);
+      snprintf(expected, sizeof(expected), "%u", u);
+      REQUIRE(eastl::u8string_view(actual, utoa(u, actual)) ==
+              reinterpret_cast<const char8_t*>(expected));
+
+      const auto i32 = static_cast<int32_t>(x);
+      snprintf(expected, sizeof(expected), "%d", i32);
+      REQUIRE(eastl::u8string_view(actual, itoa(i32, actual)) ==
+              reinterpret_cast<const char8_t*>(expected));
+    }
+  }
+
+  uint64_t x = 88172645463325252ULL;
+  for (int i = 0; i < 100000; ++i) {
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    const uint64_t value = x >> (x & 63);
+    snprintf(expected, sizeof(expected), "%llu", (unsigned long long)value);
+    REQUIRE(eastl::u8string_view(actual, utoa(value, actual)) ==
+            reinterpret_cast<const char8_t*>(expected));
+  }
+}
+
 TEST_CASE("Log char", "log")
 {
   {
@@ -157,6 +322,106 @@ TEST_CASE("Log char", "log")
   }
 }
 
+namespace {
+/** Code units of random runs, a run has characters of one UTF-8 length,
+ * so SIMD blocks see both uniform and mixed input, rarely invalid units.
+ */
+template<typename Char>
+eastl::basic_string<Char>
+random_utf(uint32_t& seed, size_t runs)
+{
+  const auto next = [&seed](uint32_t range) {
+    seed = seed * 1664525 + 1013904223;
+    return (seed >> 8) % range;
+  };
+  eastl::basic_string<Char> str;
+  for (size_t run = 0; run < runs; ++run) {
+    const uint32_t kind = next(64);
+    const uint32_t length = 1 + next(40);
+    for (uint32_t i = 0; i < length; ++i) {
+      if (kind < 20) {
+        str.push_back(static_cast<Char>(next(0x80)));
+      } else if (kind < 32) {
+        str.push_back(static_cast<Char>(0x80 + next(0x800 - 0x80)));
+      } else if (kind < 44) {
+        const uint32_t c = 0x800 + next(0xF800 - 0x800);
+        str.push_back(static_cast<Char>(c < 0xD800 ? c : c + 0x800));
+      } else if (kind < 56) {
+        const uint32_t c = 0x10000 + next(0x100000);
+        if constexpr (sizeof(Char) == 2) {
+          str.push_back(static_cast<Char>(0xD800 + ((c - 0x10000) >> 10)));
+          str.push_back(static_cast<Char>(0xDC00 + (c & 0x3FF)));
+        } else {
+          str.push_back(static_cast<Char>(c));
+        }
+      } else if (kind < 60) {
+        str.push_back(static_cast<Char>(next(0x800)));
+      } else if (i == 0) {
+        // Lone surrogate, or a code point out of range for UTF-32
+        const uint32_t invalid[] = { 0xD800 + next(0x800), 0x110000 };
+        str.push_back(static_cast<Char>(invalid[next(2)]));
+      }
+    }
+  }
+  return str;
+}
+
+template<typename Char, typename LLVMChar, typename F>
+void
+check_utf(uint32_t& seed, F convert)
+{
+  const eastl::basic_string<Char> str = random_utf<Char>(seed, 1 + seed % 8);
+  const eastl::basic_string_view<Char> view(str.data(), str.size());
+  eastl::vector<char8_t> expected(str.size() * 4 + 1);
+  const auto* source = reinterpret_cast<const LLVMChar*>(str.data());
+  auto* target = reinterpret_cast<llvm::UTF8*>(expected.data());
+  const llvm::ConversionResult code =
+    convert(&source,
+            source + str.size(),
+            &target,
+            target + expected.size(),
+            llvm::ConversionFlags::strictConversion);
+  expected.resize(reinterpret_cast<char8_t*>(target) - expected.data());
+
+  // Exactly the size OStream reserves, stores past it fail under ASan
+  eastl::vector<char8_t> buffer(
+    str.size() * (sizeof(Char) == 2 ? UTF8_PER_UTF16 : UTF8_PER_UTF32));
+  Transcoded result;
+  if constexpr (sizeof(Char) == 2) {
+    result = utf16_to_utf8(view, buffer.data());
+  } else {
+    result = utf32_to_utf8(view, buffer.data());
+  }
+  buffer.resize(result.size);
+  REQUIRE(result.valid == (code == llvm::ConversionResult::conversionOK));
+  REQUIRE(buffer == expected);
+}
+}
+
+TEST_CASE("Wide strings convert as strict LLVM conversion", "log")
+{
+  {
+    ExpectLog log(u8"я ☺ \U0001f600 ascii and some longer ascii text\n");
+    debug << u'я' << u' ' << U'☺' << u8' ' << U'\U0001f600'
+          << u" ascii and some longer ascii text";
+  }
+  {
+    ExpectLog log(u8"яяяяяяяяяяяяяяяяяя ☺☺☺☺☺☺☺☺☺☺☺☺☺☺☺☺☺☺\n");
+    debug << U"яяяяяяяяяяяяяяяяяя ☺☺☺☺☺☺☺☺☺☺☺☺☺☺☺☺☺☺";
+  }
+
+  // Every path the CPU has, the others fall back to a lower one
+  for (const UTF_PATH path :
+       { UTF_PATH::SCALAR, UTF_PATH::SSE41, UTF_PATH::AVX2 }) {
+    set_utf_path(path);
+    uint32_t seed = 7;
+    for (int i = 0; i < 2000; ++i) {
+      check_utf<char16_t, llvm::UTF16>(seed, llvm::ConvertUTF16toUTF8);
+      check_utf<char32_t, llvm::UTF32>(seed, llvm::ConvertUTF32toUTF8);
+    }
+  }
+}
+
 TEST_CASE("Log double", "log")
 {
   {
@@ -254,6 +519,377 @@ TEST_CASE("Log double", "log")
   }
 }
 
+namespace {
+// Significant digits of the number, without sign, point and exponent
+eastl::string
+significant_digits(const char* str, const char* end)
+{
+  eastl::string digits;
+  for (; str != end && *str != 'e'; ++str) {
+    if (*str >= '0' && *str <= '9' && (*str != '0' || !digits.empty())) {
+      digits.push_back(*str);
+    }
+  }
+  while (!digits.empty() && digits.back() == '0') {
+    digits.pop_back();
+  }
+  return digits;
+}
+
+/** Check that the double reads back and has the same digits as the
+ * shortest representation of the standard library.
+ */
+void
+check_dtoa(double x)
+{
+  char8_t buffer[32];
+  char expected[32];
+  const int length = dtoa(x, buffer);
+  buffer[length] = u8'\0';
+  const char* str = reinterpret_cast<const char*>(buffer);
+  const double y = strtod(str, nullptr);
+  REQUIRE(memcmp(&x, &y, sizeof(x)) == 0);
+  const auto result = std::to_chars(
+    expected, expected + sizeof(expected), x, std::chars_format::scientific);
+  REQUIRE(significant_digits(str, str + length) ==
+          significant_digits(expected, result.ptr));
+}
+
+void
+check_random_dtoa(uint64_t seed, uint64_t count)
+{
+  for (uint64_t i = 0; i < count; ++i) {
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+    double x;
+    memcpy(&x, &seed, sizeof(x));
+    if (std::isfinite(x)) {
+      check_dtoa(x);
+    }
+  }
+}
+}
+
+TEST_CASE("Double is the shortest that reads back", "log")
+{
+  check_random_dtoa(0x9E3779B97F4A7C15, 1000000);
+  // Boundaries of every binary exponent, subnormals included
+  for (uint64_t exponent = 0; exponent < 2047; ++exponent) {
+    for (uint64_t mantissa : { 0ULL, 1ULL, 2ULL, (1ULL << 52) - 1 }) {
+      const uint64_t bits = (exponent << 52) | mantissa;
+      double x;
+      memcpy(&x, &bits, sizeof(x));
+      check_dtoa(x);
+    }
+  }
+}
+
+TEST_CASE("Double reads back for 2^32 random values", "[.roundtrip]")
+{
+  check_random_dtoa(0x9E3779B97F4A7C15, 1ULL << 32);
+}
+
+namespace {
+/** Check that fixed and scientific notations write the same as printf.
+ */
+void
+check_printf(double x, uint32_t precision)
+{
+  static char8_t buffer[1500];
+  static char expected[1500];
+  const int precision_arg = static_cast<int>(precision);
+
+  int length = dtoa_fixed(x, precision, buffer);
+  REQUIRE(length <= static_cast<int>(dtoa_fixed_length(x, precision)));
+  int expected_length =
+    snprintf(expected, sizeof(expected), "%.*f", precision_arg, x);
+  REQUIRE(eastl::string_view(reinterpret_cast<const char*>(buffer), length) ==
+          eastl::string_view(expected, expected_length));
+
+  length = dtoa_exp(x, precision, buffer);
+  REQUIRE(length <= static_cast<int>(precision + 8));
+  expected_length =
+    snprintf(expected, sizeof(expected), "%.*e", precision_arg, x);
+  REQUIRE(eastl::string_view(reinterpret_cast<const char*>(buffer), length) ==
+          eastl::string_view(expected, expected_length));
+}
+}
+
+TEST_CASE("Fixed and scientific match printf", "log")
+{
+  const double special[] = { 0.0,
+                             -0.0,
+                             0.5,
+                             1.5,
+                             2.5,
+                             0.125,
+                             0.375,
+                             9.5,
+                             99.5,
+                             999999999.5,
+                             9.995,
+                             0.05,
+                             0.15,
+                             0.95,
+                             1e22,
+                             1e23,
+                             123456789012345678.0,
+                             eastl::numeric_limits<double>::max(),
+                             -eastl::numeric_limits<double>::max(),
+                             eastl::numeric_limits<double>::min(),
+                             eastl::numeric_limits<double>::denorm_min(),
+                             eastl::numeric_limits<double>::infinity(),
+                             -eastl::numeric_limits<double>::infinity(),
+                             std::nan(""),
+                             -std::nan("") };
+  for (const double x : special) {
+    for (uint32_t precision = 0; precision < 40; ++precision) {
+      check_printf(x, precision);
+    }
+    for (const uint32_t precision : { 100u, 400u, 1100u }) {
+      check_printf(x, precision);
+    }
+  }
+
+  // Boundaries of every binary exponent, subnormals included
+  for (uint64_t exponent = 0; exponent < 2047; ++exponent) {
+    for (uint64_t mantissa : { 0ULL, 1ULL, (1ULL << 52) - 1 }) {
+      const uint64_t bits = (exponent << 52) | mantissa;
+      double x;
+      memcpy(&x, &bits, sizeof(x));
+      for (const uint32_t precision : { 0u, 3u, 17u }) {
+        check_printf(x, precision);
+      }
+    }
+  }
+
+  uint64_t seed = 0x9E3779B97F4A7C15;
+  for (int i = 0; i < 200000; ++i) {
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+    double x;
+    memcpy(&x, &seed, sizeof(x));
+    check_printf(x, seed % 25);
+    // Short binary fractions hit exact ties
+    check_printf(std::ldexp(double(seed % 100000), -int(seed >> 59)),
+                 seed >> 60);
+  }
+}
+
+TEST_CASE("Fixed and scientific manipulators", "log")
+{
+  {
+    ExpectLog log(u8"0.667 6.667e-01 0.6666666666666666\n");
+    debug << fixed(3) << 2.0 / 3 << u8' ' << scientific(3) << 2.0 / 3
+          << u8' ' << shortest() << 2.0 / 3;
+  }
+  {
+    ExpectLog log(u8"2 0.125000 -1.5e+10 inf\n");
+    debug << fixed(0) << 2.5 << u8' ' << fixed() << 0.125f << u8' '
+          << scientific(1) << -1.5e10 << u8' '
+          << eastl::numeric_limits<float>::infinity();
+  }
+  {
+    // Integers keep their format
+    ExpectLog log(u8"x=1.50 7\n");
+    debug << fixed(2) << field(u8"x", 1.5) << u8' ' << 7;
+  }
+  {
+    const eastl::vector<double> values = { 1.0, 0.25, 100.0 };
+    const float floats[] = { 0.5f, 1e-3f };
+    // 0.25 is a tie, it goes to even
+    ExpectLog log(u8"1.0, 0.2, 100.0 5.0e-01 1.0e-03\n");
+    debug << fixed(1) << join(values) << u8' ' << scientific(1)
+          << join(eastl::span<const float>(floats), u8" ");
+  }
+}
+
+namespace {
+template<typename T>
+Parsed<T>
+parse_text(const char* text)
+{
+  const eastl::span<const char8_t> str(
+    reinterpret_cast<const char8_t*>(text), strlen(text));
+  if constexpr (eastl::is_same_v<T, double>) {
+    return parse_double(str);
+  } else {
+    return parse_float(str);
+  }
+}
+}
+
+TEST_CASE("Parse what dtoa and ftoa write", "log")
+{
+  char8_t buffer[32];
+  uint64_t seed = 0x9E3779B97F4A7C15;
+  for (int i = 0; i < 1000000; ++i) {
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+    double x;
+    memcpy(&x, &seed, sizeof(x));
+    if (std::isfinite(x)) {
+      const int length = dtoa(x, buffer);
+      const Parsed<double> parsed = parse_double({ buffer, size_t(length) });
+      REQUIRE(parsed.status == PARSE::OK);
+      REQUIRE(parsed.length == size_t(length));
+      REQUIRE(memcmp(&parsed.value, &x, sizeof(x)) == 0);
+    }
+    float y;
+    const uint32_t bits = static_cast<uint32_t>(seed >> 32);
+    memcpy(&y, &bits, sizeof(y));
+    if (std::isfinite(y)) {
+      const int length = ftoa(y, buffer);
+      const Parsed<float> parsed = parse_float({ buffer, size_t(length) });
+      REQUIRE(parsed.status == PARSE::OK);
+      REQUIRE(parsed.length == size_t(length));
+      REQUIRE(memcmp(&parsed.value, &y, sizeof(y)) == 0);
+    }
+  }
+}
+
+TEST_CASE("Parse double as strtod", "log")
+{
+  // Halfway cases, long mantissas and limits of the range
+  const char* texts[] = {
+    "0",
+    "-0.0",
+    "1.",
+    ".5",
+    "+1e5x",
+    "1e",
+    "1e+",
+    "9007199254740993",
+    "9007199254740992.000000000000000000001",
+    "4503599627370496.5",
+    "4503599627370497.5",
+    "2.2250738585072011e-308",
+    "2.4703282292062327e-324",
+    "2.4703282292062328e-324",
+    "1.7976931348623157e308",
+    "1.7976931348623158079372897140530341507993413271003782693617377898044"
+    "496829276475094664736e+308",
+    "1.00000005960464477539062499",
+    "1.000000059604644775390625",
+    "1.00000005960464477539062501",
+    "123456789012345678901234567890e-40",
+    "0.0000000000000000000000000000000000000000000001e46",
+  };
+  for (const char* text : texts) {
+    char* end = nullptr;
+    const double expected = strtod(text, &end);
+    const Parsed<double> parsed = parse_text<double>(text);
+    REQUIRE(parsed.length == size_t(end - text));
+    REQUIRE(memcmp(&parsed.value, &expected, sizeof(expected)) == 0);
+    const float expected_float = strtof(text, &end);
+    const Parsed<float> parsed_float = parse_text<float>(text);
+    REQUIRE(parsed_float.length == size_t(end - text));
+    REQUIRE(memcmp(&parsed_float.value, &expected_float, sizeof(float)) == 0);
+  }
+
+  REQUIRE(parse_text<double>("").status == PARSE::INVALID);
+  REQUIRE(parse_text<double>("-.e5").status == PARSE::INVALID);
+  REQUIRE(parse_text<double>("x1").length == 0);
+  REQUIRE(std::isnan(parse_text<double>("nan").value));
+  REQUIRE(parse_text<double>("-Infinity").value == -HUGE_VAL);
+  REQUIRE(parse_text<double>("-Infinity").length == 9);
+  REQUIRE(parse_text<float>("infx").length == 3);
+
+  const Parsed<double> huge = parse_text<double>("1e309");
+  REQUIRE(huge.status == PARSE::OUT_OF_RANGE);
+  REQUIRE(huge.value == HUGE_VAL);
+  const Parsed<double> tiny = parse_text<double>("-1e-400");
+  REQUIRE(tiny.status == PARSE::OUT_OF_RANGE);
+  REQUIRE(tiny.value == 0.0);
+  REQUIRE(std::signbit(tiny.value));
+  REQUIRE(parse_text<float>("3.5e38").status == PARSE::OUT_OF_RANGE);
+  REQUIRE(parse_text<double>("3.5e38").status == PARSE::OK);
+}
+
+namespace {
+template<typename T>
+void
+check_from_chars(const char* text, size_t size, unsigned base)
+{
+  const Parsed<T> parsed = parse_integer<T>(
+    { reinterpret_cast<const char8_t*>(text), size }, base);
+  // from_chars does not accept the plus
+  const size_t plus =
+    size > 0 && text[0] == '+' && (size < 2 || text[1] != '-');
+  T expected = 0;
+  const std::from_chars_result result =
+    std::from_chars(text + plus, text + size, expected, int(base));
+  if (result.ec == std::errc::invalid_argument) {
+    REQUIRE(parsed.status == PARSE::INVALID);
+    REQUIRE(parsed.length == 0);
+    return;
+  }
+  REQUIRE(parsed.length == size_t(result.ptr - text));
+  if (result.ec == std::errc::result_out_of_range) {
+    REQUIRE(parsed.status == PARSE::OUT_OF_RANGE);
+    REQUIRE((parsed.value == eastl::numeric_limits<T>::max() ||
+             parsed.value == eastl::numeric_limits<T>::min()));
+    return;
+  }
+  REQUIRE(parsed.status == PARSE::OK);
+  REQUIRE(parsed.value == expected);
+}
+}
+
+TEST_CASE("Parse integers as from_chars", "log")
+{
+  // Runs of digits of random length around the block sizes with signs,
+  // leading zeros, letters and stray bytes
+  const char alphabet[] = "0000000111123456789abcdefABCDEFgzZ+-. \x80\xFF";
+  const unsigned bases[] = { 2, 8, 10, 16, 3, 7, 12 };
+  uint64_t state = 0x9E3779B97F4A7C15;
+  const auto random = [&state] {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+  };
+  char text[80];
+  for (int i = 0; i < 200000; ++i) {
+    const size_t size = random() % sizeof(text);
+    for (size_t j = 0; j < size; ++j) {
+      text[j] = random() % 4 != 0 ? char('0' + random() % 10)
+                                  : alphabet[random() % (sizeof(alphabet) - 1)];
+    }
+    const unsigned base = bases[random() % 7];
+    check_from_chars<int8_t>(text, size, base);
+    check_from_chars<uint8_t>(text, size, base);
+    check_from_chars<int16_t>(text, size, base);
+    check_from_chars<uint16_t>(text, size, base);
+    check_from_chars<int32_t>(text, size, base);
+    check_from_chars<uint32_t>(text, size, base);
+    check_from_chars<int64_t>(text, size, base);
+    check_from_chars<uint64_t>(text, size, base);
+  }
+
+  const char* limits[] = {
+    "18446744073709551615", "18446744073709551616", "-9223372036854775808",
+    "-9223372036854775809", "00000000000000000000000000000000000000001",
+    "ffffffffffffffff",     "10000000000000000",    "-80",
+    "7f",                   "255",                  "-129",
+  };
+  for (const char* limit : limits) {
+    for (unsigned base : { 10u, 16u }) {
+      check_from_chars<int8_t>(limit, strlen(limit), base);
+      check_from_chars<uint8_t>(limit, strlen(limit), base);
+      check_from_chars<int64_t>(limit, strlen(limit), base);
+      check_from_chars<uint64_t>(limit, strlen(limit), base);
+    }
+  }
+  REQUIRE(parse_integer<int>({ u8"12", 2 }, 1).status == PARSE::INVALID);
+  REQUIRE(parse_integer<int>({ u8"12", 2 }, 17).status == PARSE::INVALID);
+  REQUIRE(parse_integer<unsigned>({ u8"-1", 2 }).status == PARSE::INVALID);
+  REQUIRE(parse_integer<int>({ u8"+-1", 3 }).status == PARSE::INVALID);
+}
+
 TEST_CASE("Log long double", "log")
 {
   {
@@ -469,3 +1105,1460 @@ TEST_CASE("Log float", "log")
     debug << 1.0e+10f;
   }
 }
+
+TEST_CASE("Async pipe keeps order", "log")
+{
+  BufferPipe<true> sink;
+  decltype(sink.buffer) expected;
+  {
+    AsyncPipe pipe(sink);
+    OStreamFactory factory(LEVEL::INFO, pipe);
+    for (int32_t i = 0; i < 1000; ++i) {
+      factory << i;
+      expected.append_sprintf(u8"[I] %I32d\n", i);
+    }
+    pipe.flush();
+    REQUIRE(sink.buffer == expected);
+
+    factory << u8"drained on shutdown";
+    expected.append(u8"[I] drained on shutdown\n");
+  }
+  REQUIRE(sink.buffer == expected);
+}
+
+TEST_CASE("Default pipe is replaced while threads log", "log")
+{
+  constexpr int THREADS = 4;
+  eastl::atomic<bool> running{ true };
+  EA::Thread::Thread threads[THREADS];
+  for (auto& thread : threads) {
+    thread.Begin(
+      [](void* context) -> intptr_t {
+        const auto& run = *static_cast<eastl::atomic<bool>*>(context);
+        for (int32_t i = 0; run.load(); ++i) {
+          info << u8"worker " << i;
+        }
+        return 0;
+      },
+      &running);
+  }
+  for (int i = 0; i < 200; ++i) {
+    if (i % 2 == 0) {
+      init_default_pipe<BufferPipe<true>>();
+    } else {
+      init_default_pipe<NullPipe>();
+    }
+  }
+  init_default_pipe<BufferPipe<true>>();
+  EA::Thread::ThreadSleep(1);
+  running.store(false);
+  for (auto& thread : threads) {
+    thread.WaitForEnd();
+  }
+
+  const auto& buffer = get_default_pipe<BufferPipe<true>>()->buffer;
+  eastl::u8string_view rest(buffer.data(), buffer.size());
+  while (!rest.empty()) {
+    const size_t end = rest.find(u8'\n');
+    REQUIRE(end != eastl::u8string_view::npos);
+    REQUIRE(rest.substr(0, 11) == u8"[I] worker ");
+    rest.remove_prefix(end + 1);
+  }
+}
+
+namespace {
+/** Count calls of the default pipe to a pipe it does not own.
+ */
+struct CountingPipe : IPipe
+{
+  virtual void log(LEVEL, eastl::u8string_view) override { ++lines; }
+
+  virtual void log_batch(eastl::span<const Line> batch) override
+  {
+    ++batches;
+    lines += batch.size();
+  }
+
+  virtual void flush() override { ++flushes; }
+
+  size_t lines = 0;
+  size_t batches = 0;
+  size_t flushes = 0;
+};
+}
+
+TEST_CASE("Default pipe calls owned and bound pipes", "log")
+{
+  init_default_pipe<BufferPipe<true>>();
+  const auto& buffer = get_default_pipe<BufferPipe<true>>()->buffer;
+  info << 1;
+  set_thread_staging(true);
+  info << 2;
+  warning << 3;
+  set_thread_staging(false);
+  debug.pipe.get().flush();
+  REQUIRE(buffer == u8"[I] 1\n[I] 2\n[W] 3\n");
+
+  CountingPipe counting;
+  init_default_streams(counting);
+  info << 1;
+  set_thread_staging(true);
+  info << 2;
+  info << 3;
+  flush_thread();
+  set_thread_staging(false);
+  debug.pipe.get().flush();
+  REQUIRE(counting.lines == 3);
+  REQUIRE(counting.batches == 1);
+  REQUIRE(counting.flushes == 1);
+  init_default_pipe<NullPipe>();
+  info << 4;
+  REQUIRE(counting.lines == 3);
+}
+
+TEST_CASE("Thread staging publishes by batches", "log")
+{
+  init_default_pipe<BufferPipe<true>>();
+  const auto& buffer = get_default_pipe<BufferPipe<true>>()->buffer;
+  set_thread_staging(true);
+  info << 1;
+  info << 2;
+  REQUIRE(buffer.empty());
+  error << 3;
+  REQUIRE(buffer == u8"[I] 1\n[I] 2\n[E] 3\n");
+  info << 4;
+  flush_thread();
+  REQUIRE(buffer == u8"[I] 1\n[I] 2\n[E] 3\n[I] 4\n");
+  info << 5;
+  set_thread_staging(false);
+  REQUIRE(buffer == u8"[I] 1\n[I] 2\n[E] 3\n[I] 4\n[I] 5\n");
+
+  EA::Thread::Thread thread;
+  thread.Begin([](void*) -> intptr_t {
+    set_thread_staging(true);
+    info << u8"at exit";
+    return 0;
+  });
+  thread.WaitForEnd();
+  REQUIRE(buffer == u8"[I] 1\n[I] 2\n[E] 3\n[I] 4\n[I] 5\n[I] at exit\n");
+}
+
+/** Hold the writer thread inside the first line.
+ */
+struct GatePipe : IPipe
+{
+  eastl::atomic<bool> entered{ false };
+  eastl::atomic<bool> open{ false };
+  BufferPipe<true> sink;
+
+  virtual void log(LEVEL level, eastl::u8string_view str) override
+  {
+    entered.store(true);
+    while (!open.load()) {
+      EA::Thread::ThreadSleep();
+    }
+    sink.log(level, str);
+  }
+};
+
+static decltype(BufferPipe<>::buffer)
+overflow(OVERFLOW_POLICY policy)
+{
+  // Lines of the test follow no threshold, the report should not either
+  static Channel lines("test.overflow");
+  lines.set_level(LEVEL::DEBUG);
+  GatePipe gate;
+  uint64_t dropped = 0;
+  {
+    AsyncPipe pipe(gate, policy, 2);
+    OStreamFactory factory(LEVEL::INFO, pipe, lines);
+    factory << 0;
+    while (!gate.entered.load()) {
+      EA::Thread::ThreadSleep();
+    }
+    factory << 1;
+    factory << 2;
+    factory << 3;
+    dropped = pipe.dropped();
+    gate.open.store(true);
+  }
+  REQUIRE(dropped == 1);
+  return gate.sink.buffer;
+}
+
+TEST_CASE("Async pipe overflow", "log")
+{
+  REQUIRE(overflow(OVERFLOW_POLICY::DROP_NEWEST) ==
+          u8"[I] 0\n[I] 1\n[I] 2\n[W] AsyncPipe dropped 1 lines\n");
+  REQUIRE(overflow(OVERFLOW_POLICY::DROP_OLDEST) ==
+          u8"[I] 0\n[I] 2\n[I] 3\n[W] AsyncPipe dropped 1 lines\n");
+  set_level(LEVEL::ERROR);
+  const auto reported = overflow(OVERFLOW_POLICY::DROP_NEWEST);
+  set_level(LEVEL::DEBUG);
+  REQUIRE(reported ==
+          u8"[I] 0\n[I] 1\n[I] 2\n[W] AsyncPipe dropped 1 lines\n");
+}
+
+/** Read everything available from nonblocking fd.
+ */
+static decltype(BufferPipe<>::buffer)
+read_available(int fd)
+{
+  decltype(BufferPipe<>::buffer) result;
+  char8_t chunk[256];
+  ssize_t count = 0;
+  while ((count = read(fd, chunk, sizeof(chunk))) > 0) {
+    result.append(chunk, count);
+  }
+  return result;
+}
+
+TEST_CASE("Fd pipe batches lines", "log")
+{
+  int fds[2];
+  REQUIRE(pipe2(fds, O_NONBLOCK) == 0);
+  {
+    FdPipe direct(fds[1]);
+    OStreamFactory factory(LEVEL::INFO, direct);
+    factory << u8"at once";
+    REQUIRE(read_available(fds[0]) == u8"[I] at once\n");
+  }
+
+  {
+    FdPipe buffered(fds[1], 32, 1000000);
+    OStreamFactory info(LEVEL::INFO, buffered);
+    OStreamFactory error(LEVEL::ERROR, buffered);
+    info << 1;
+    info << 2;
+    REQUIRE(read_available(fds[0]).empty());
+    error << 3;
+    REQUIRE(read_available(fds[0]) == u8"[I] 1\n[I] 2\n[E] 3\n");
+
+    info << 4;
+    buffered.flush();
+    REQUIRE(read_available(fds[0]) == u8"[I] 4\n");
+
+    info << 5;
+    info << u8"longer than the whole buffer";
+    REQUIRE(read_available(fds[0]) ==
+            u8"[I] 5\n[I] longer than the whole buffer\n");
+
+    info << 6;
+  }
+  REQUIRE(read_available(fds[0]) == u8"[I] 6\n");
+
+  {
+    FdPipe delayed(fds[1], 4096, 0);
+    OStreamFactory info(LEVEL::INFO, delayed);
+    info << 7;
+    EA::Thread::ThreadSleep(1);
+    info << 8;
+    REQUIRE(read_available(fds[0]) == u8"[I] 7\n[I] 8\n");
+    delayed.flush();
+  }
+  close(fds[0]);
+  close(fds[1]);
+}
+
+TEST_CASE("Fd pipe does not interleave lines", "log")
+{
+  int fds[2];
+  REQUIRE(pipe2(fds, O_NONBLOCK) == 0);
+  constexpr int THREADS = 4;
+  constexpr int LINES = 200;
+  {
+    FdPipe pipe(fds[1], 256);
+    EA::Thread::Thread threads[THREADS];
+    for (auto& thread : threads) {
+      thread.Begin(
+        [](void* context) -> intptr_t {
+          OStreamFactory factory(LEVEL::INFO, *static_cast<FdPipe*>(context));
+          for (int i = 0; i < LINES; ++i) {
+            factory << u8"0123456789 " << i;
+          }
+          return 0;
+        },
+        &pipe);
+    }
+    for (auto& thread : threads) {
+      thread.WaitForEnd();
+    }
+  }
+
+  const auto output = read_available(fds[0]);
+  close(fds[0]);
+  close(fds[1]);
+  eastl::u8string_view rest(output.data(), output.size());
+  int count = 0;
+  while (!rest.empty()) {
+    const size_t end = rest.find(u8'\n');
+    REQUIRE(end != eastl::u8string_view::npos);
+    REQUIRE(rest.substr(0, 15) == u8"[I] 0123456789 ");
+    rest.remove_prefix(end + 1);
+    ++count;
+  }
+  REQUIRE(count == THREADS * LINES);
+}
+
+TEST_CASE("Prefix writes level, time and thread", "log")
+{
+  char8_t out[Prefix::MAX_SIZE];
+  const Prefix level_only;
+  REQUIRE(eastl::u8string_view(out, level_only.write(LEVEL::WARNING, out)) ==
+          u8"[W] ");
+
+  const Prefix full{ true, true };
+  const int64_t before = Clock::system();
+  const eastl::u8string_view str(out, full.write(LEVEL::INFO, out));
+  const int64_t after = Clock::system();
+  // "[I] 2022-10-16T12:34:56.123456 4242 "
+  REQUIRE(str.size() > 32);
+  REQUIRE(str.substr(0, 4) == u8"[I] ");
+  REQUIRE(str[8] == u8'-');
+  REQUIRE(str[14] == u8'T');
+  REQUIRE(str[23] == u8'.');
+  REQUIRE(str[30] == u8' ');
+  REQUIRE(str.back() == u8' ');
+
+  // Seconds of the prefix are between the two readings of the system clock
+  tm date{};
+  date.tm_year = (str[4] - u8'0') * 1000 + (str[5] - u8'0') * 100 +
+                 (str[6] - u8'0') * 10 + (str[7] - u8'0') - 1900;
+  date.tm_mon = (str[9] - u8'0') * 10 + (str[10] - u8'0') - 1;
+  date.tm_mday = (str[12] - u8'0') * 10 + (str[13] - u8'0');
+  date.tm_hour = (str[15] - u8'0') * 10 + (str[16] - u8'0');
+  date.tm_min = (str[18] - u8'0') * 10 + (str[19] - u8'0');
+  date.tm_sec = (str[21] - u8'0') * 10 + (str[22] - u8'0');
+  const int64_t second = timegm(&date);
+  REQUIRE(second >= before / 1000000000 - 1);
+  REQUIRE(second <= after / 1000000000 + 1);
+
+  // The thread id does not change between lines
+  char8_t next[Prefix::MAX_SIZE];
+  const size_t next_size = full.write(LEVEL::INFO, next);
+  REQUIRE(eastl::u8string_view(next, next_size).substr(31) == str.substr(31));
+}
+
+TEST_CASE("Clock follows system clock", "log")
+{
+  // Long enough to calibrate TSC
+  for (int i = 0; i < 30; ++i) {
+    const int64_t system = Clock::system();
+    const int64_t now = Clock::now();
+    REQUIRE(now >= system - 10000000);
+    REQUIRE(now <= Clock::system() + 10000000);
+    EA::Thread::ThreadSleep(5);
+  }
+}
+
+static eastl::u8string
+read_file(const char* path)
+{
+  eastl::u8string result;
+  const int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    return result;
+  }
+  result.resize(lseek(fd, 0, SEEK_END));
+  if (pread(fd, result.data(), result.size(), 0) !=
+      static_cast<ssize_t>(result.size())) {
+    result.clear();
+  }
+  close(fd);
+  return result;
+}
+
+TEST_CASE("Mmap file pipe rotates", "log")
+{
+  char dir[] = "/tmp/extend-log-XXXXXX";
+  REQUIRE(mkdtemp(dir) != nullptr);
+  eastl::fixed_string<char, 64> path(dir);
+  path.append("/test.log");
+  const auto rotated = [&](unsigned i) {
+    eastl::fixed_string<char, 64> result(path);
+    result.append_sprintf(".%u", i);
+    return result;
+  };
+
+  eastl::u8string expected;
+  {
+    MmapFilePipe pipe(path.c_str(), 10000, 3, 4096);
+    REQUIRE(pipe.is_open());
+    OStreamFactory factory(LEVEL::INFO, pipe);
+    for (int32_t i = 0; i < 3000; ++i) {
+      factory << u8"line " << i;
+      expected.append_sprintf(u8"[I] line %I32d\n", i);
+    }
+  }
+
+  const auto current = read_file(path.c_str());
+  const auto first = read_file(rotated(1).c_str());
+  const auto second = read_file(rotated(2).c_str());
+  REQUIRE(access(rotated(3).c_str(), F_OK) != 0);
+  REQUIRE(!current.empty());
+  REQUIRE(first.size() <= 10000);
+  REQUIRE(first.size() > 10000 - 20);
+  REQUIRE(second.size() <= 10000);
+  const auto all = second + first + current;
+  REQUIRE(expected.substr(expected.size() - all.size()) == all);
+
+  {
+    MmapFilePipe pipe(path.c_str(), 10000, 3, 4096);
+    OStreamFactory factory(LEVEL::INFO, pipe);
+    factory << u8"appended";
+  }
+  REQUIRE(read_file(path.c_str()) == current + u8"[I] appended\n");
+
+  for (unsigned i = 0; i < 3; ++i) {
+    unlink(i == 0 ? path.c_str() : rotated(i).c_str());
+  }
+  rmdir(dir);
+}
+
+TEST_CASE("Mmap file pipe truncates on crash and chains handlers", "log")
+{
+  char dir[] = "/tmp/extend-log-XXXXXX";
+  REQUIRE(mkdtemp(dir) != nullptr);
+  eastl::fixed_string<char, 64> path(dir);
+  path.append("/crash.log");
+  const pid_t child = fork();
+  if (child == 0) {
+    // Handler of the application, it should still run
+    signal(SIGABRT, [](int) { _exit(42); });
+    static MmapFilePipe pipe(path.c_str(), 1 << 20, 1, 4096);
+    MmapFilePipe::install_crash_handlers();
+    OStreamFactory factory(LEVEL::INFO, pipe);
+    factory << u8"before";
+    factory << u8"crash";
+    abort();
+  }
+  int status = 0;
+  REQUIRE(waitpid(child, &status, 0) == child);
+  REQUIRE(WIFEXITED(status));
+  REQUIRE(WEXITSTATUS(status) == 42);
+  REQUIRE(read_file(path.c_str()) == u8"[I] before\n[I] crash\n");
+  unlink(path.c_str());
+  rmdir(dir);
+}
+
+static void
+log_every_type(IPipe& pipe)
+{
+  OStreamFactory factory(LEVEL::WARNING, pipe);
+  factory << EXTEND_LOG_SITE << u8'a' << u'b' << U'c' << u8" u8" << u" u16"
+          << U" u32 " << int8_t(-128) << u8' ' << int16_t(-32768) << u8' '
+          << int32_t(-2147483647) << u8' ' << int64_t(-9223372036854775807LL)
+          << u8' ' << uint8_t(255) << u8' ' << uint16_t(65535) << u8' '
+          << uint32_t(4294967295) << u8' ' << uint64_t(18446744073709551615LLu)
+          << u8' ' << 1.2345e-5f << u8' ' << 12.34 << u8' ' << 1.0e+100L;
+}
+
+TEST_CASE("Binary format decodes to the same text", "log")
+{
+  BufferPipe<true> text;
+  log_every_type(text);
+  log_every_type(text);
+
+  FILE* file = tmpfile();
+  REQUIRE(file != nullptr);
+  BinaryPipe binary(fileno(file));
+  log_every_type(binary);
+  log_every_type(binary);
+
+  eastl::fixed_string<char8_t, 1024> data;
+  data.resize(lseek(binary.fd, 0, SEEK_END));
+  REQUIRE(pread(binary.fd, data.data(), data.size(), 0) ==
+          static_cast<ssize_t>(data.size()));
+  fclose(file);
+
+  BufferPipe<true> decoded;
+  eastl::u8string_view view(data.data(), data.size());
+  BinaryRecord record;
+  for (int i = 0; i < 2; ++i) {
+    SiteInfo site;
+    REQUIRE(next_record(view, record));
+    REQUIRE(read_site(record.line, site));
+    REQUIRE(site.file.empty() == (i != 0));
+    OStreamFactory factory(record.level, decoded);
+    OStream out(factory);
+    REQUIRE(replay(record.line, out));
+  }
+  REQUIRE(view.empty());
+  REQUIRE(decoded.buffer == text.buffer);
+}
+
+namespace {
+// Whether the records of a binary pipe describe their sites
+eastl::fixed_vector<bool, 4>
+described_sites(const BinaryPipe& pipe)
+{
+  eastl::fixed_string<char8_t, 256> data;
+  data.resize(lseek(pipe.fd, 0, SEEK_END));
+  REQUIRE(pread(pipe.fd, data.data(), data.size(), 0) ==
+          static_cast<ssize_t>(data.size()));
+  eastl::fixed_vector<bool, 4> described;
+  eastl::u8string_view view(data.data(), data.size());
+  BinaryRecord record;
+  while (next_record(view, record)) {
+    SiteInfo site;
+    REQUIRE(read_site(record.line, site));
+    described.push_back(!site.file.empty());
+  }
+  REQUIRE(view.empty());
+  return described;
+}
+}
+
+TEST_CASE("Every binary output describes sites again", "log")
+{
+  const auto log = [](IPipe& pipe) {
+    OStreamFactory factory(LEVEL::INFO, pipe);
+    factory << EXTEND_LOG_SITE << u8"line";
+  };
+  FILE* first_file = tmpfile();
+  FILE* second_file = tmpfile();
+  REQUIRE(first_file != nullptr);
+  REQUIRE(second_file != nullptr);
+  BinaryPipe first(fileno(first_file));
+  log(first);
+  log(first);
+  BinaryPipe second(fileno(second_file));
+  log(second);
+  log(second);
+
+  const eastl::fixed_vector<bool, 4> once = { true, false };
+  REQUIRE(described_sites(first) == once);
+  REQUIRE(described_sites(second) == once);
+  fclose(first_file);
+  fclose(second_file);
+}
+
+namespace {
+// Binary line of a tag and raw uint32_t values
+eastl::fixed_string<char8_t, 64>
+raw_line(TAG tag, std::initializer_list<uint32_t> values, size_t tail = 0)
+{
+  eastl::fixed_string<char8_t, 64> line;
+  line.push_back(static_cast<char8_t>(tag));
+  for (const uint32_t x : values) {
+    line.append(reinterpret_cast<const char8_t*>(&x), sizeof(x));
+  }
+  line.append(tail, u8'x');
+  return line;
+}
+}
+
+TEST_CASE("Truncated and oversized binary lines are rejected", "log")
+{
+  const eastl::fixed_string<char8_t, 64> lines[] = {
+    // Site info header cut, file size past the end, file size that wraps
+    raw_line(TAG::SITE_INFO, { 1, 2 }),
+    raw_line(TAG::SITE_INFO, { 1, 2, 10 }, 5),
+    raw_line(TAG::SITE_INFO, { 1, 2, 0xFFFFFFF4 }),
+    raw_line(TAG::SITE_INFO, { 1, 2, 0xFFFFFFFF }, 3),
+    // Strings and values past the end
+    raw_line(TAG::STR8, { 4 }, 3),
+    raw_line(TAG::STR32, { 0x40000001 }, 4),
+    raw_line(TAG::FIELD, { 0xFFFFFFFF }),
+    raw_line(TAG::INT64, {}, 7),
+    raw_line(TAG::SITE, {}, 3),
+  };
+  BufferPipe<> pipe;
+  for (const auto& line : lines) {
+    const eastl::u8string_view view(line.data(), line.size());
+    SiteInfo site;
+    REQUIRE(!read_site(view, site));
+    JsonLine json;
+    REQUIRE(!to_json(LEVEL::INFO, view, json));
+    OStreamFactory factory(LEVEL::INFO, pipe);
+    OStream out(factory);
+    REQUIRE(!replay(view, out));
+  }
+
+  // Frame longer than the data
+  const auto frame = raw_line(TAG::SITE, { 0x00010000 }, 8);
+  eastl::u8string_view data(frame.data() + 1, frame.size() - 1);
+  BinaryRecord record;
+  REQUIRE(!next_record(data, record));
+}
+
+namespace {
+// Lines of a binary pipe, replayed as text and converted to json
+struct Decoded
+{
+  eastl::fixed_string<char8_t, 4096> text;
+  eastl::vector<JsonLine> json;
+};
+
+// Log to a binary pipe over a temporary file and decode every record
+template<typename Log>
+Decoded
+decode_binary(Log log)
+{
+  FILE* file = tmpfile();
+  REQUIRE(file != nullptr);
+  BinaryPipe binary(fileno(file));
+  log(binary);
+  eastl::fixed_string<char8_t, 1024> data;
+  data.resize(lseek(binary.fd, 0, SEEK_END));
+  REQUIRE(pread(binary.fd, data.data(), data.size(), 0) ==
+          static_cast<ssize_t>(data.size()));
+  fclose(file);
+
+  BufferPipe<true> text;
+  Decoded decoded;
+  eastl::u8string_view view(data.data(), data.size());
+  BinaryRecord record;
+  while (!view.empty()) {
+    REQUIRE(next_record(view, record));
+    {
+      OStreamFactory factory(record.level, text);
+      OStream out(factory);
+      REQUIRE(replay(record.line, out));
+    }
+    REQUIRE(to_json(record.level, record.line, decoded.json.emplace_back()));
+  }
+  decoded.text = text.buffer;
+  return decoded;
+}
+}
+
+TEST_CASE("Fields in text and binary format", "log")
+{
+  BufferPipe<true> text;
+  {
+    OStreamFactory factory(LEVEL::INFO, text);
+    factory << u8"parsed" << field(u8"latency_us", 123.5)
+            << field(u8"op", u8"parse");
+    factory << field(u8"count", 3);
+    // Fields hold copies of values, temporaries included
+    const auto kept = field(u8"sum", 1.0 + 2.5);
+    const auto name = field(u8"name", u8"x");
+    factory << kept << name;
+  }
+  REQUIRE(text.buffer == u8"[I] parsed latency_us=123.5 op=parse\n[I] count=3\n"
+                         u8"[I] sum=3.5 name=x\n");
+
+  const Decoded decoded = decode_binary([](IPipe& binary) {
+    OStreamFactory factory(LEVEL::INFO, binary);
+    factory << u8"parsed" << field(u8"latency_us", 123.5)
+            << field(u8"op", u8"parse");
+  });
+  REQUIRE(decoded.text == u8"[I] parsed latency_us=123.5 op=parse\n");
+}
+
+namespace {
+template<typename T>
+void
+check_join(const eastl::vector<T>& values, eastl::u8string_view separator)
+{
+  BufferPipe<> chained;
+  {
+    OStreamFactory factory(LEVEL::INFO, chained);
+    OStream out(factory);
+    for (size_t i = 0; i < values.size(); ++i) {
+      if (i != 0) {
+        out << separator;
+      }
+      out << values[i];
+    }
+  }
+
+  BufferPipe<> joined;
+  {
+    OStreamFactory factory(LEVEL::INFO, joined);
+    factory << join(values, separator);
+  }
+  REQUIRE(joined.buffer == chained.buffer);
+
+  // Exact capacity, so that sanitizers catch stores past it
+  const Join<T> j = join(values, separator);
+  eastl::vector<char8_t> buffer(join_capacity(j));
+  const size_t size = write_join(j, buffer.data());
+  const eastl::u8string_view line(chained.buffer.data(),
+                                  chained.buffer.size() - 1);
+  REQUIRE(eastl::u8string_view(buffer.data(), size) == line);
+}
+
+template<typename T>
+eastl::vector<T>
+join_values(uint64_t& x, size_t count)
+{
+  eastl::vector<T> values;
+  for (size_t i = 0; i < count; ++i) {
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    if constexpr (eastl::is_floating_point_v<T>) {
+      using Bits = eastl::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+      const auto bits = static_cast<Bits>(x);
+      T value;
+      memcpy(&value, &bits, sizeof(value));
+      values.push_back(value);
+    } else {
+      // Every digit count is equally likely
+      values.push_back(static_cast<T>(x >> (x & 63)));
+    }
+  }
+  return values;
+}
+
+template<typename T>
+void
+check_join_types(uint64_t& x)
+{
+  check_join<T>({}, u8", ");
+  check_join<T>({ eastl::numeric_limits<T>::min(),
+                  eastl::numeric_limits<T>::max(),
+                  T(0),
+                  T(1) },
+                u8", ");
+  for (eastl::u8string_view separator :
+       { u8"", u8" ", u8", ", u8" | long separator | " }) {
+    for (size_t count : { 1, 2, 3, 17, 1000 }) {
+      check_join(join_values<T>(x, count), separator);
+    }
+  }
+}
+}
+
+TEST_CASE("Join writes the same as chained elements", "log")
+{
+  uint64_t x = 88172645463325252ULL;
+  check_join_types<int8_t>(x);
+  check_join_types<int16_t>(x);
+  check_join_types<int32_t>(x);
+  check_join_types<int64_t>(x);
+  check_join_types<uint8_t>(x);
+  check_join_types<uint16_t>(x);
+  check_join_types<uint32_t>(x);
+  check_join_types<uint64_t>(x);
+  check_join_types<float>(x);
+  check_join_types<double>(x);
+
+  // Every digit count and its neighbours
+  eastl::vector<uint64_t> powers;
+  uint64_t power = 1;
+  for (int i = 0; i < 20; ++i, power *= 10) {
+    for (uint64_t value : { power - 1, power, power + 1 }) {
+      powers.push_back(value);
+    }
+  }
+  check_join(powers, u8" ");
+
+  {
+    ExpectLog log(u8"[1, 22, 333]\n");
+    const int32_t values[] = { 1, 22, 333 };
+    debug << u8'[' << join(eastl::span<const int32_t>(values)) << u8']';
+  }
+
+  std::ostringstream printed;
+  printed << eastl::vector<int64_t>{ 1, -22, 333 }
+          << eastl::vector<uint64_t>{ UINT64_MAX }
+          << eastl::vector<double>{ 0.5 } << eastl::vector<int32_t>{};
+  REQUIRE(printed.str().find("> {1, -22, 333, }") != std::string::npos);
+  REQUIRE(printed.str().find("> {18446744073709551615, }") !=
+          std::string::npos);
+  REQUIRE(printed.str().find("> {0.5, }") != std::string::npos);
+  REQUIRE(printed.str().ends_with("> {}"));
+}
+
+TEST_CASE("Join in binary format decodes to the same text", "log")
+{
+  const eastl::vector<double> values = { 1.5, -0.25, 1e100 };
+  BufferPipe<true> text;
+  {
+    OStreamFactory factory(LEVEL::INFO, text);
+    factory << u8"values " << join(values, u8"; ");
+  }
+  REQUIRE(text.buffer == u8"[I] values 1.5; -0.25; 1.0e+100\n");
+
+  const Decoded decoded = decode_binary([&values](IPipe& binary) {
+    OStreamFactory factory(LEVEL::INFO, binary);
+    factory << u8"values " << join(values, u8"; ");
+  });
+  REQUIRE(decoded.text == text.buffer);
+}
+
+TEST_CASE("Float format in binary format decodes to the same text", "log")
+{
+  BufferPipe<true> text;
+  {
+    OStreamFactory factory(LEVEL::INFO, text);
+    factory << fixed(2) << 1.0 / 3 << u8' ' << scientific(0) << 1234.5f
+            << u8' ' << shortest() << 0.1;
+  }
+  REQUIRE(text.buffer == u8"[I] 0.33 1e+03 0.1\n");
+
+  const Decoded decoded = decode_binary([](IPipe& binary) {
+    OStreamFactory factory(LEVEL::INFO, binary);
+    factory << fixed(2) << 1.0 / 3 << u8' ' << scientific(0) << 1234.5f
+            << u8' ' << shortest() << 0.1;
+    factory << fixed(1) << u8"load" << field(u8"cpu", 0.25);
+  });
+  REQUIRE(decoded.text == u8"[I] 0.33 1e+03 0.1\n[I] load cpu=0.2\n");
+  REQUIRE(decoded.json.size() == 2);
+  REQUIRE(decoded.json[1] ==
+          u8"{\"level\":\"INFO\",\"msg\":\"load\",\"cpu\":0.2}");
+
+  // Unknown notation and precision over the limit are malformed
+  const auto format_line = [](uint8_t notation, uint32_t precision) {
+    eastl::fixed_string<char8_t, 8> line;
+    line.push_back(static_cast<char8_t>(TAG::FLOAT_FORMAT));
+    line.push_back(static_cast<char8_t>(notation));
+    line.append(reinterpret_cast<const char8_t*>(&precision),
+                sizeof(precision));
+    return line;
+  };
+  const uint8_t FIXED = static_cast<uint8_t>(NOTATION::FIXED);
+  for (const auto& line : { format_line(3, 0),
+                            format_line(FIXED, MAX_PRECISION + 1),
+                            format_line(FIXED, 0xFFFFFFFF) }) {
+    const eastl::u8string_view view(line.data(), line.size());
+    JsonLine rejected;
+    REQUIRE(!to_json(LEVEL::INFO, view, rejected));
+    BufferPipe<> pipe;
+    OStreamFactory factory(LEVEL::INFO, pipe);
+    OStream out(factory);
+    REQUIRE(!replay(view, out));
+  }
+  const auto limit = format_line(FIXED, MAX_PRECISION);
+  JsonLine accepted;
+  REQUIRE(to_json(
+    LEVEL::INFO, eastl::u8string_view(limit.data(), limit.size()), accepted));
+
+  // Manipulators cap the precision
+  REQUIRE(fixed(MAX_PRECISION + 1).precision == MAX_PRECISION);
+  REQUIRE(scientific(0xFFFFFFFF).precision == MAX_PRECISION);
+}
+
+TEST_CASE("Json pipe writes one object per line", "log")
+{
+  FILE* file = tmpfile();
+  REQUIRE(file != nullptr);
+  JsonPipe json(fileno(file));
+  {
+    OStreamFactory factory(LEVEL::WARNING, json);
+    factory << u8"slow \"query\" " << 2 << field(u8"latency_us", 123.5)
+            << field(u8"op", u8"parse") << field(u8"nan", std::nan(""))
+            << field(u8"char", u8'c') << field(u8"msg", 1);
+    factory << EXTEND_LOG_SITE << field(u8"count", uint64_t(3));
+  }
+  eastl::fixed_string<char8_t, 512> data;
+  data.resize(lseek(json.fd, 0, SEEK_END));
+  REQUIRE(pread(json.fd, data.data(), data.size(), 0) ==
+          static_cast<ssize_t>(data.size()));
+  fclose(file);
+
+  eastl::u8string_view view(data.data(), data.size());
+  const size_t first_end = view.find(u8'\n');
+  REQUIRE(view.substr(0, first_end) ==
+          u8"{\"level\":\"WARNING\",\"msg\":\"slow \\\"query\\\" 2\","
+          u8"\"latency_us\":123.5,\"op\":\"parse\",\"nan\":\"nan\","
+          u8"\"char\":\"c\",\"_msg\":1}");
+  view.remove_prefix(first_end + 1);
+  REQUIRE(view.substr(0, 26) == u8"{\"level\":\"WARNING\",\"site\":");
+  REQUIRE(view.find(u8"\"file\":\"") != eastl::u8string_view::npos);
+  REQUIRE(view.find(u8",\"msg\":\"\",\"count\":3}\n") !=
+          eastl::u8string_view::npos);
+}
+
+TEST_CASE("Json escape", "log")
+{
+  // Every position of a special char in a 16 byte chunk and the tail
+  for (size_t i = 0; i < 40; ++i) {
+    for (const char8_t c : { u8'"', u8'\\', u8'\n', u8'\x01', u8'\x1f' }) {
+      eastl::fixed_string<char8_t, 64> str(40, u8'a');
+      str[i] = c;
+      str[39 - i] = u8'\xc3';
+      JsonLine escaped;
+      json_escape(str, escaped);
+
+      JsonLine expected;
+      for (const char8_t x : str) {
+        if (x == u8'"') {
+          expected.append(u8"\\\"");
+        } else if (x == u8'\\') {
+          expected.append(u8"\\\\");
+        } else if (x == u8'\n') {
+          expected.append(u8"\\n");
+        } else if (x < 0x20) {
+          expected.append_sprintf(u8"\\u%04x", x);
+        } else {
+          expected.push_back(x);
+        }
+      }
+      REQUIRE(escaped == expected);
+    }
+  }
+}
+
+namespace {
+/** Keep the last binary line.
+ */
+struct LastBinaryLine : IPipe
+{
+  virtual void log(LEVEL, eastl::u8string_view str) override
+  {
+    line.assign(str.data(), str.size());
+  }
+
+  virtual FORMAT format() const override { return FORMAT::BINARY; }
+
+  eastl::fixed_string<char8_t, 1024> line;
+};
+}
+
+TEST_CASE("Json decoding ignores levels and line counters", "log")
+{
+  // A long message spills the scratch lines of to_json
+  const eastl::fixed_string<char8_t, 1024> text(LINE_CAPACITY * 2, u8'x');
+  LastBinaryLine binary;
+  {
+    OStreamFactory factory(LEVEL::INFO, binary);
+    factory << eastl::u8string_view(text.data(), text.size())
+            << field(u8"n", 1);
+  }
+
+  default_channel.set_levels(0);
+  const LineStats before = line_stats();
+  JsonLine json;
+  const bool decoded = to_json(
+    LEVEL::INFO, eastl::u8string_view(binary.line.data(), binary.line.size()),
+    json);
+  const LineStats after = line_stats();
+  default_channel.reset();
+
+  REQUIRE(decoded);
+  const eastl::u8string_view tail(u8"\",\"n\":1}");
+  REQUIRE(json.size() > text.size() + tail.size());
+  REQUIRE(eastl::u8string_view(json.data() + json.size() - tail.size(),
+                               tail.size()) == tail);
+  REQUIRE(after.spilled == before.spilled);
+  REQUIRE(after.max_length == before.max_length);
+}
+
+TEST_CASE("Site limits drop lines and report them", "log")
+{
+  init_default_pipe<BufferPipe<true>>();
+  const auto& buffer = get_default_pipe<BufferPipe<true>>()->buffer;
+  const Site& every = EXTEND_LOG_SITE_EVERY(3);
+  for (int32_t i = 0; i < 8; ++i) {
+    info << every << i;
+  }
+  eastl::fixed_string<char8_t, 512> expected;
+  const auto suppressed = [&](uint64_t count, const Site& site) {
+    expected.append_sprintf(u8"[W] suppressed %I64u messages from %s:%u\n",
+                            count,
+                            site.file,
+                            site.line);
+  };
+  expected.append(u8"[I] 0\n");
+  suppressed(2, every);
+  expected.append(u8"[I] 3\n");
+  suppressed(2, every);
+  expected.append(u8"[I] 6\n");
+  REQUIRE(buffer == expected);
+
+  const Site& rate = EXTEND_LOG_SITE_RATE(1, 2);
+  for (int32_t i = 0; i < 5; ++i) {
+    warning << rate << i;
+  }
+  expected.append(u8"[W] 0\n[W] 1\n");
+  REQUIRE(buffer == expected);
+
+  report_suppressed();
+  suppressed(3, rate);
+  suppressed(1, every);
+  REQUIRE(buffer == expected);
+  report_suppressed();
+  REQUIRE(buffer == expected);
+
+  // Reports are written above the threshold too
+  warning << rate << 5;
+  set_level(LEVEL::ERROR);
+  report_suppressed();
+  set_level(LEVEL::DEBUG);
+  suppressed(1, rate);
+  REQUIRE(buffer == expected);
+}
+
+TEST_CASE("Long lines reuse chunks of the thread pool", "log")
+{
+  LinePoolAllocator allocator;
+  void* chunk = allocator.allocate(1000);
+  allocator.deallocate(chunk, 1000);
+  const LineStats pooled = line_stats();
+  REQUIRE(pooled.bytes_pooled >= 1024);
+  // The same size class
+  void* again = allocator.allocate(600);
+  REQUIRE(again == chunk);
+  allocator.deallocate(again, 600);
+
+  init_default_pipe<NullPipe>();
+  const eastl::fixed_string<char8_t, 1024> text(LINE_CAPACITY * 2, u8'x');
+  const eastl::u8string_view long_line(text.data(), text.size());
+  info << long_line;
+  const LineStats before = line_stats();
+  info << u8"short";
+  for (int i = 0; i < 10; ++i) {
+    info << long_line;
+  }
+  const LineStats after = line_stats();
+  REQUIRE(after.spilled == before.spilled + 10);
+  REQUIRE(after.max_length >= LINE_CAPACITY * 2);
+  // Steady state takes no chunks from the global allocator
+  REQUIRE(after.allocations == before.allocations);
+}
+
+TEST_CASE("Uring file pipe writes every line", "log")
+{
+  for (const bool use_uring : { true, false }) {
+    char path[] = "/tmp/extend-log-XXXXXX";
+    close(mkstemp(path));
+    eastl::u8string expected;
+    {
+      UringFilePipe pipe(path, 256, 2, 1000000, {}, use_uring);
+      REQUIRE(pipe.is_open());
+      if (!use_uring) {
+        REQUIRE(!pipe.uses_uring());
+      }
+      OStreamFactory info(LEVEL::INFO, pipe);
+      OStreamFactory error(LEVEL::ERROR, pipe);
+      info << u8"first";
+      expected.append(u8"[I] first\n");
+      REQUIRE(read_file(path).empty());
+      error << u8"urgent";
+      expected.append(u8"[E] urgent\n");
+      pipe.flush();
+      REQUIRE(read_file(path) == expected);
+
+      const eastl::fixed_string<char8_t, 512> text(300, u8'x');
+      info << eastl::u8string_view(text.data(), text.size());
+      expected.append(u8"[I] ");
+      expected.append(text.data(), text.size());
+      expected.push_back(u8'\n');
+      pipe.flush();
+      // Spans every buffer more than once
+      const eastl::u8string longer(1000, u8'y');
+      info << u8"line " << eastl::u8string_view(longer.data(), longer.size());
+      expected.append(u8"[I] line ");
+      expected.append(longer);
+      expected.push_back(u8'\n');
+      pipe.flush();
+      for (int32_t i = 0; i < 1000; ++i) {
+        info << u8"line " << i;
+        expected.append_sprintf(u8"[I] line %I32d\n", i);
+        if (i % 8 == 0) {
+          pipe.flush();
+        }
+      }
+      pipe.flush();
+      REQUIRE(pipe.dropped() == 0);
+      REQUIRE(read_file(path) == expected);
+      info << u8"last";
+      expected.append(u8"[I] last\n");
+    }
+    {
+      UringFilePipe pipe(path, 4096, 4, 1000000, {}, use_uring);
+      OStreamFactory factory(LEVEL::INFO, pipe);
+      factory << u8"appended";
+    }
+    expected.append(u8"[I] appended\n");
+    REQUIRE(read_file(path) == expected);
+    unlink(path);
+  }
+}
+
+TEST_CASE("Uring file pipe reports lines dropped while the ring is full",
+          "log")
+{
+  char path[] = "/tmp/extend-log-XXXXXX";
+  close(mkstemp(path));
+  unlink(path);
+  REQUIRE(mkfifo(path, 0600) == 0);
+  // Writes to a full fifo stay in flight until it is read
+  const int reader = open(path, O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+  const int filler = open(path, O_WRONLY | O_NONBLOCK | O_CLOEXEC);
+  REQUIRE(reader >= 0);
+  REQUIRE(filler >= 0);
+  const char8_t block[4096] = {};
+  while (write(filler, block, sizeof(block)) > 0) {
+  }
+  close(filler);
+  eastl::u8string output;
+  const auto drain = [&] {
+    char8_t chunk[4096];
+    ssize_t size;
+    while ((size = read(reader, chunk, sizeof(chunk))) > 0) {
+      output.append(chunk, chunk + size);
+    }
+  };
+
+  static Channel lines("test.uring");
+  lines.set_level(LEVEL::DEBUG);
+  set_level(LEVEL::ERROR);
+  {
+    UringFilePipe pipe(path, 256, 2, 1000000, {}, true);
+    REQUIRE(pipe.is_open());
+    if (pipe.uses_uring()) {
+      OStreamFactory factory(LEVEL::INFO, pipe, lines);
+      for (int32_t i = 0; i < 100; ++i) {
+        factory << u8"line " << i;
+      }
+      const uint64_t dropped = pipe.dropped();
+      REQUIRE(dropped != 0);
+      drain();
+      factory << u8"after";
+      pipe.flush();
+      drain();
+
+      // Written lines go first, the report before the next one
+      int32_t written = 0;
+      for (size_t at = 0;
+           (at = output.find(u8"[I] line ", at)) != eastl::u8string::npos;
+           ++at) {
+        ++written;
+      }
+      REQUIRE(written + dropped == 100);
+      eastl::u8string expected;
+      expected.append_sprintf(
+        u8"\n[W] UringFilePipe dropped %I64u lines\n[I] after\n", dropped);
+      REQUIRE(output.size() > expected.size());
+      REQUIRE(output.substr(output.size() - expected.size()) == expected);
+    }
+  }
+  set_level(LEVEL::DEBUG);
+  close(reader);
+  unlink(path);
+}
+
+TEST_CASE("LZ round trip", "log")
+{
+  eastl::vector<eastl::u8string> inputs = { u8"", u8"abc", u8"abcdabcd" };
+  inputs.emplace_back(1000, u8'a');
+  eastl::u8string text;
+  for (int32_t i = 0; i < 500; ++i) {
+    text.append_sprintf(u8"[I] request %I32d latency_us=%I32d\n", i, i * 7);
+  }
+  inputs.push_back(text);
+  eastl::u8string noise;
+  uint32_t seed = 42;
+  for (int i = 0; i < 5000; ++i) {
+    seed = seed * 1664525 + 1013904223;
+    noise.push_back(static_cast<char8_t>(seed >> 24));
+  }
+  inputs.push_back(noise);
+
+  for (const eastl::u8string& input : inputs) {
+    eastl::u8string packed(lz_bound(input.size()), u8'\0');
+    const size_t size = lz_compress(
+      { input.data(), input.size() }, packed.data(), packed.size());
+    REQUIRE(size != 0);
+    eastl::u8string unpacked(input.size(), u8'\0');
+    REQUIRE(
+      lz_decompress({ packed.data(), size }, unpacked.data(), input.size()));
+    REQUIRE(unpacked == input);
+    if (input.size() >= 1000 && input != noise) {
+      REQUIRE(size < input.size() / 3);
+    }
+    if (!input.empty()) {
+      REQUIRE(!lz_decompress(
+        { packed.data(), size - 1 }, unpacked.data(), input.size()));
+      REQUIRE(!lz_decompress(
+        { packed.data(), size }, unpacked.data(), input.size() - 1));
+    }
+  }
+  char8_t small[4];
+  REQUIRE(lz_compress({ noise.data(), noise.size() }, small, 4) == 0);
+}
+
+TEST_CASE("Compress pipe output decodes to the same text", "log")
+{
+  char path[] = "/tmp/extend-log-XXXXXX";
+  const int fd = mkstemp(path);
+  BufferPipe<true> capture;
+  {
+    CompressPipe pipe(fd, 1024, 1000000);
+    IPipe* pipes[] = { &pipe, &capture };
+    for (IPipe* p : pipes) {
+      OStreamFactory info(LEVEL::INFO, *p);
+      OStreamFactory error(LEVEL::ERROR, *p);
+      for (int32_t i = 0; i < 200; ++i) {
+        info << u8"request " << i << field(u8"latency_us", i * 1.5);
+      }
+      error << u8"failed";
+    }
+    pipe.flush();
+    const eastl::u8string text(3000, u8'x');
+    for (IPipe* p : pipes) {
+      OStreamFactory info(LEVEL::INFO, *p);
+      info << eastl::u8string_view(text.data(), text.size());
+      info << u8"last";
+    }
+  }
+  close(fd);
+  const eastl::u8string data = read_file(path);
+  unlink(path);
+
+  eastl::u8string text;
+  REQUIRE(decompress({ data.data(), data.size() }, text));
+  REQUIRE(eastl::u8string_view(text.data(), text.size()) ==
+          eastl::u8string_view(capture.buffer.data(), capture.buffer.size()));
+  REQUIRE(data.size() < text.size() / 2);
+
+  eastl::vector<BlockIndex> index;
+  REQUIRE(read_index({ data.data(), data.size() }, index));
+  REQUIRE(index.size() > 4);
+  uint64_t lines = 0;
+  for (const BlockIndex& block : index) {
+    REQUIRE(block.header.first_line == lines);
+    REQUIRE(block.header.first_time > 0);
+    lines += block.header.lines;
+  }
+  REQUIRE(lines == 203);
+  REQUIRE(find_line(index, 203) == index.size());
+
+  const size_t found = find_line(index, 100);
+  REQUIRE(found < index.size());
+  const uint64_t first = index[found].header.first_line;
+  REQUIRE(first <= 100);
+  eastl::u8string block;
+  REQUIRE(decode_block({ data.data(), data.size() }, index[found], block));
+  eastl::u8string expected;
+  expected.append_sprintf(u8"[I] request %I64u ", first);
+  REQUIRE(block.compare(0, expected.size(), expected) == 0);
+
+  REQUIRE(!decompress({ data.data(), data.size() - 1 }, text));
+}
+
+TEST_CASE("Flight recorder keeps every level and dumps at fatal", "log")
+{
+  char path[] = "/tmp/extend-log-XXXXXX";
+  const int fd = mkstemp(path);
+  BufferPipe<true> sink;
+  {
+    FlightRecorderPipe recorder(sink, LEVEL::WARNING, 8, fd);
+    OStreamFactory debug(LEVEL::DEBUG, recorder);
+    OStreamFactory warning(LEVEL::WARNING, recorder);
+    OStreamFactory fatal(LEVEL::FATAL, recorder);
+    for (int32_t i = 0; i < 20; ++i) {
+      debug << u8"step " << i;
+    }
+    warning << u8"slow";
+    REQUIRE(sink.buffer == u8"[W] slow\n");
+    REQUIRE(read_file(path).empty());
+
+    recorder.dump();
+    eastl::u8string expected;
+    for (int32_t i = 13; i < 20; ++i) {
+      expected.append_sprintf(u8"[D] step %I32d\n", i);
+    }
+    expected.append(u8"[W] slow\n");
+    REQUIRE(read_file(path) == expected);
+
+    const eastl::u8string text(1000, u8'x');
+    debug << eastl::u8string_view(text.data(), text.size());
+    fatal << u8"stop";
+    REQUIRE(sink.buffer == u8"[W] slow\n[F] stop\n");
+    // The whole ring again, not only lines since the previous dump
+    for (int32_t i = 15; i < 20; ++i) {
+      expected.append_sprintf(u8"[D] step %I32d\n", i);
+    }
+    expected.append(u8"[W] slow\n[D] ");
+    expected.append(FlightRecorderPipe::SLOT_SIZE - 16, u8'x');
+    expected.append(FlightRecorderPipe::TRUNCATED.data(),
+                    FlightRecorderPipe::TRUNCATED.size());
+    expected.append(u8"\n[F] stop\n");
+    REQUIRE(read_file(path) == expected);
+  }
+  close(fd);
+  unlink(path);
+}
+
+TEST_CASE("Flight recorder never dumps torn lines", "log")
+{
+  char path[] = "/tmp/extend-log-XXXXXX";
+  const int fd = mkstemp(path);
+  {
+    // Two slots, so threads write the same slot on every wrap
+    FlightRecorderPipe recorder(2, fd);
+    constexpr int THREADS = 4;
+    struct Context
+    {
+      FlightRecorderPipe& recorder;
+      eastl::atomic<bool> running{ true };
+      eastl::atomic<int> next{ 0 };
+      eastl::atomic<uint64_t> written{ 0 };
+    } context{ recorder };
+    EA::Thread::Thread threads[THREADS];
+    for (auto& thread : threads) {
+      thread.Begin(
+        [](void* data) -> intptr_t {
+          auto& context = *static_cast<Context*>(data);
+          // Each thread writes its own letter, its own count of times
+          const int index = context.next.fetch_add(1);
+          const eastl::u8string line(16 + index * 64, u8'a' + index);
+          OStreamFactory debug(LEVEL::DEBUG, context.recorder);
+          while (context.running.load()) {
+            debug << eastl::u8string_view(line.data(), line.size());
+            context.written.fetch_add(1);
+          }
+          return 0;
+        },
+        &context);
+    }
+    while (context.written.load() < THREADS) {
+      EA::Thread::ThreadSleep();
+    }
+    for (int i = 0; i < 1000; ++i) {
+      recorder.dump();
+    }
+    context.running.store(false);
+    for (auto& thread : threads) {
+      thread.WaitForEnd();
+    }
+    recorder.dump();
+  }
+
+  const eastl::u8string dumped = read_file(path);
+  REQUIRE(!dumped.empty());
+  eastl::u8string_view rest(dumped.data(), dumped.size());
+  while (!rest.empty()) {
+    const size_t end = rest.find(u8'\n');
+    REQUIRE(end != eastl::u8string_view::npos);
+    const eastl::u8string_view line = rest.substr(4, end - 4);
+    REQUIRE(rest.substr(0, 4) == u8"[D] ");
+    const int index = line[0] - u8'a';
+    REQUIRE(line.size() == 16 + size_t(index) * 64);
+    REQUIRE(line.find_first_not_of(line[0]) == eastl::u8string_view::npos);
+    rest.remove_prefix(end + 1);
+  }
+  close(fd);
+  unlink(path);
+}
+
+TEST_CASE("Flight recorder dumps on crash", "log")
+{
+  char path[] = "/tmp/extend-log-XXXXXX";
+  const int fd = mkstemp(path);
+  const pid_t child = fork();
+  if (child == 0) {
+    static FlightRecorderPipe recorder(4, fd);
+    FlightRecorderPipe::install_crash_handlers();
+    OStreamFactory debug(LEVEL::DEBUG, recorder);
+    for (int32_t i = 0; i < 10; ++i) {
+      debug << u8"step " << i;
+    }
+    abort();
+  }
+  int status = 0;
+  REQUIRE(waitpid(child, &status, 0) == child);
+  REQUIRE(WIFSIGNALED(status));
+  REQUIRE(WTERMSIG(status) == SIGABRT);
+  REQUIRE(read_file(path) == u8"[D] step 6\n[D] step 7\n[D] step 8\n"
+                             u8"[D] step 9\n");
+  close(fd);
+  unlink(path);
+}
+
+namespace {
+volatile sig_atomic_t previous_handled = 0;
+}
+
+TEST_CASE("Flight recorder chains to the previous handler", "log")
+{
+  char path[] = "/tmp/extend-log-XXXXXX";
+  const int fd = mkstemp(path);
+  const pid_t child = fork();
+  if (child == 0) {
+    signal(SIGFPE, [](int) { previous_handled = previous_handled + 1; });
+    signal(SIGTERM, [](int) { previous_handled = previous_handled + 1; });
+    static FlightRecorderPipe recorder(4, fd);
+    FlightRecorderPipe::install_crash_handlers();
+    OStreamFactory debug(LEVEL::DEBUG, recorder);
+    debug << u8"step";
+    // Back to the recorder after the previous handler returns
+    raise(SIGFPE);
+    raise(SIGFPE);
+    // Handled by the application, the process goes on
+    raise(SIGTERM);
+    _exit(previous_handled);
+  }
+  int status = 0;
+  REQUIRE(waitpid(child, &status, 0) == child);
+  REQUIRE(WIFEXITED(status));
+  REQUIRE(WEXITSTATUS(status) == 3);
+  REQUIRE(read_file(path) == u8"[D] step\n[D] step\n");
+  close(fd);
+  unlink(path);
+}
+
+TEST_CASE("Tee pipe builds the prefix once for every sink", "log")
+{
+  char first_path[] = "/tmp/extend-log-XXXXXX";
+  char second_path[] = "/tmp/extend-log-XXXXXX";
+  char async_path[] = "/tmp/extend-log-XXXXXX";
+  char json_path[] = "/tmp/extend-log-XXXXXX";
+  const int first_fd = mkstemp(first_path);
+  const int second_fd = mkstemp(second_path);
+  const int async_fd = mkstemp(async_path);
+  const int json_fd = mkstemp(json_path);
+  BufferPipe<true> warnings;
+  {
+    FdPipe first(first_fd, 0, FdPipe::DEFAULT_DELAY_MS, { true, true });
+    FdPipe second(second_fd, 1024);
+    FdPipe async_sink(async_fd, 0);
+    AsyncPipe async(async_sink);
+    JsonPipe json(json_fd);
+    const TeeSink sinks[] = { { &first, LEVEL::DEBUG },
+                              { &second, LEVEL::INFO },
+                              { &warnings, LEVEL::WARNING },
+                              { &async, LEVEL::ERROR },
+                              { &json, LEVEL::DEBUG } };
+    TeePipe tee(sinks, { true, true });
+    REQUIRE(tee.format() == FORMAT::TEXT);
+
+    OStreamFactory debug(LEVEL::DEBUG, tee);
+    OStreamFactory info(LEVEL::INFO, tee);
+    OStreamFactory error(LEVEL::ERROR, tee);
+    debug << u8"one";
+    info << u8"two";
+    error << u8"three";
+
+    const Line lines[] = { { LEVEL::DEBUG, u8"four" },
+                           { LEVEL::WARNING, u8"five" },
+                           { LEVEL::FATAL, u8"six" } };
+    tee.log_batch(lines);
+    tee.flush();
+  }
+
+  // Every file got the same prefixes, timestamps included, through
+  // AsyncPipe too
+  const eastl::u8string first = read_file(first_path);
+  REQUIRE(first.find(u8"[D] ") == 0);
+  REQUIRE(first.find(u8" one\n") != eastl::u8string::npos);
+  const auto from = [&](eastl::u8string_view tags) {
+    eastl::u8string filtered;
+    for (size_t begin = 0; begin < first.size();) {
+      const size_t end = first.find(u8'\n', begin) + 1;
+      if (tags.find(first[begin + 1]) != eastl::u8string_view::npos) {
+        filtered.append(first, begin, end - begin);
+      }
+      begin = end;
+    }
+    return filtered;
+  };
+  REQUIRE(read_file(second_path) == from(u8"IWEF"));
+  REQUIRE(read_file(async_path) == from(u8"EF"));
+  REQUIRE(warnings.buffer == u8"[E] three\n[W] five\n[F] six\n");
+  // Lines are not formatted for the other format
+  REQUIRE(read_file(json_path).empty());
+
+  for (const int fd : { first_fd, second_fd, async_fd, json_fd }) {
+    close(fd);
+  }
+  for (const char* path : { first_path, second_path, async_path, json_path }) {
+    unlink(path);
+  }
+}
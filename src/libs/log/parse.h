@@ -0,0 +1,82 @@
+/* extend - expansible programming language
+ * Copyright (C) 2022 Vladimir Liutov vs@lutov.net
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <EASTL/span.h>
+#include <cinttypes>
+#include <cstddef>
+
+namespace extend::log {
+
+/** Status of parse_double, parse_float and parse_integer.
+ */
+enum struct PARSE
+{
+  OK,
+  /** The text does not start with a number. */
+  INVALID,
+  /** The number is too large or too small, the value is infinity or zero,
+   * integers are saturated to the limits of the type.
+   */
+  OUT_OF_RANGE,
+};
+
+/** Number read from the start of the text.
+ */
+template<typename T>
+struct Parsed
+{
+  T value;
+  /** Count of consumed chars, zero if the text is invalid. */
+  size_t length;
+  PARSE status;
+};
+
+/** Read the number written by dtoa, strtod syntax without hexadecimal
+ * numbers, leading spaces and locale: [+-]digits[.digits][(e|E)[+-]digits],
+ * "nan", "inf" and "infinity" in any case.
+ *
+ * The result is the nearest double, ties to even. Up to 19 significant
+ * digits it is computed with Eisel-Lemire algorithm, exact decimal
+ * arithmetic is used for the rest and for the rare undecided cases.
+ *
+ * @param  str Text, the number may be followed by anything.
+ */
+Parsed<double>
+parse_double(eastl::span<const char8_t> str);
+
+/** Read the number written by ftoa, the same way as parse_double.
+ */
+Parsed<float>
+parse_float(eastl::span<const char8_t> str);
+
+/** Read an integer, strtol syntax without leading spaces, base prefixes and
+ * locale: [+-]digits, the minus only for signed types. Digits after 9 are
+ * letters in any case.
+ *
+ * Blocks of 8 digits are converted at once in a 64-bit word, blocks of 16
+ * digits of bases up to 10 and 16 with SSE4.1 when the processor supports
+ * it.
+ *
+ * @param  str Text, the number may be followed by anything.
+ * @param  base Radix from 2 to 16, other values are INVALID.
+ */
+template<typename T>
+Parsed<T>
+parse_integer(eastl::span<const char8_t> str, unsigned base = 10);
+}
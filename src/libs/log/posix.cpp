@@ -0,0 +1,96 @@
+/* extend - expansible programming language
+ * Copyright (C) 2022 Vladimir Liutov vs@lutov.net
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "posix.h"
+
+#include <cerrno>
+#include <cstring>
+#include <unistd.h>
+
+namespace extend::log {
+
+void
+write_all(int fd, iovec* iov, int count)
+{
+  while (count != 0) {
+    ssize_t written = ::writev(fd, iov, count);
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return;
+    }
+    while (count != 0 && static_cast<size_t>(written) >= iov->iov_len) {
+      written -= iov->iov_len;
+      ++iov;
+      --count;
+    }
+    if (count != 0) {
+      iov->iov_base = static_cast<char*>(iov->iov_base) + written;
+      iov->iov_len -= written;
+    }
+  }
+}
+
+void
+CrashChain::install(void (*handler)(int, siginfo_t*, void*))
+{
+  if (installed.exchange(true)) {
+    return;
+  }
+  struct sigaction action;
+  memset(&action, 0, sizeof(action));
+  action.sa_sigaction = handler;
+  action.sa_flags = SA_SIGINFO | SA_NODEFER;
+  sigemptyset(&action.sa_mask);
+  for (size_t i = 0; i < eastl::size(CRASH_SIGNALS); ++i) {
+    sigaction(CRASH_SIGNALS[i], &action, &previous_actions[i]);
+  }
+}
+
+const struct sigaction&
+CrashChain::previous(int signal) const
+{
+  size_t i = 0;
+  while (CRASH_SIGNALS[i] != signal) {
+    ++i;
+  }
+  return previous_actions[i];
+}
+
+bool
+CrashChain::handled(int signal) const
+{
+  const struct sigaction& p = previous(signal);
+  return (p.sa_flags & SA_SIGINFO) != 0 || p.sa_handler != SIG_DFL;
+}
+
+void
+CrashChain::chain(int signal, siginfo_t* info, void* context)
+{
+  const struct sigaction& p = previous(signal);
+  if ((p.sa_flags & SA_SIGINFO) != 0) {
+    p.sa_sigaction(signal, info, context);
+  } else if (p.sa_handler == SIG_DFL) {
+    sigaction(signal, &p, nullptr);
+    raise(signal);
+  } else if (p.sa_handler != SIG_IGN) {
+    p.sa_handler(signal);
+  }
+}
+
+}
@@ -0,0 +1,86 @@
+/* extend - expansible programming language
+ * Copyright (C) 2022 Vladimir Liutov vs@lutov.net
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/** POSIX helpers shared by the pipes, internal to the library. */
+
+#pragma once
+
+#include <EASTL/atomic.h>
+#include <EASTL/iterator.h>
+#include <csignal>
+#include <cstddef>
+#include <sys/uio.h>
+
+namespace extend::log {
+
+/** Smallest power of two not less than x, at least 2. */
+inline size_t
+ceil_pow2(size_t x)
+{
+  size_t result = 2;
+  while (result < x) {
+    result <<= 1;
+  }
+  return result;
+}
+
+/** Write all chunks, resuming after short writes and signals.
+ *
+ * Async-signal-safe, gives up on errors. Chunks are consumed.
+ */
+void
+write_all(int fd, iovec* iov, int count);
+
+/** Signals handled on crash, SIGTERM included as it ends the process too. */
+constexpr int CRASH_SIGNALS[] = { SIGSEGV, SIGBUS, SIGABRT,
+                                  SIGFPE,  SIGILL, SIGTERM };
+
+/** Crash handler chained in front of the handlers installed before it.
+ *
+ * Static storage, handlers cannot take locks.
+ */
+struct CrashChain
+{
+  /** Install handler for CRASH_SIGNALS, saving previous handlers.
+   *
+   * Only the first call installs, the second would save handler as previous.
+   */
+  void install(void (*handler)(int, siginfo_t*, void*));
+
+  /** Whether the application handles or ignores signal itself.
+   *
+   * SIGTERM handled so may not end the process.
+   */
+  bool handled(int signal) const;
+
+  /** Let the previous handler handle signal.
+   *
+   * Calls the previous handler, ours stays installed if the process
+   * survives it. The default action is taken by restoring it and raising
+   * signal, raising with a handler would run it after ours returns under
+   * sanitizers that defer signals.
+   */
+  void chain(int signal, siginfo_t* info, void* context);
+
+private:
+  const struct sigaction& previous(int signal) const;
+
+  struct sigaction previous_actions[eastl::size(CRASH_SIGNALS)];
+  eastl::atomic<bool> installed;
+};
+
+}
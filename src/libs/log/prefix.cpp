@@ -0,0 +1,132 @@
+/* extend - expansible programming language
+ * Copyright (C) 2022 Vladimir Liutov vs@lutov.net
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <cstring>
+#include <ctime>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "clock.h"
+#include "dtoa.h"
+#include "log.h"
+
+namespace extend::log {
+
+namespace {
+constexpr int64_t NS_PER_SECOND = 1000000000;
+
+// "2022-10-16T12:34:56."
+constexpr size_t DATE_TIME_SIZE = 20;
+
+/** Formatted timestamp of the last line of the thread.
+ */
+struct TimeCache
+{
+  int64_t second = -1;
+  char8_t text[DATE_TIME_SIZE + 7] = {};
+};
+
+/** Formatted id of the thread.
+ */
+struct ThreadCache
+{
+  size_t size = 0;
+  char8_t text[24] = {};
+};
+
+thread_local TimeCache time_cache;
+thread_local ThreadCache thread_cache;
+
+inline char8_t*
+write_pair(char8_t* out, uint32_t x)
+{
+  memcpy(out, DIGIT_TABLE + x * 2, 2);
+  return out + 2;
+}
+
+void
+format_date_time(int64_t second, char8_t* out)
+{
+  const time_t t = second;
+  tm date;
+  gmtime_r(&t, &date);
+  const uint32_t year = date.tm_year + 1900;
+  out = write_pair(out, year / 100 % 100);
+  out = write_pair(out, year % 100);
+  *out++ = u8'-';
+  out = write_pair(out, date.tm_mon + 1);
+  *out++ = u8'-';
+  out = write_pair(out, date.tm_mday);
+  *out++ = u8'T';
+  out = write_pair(out, date.tm_hour);
+  *out++ = u8':';
+  out = write_pair(out, date.tm_min);
+  *out++ = u8':';
+  out = write_pair(out, date.tm_sec);
+  *out = u8'.';
+}
+
+size_t
+write_time(char8_t* out)
+{
+  const int64_t ns = Clock::now();
+  const int64_t second = ns / NS_PER_SECOND;
+  TimeCache& cache = time_cache;
+  if (second != cache.second) {
+    format_date_time(second, cache.text);
+    cache.second = second;
+  }
+  const auto us = static_cast<uint32_t>(ns % NS_PER_SECOND / 1000);
+  char8_t* fraction = cache.text + DATE_TIME_SIZE;
+  fraction = write_pair(fraction, us / 10000);
+  fraction = write_pair(fraction, us / 100 % 100);
+  fraction = write_pair(fraction, us % 100);
+  *fraction = u8' ';
+  memcpy(out, cache.text, sizeof(cache.text));
+  return sizeof(cache.text);
+}
+
+size_t
+write_thread(char8_t* out)
+{
+  ThreadCache& cache = thread_cache;
+  if (cache.size == 0) {
+    const auto id = static_cast<uint64_t>(syscall(SYS_gettid));
+    cache.size = utoa(id, cache.text);
+    cache.text[cache.size++] = u8' ';
+  }
+  memcpy(out, cache.text, cache.size);
+  return cache.size;
+}
+}
+
+size_t
+Prefix::write(LEVEL level, char8_t* out) const
+{
+  const eastl::u8string_view tag = IPipe::linePrefix(level);
+  memcpy(out, tag.data(), tag.size());
+  size_t size = tag.size();
+  if (time) {
+    size += write_time(out + size);
+  }
+  if (thread) {
+    size += write_thread(out + size);
+  }
+  return size;
+}
+
+}
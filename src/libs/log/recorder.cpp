@@ -0,0 +1,195 @@
+/* extend - expansible programming language
+ * Copyright (C) 2022 Vladimir Liutov vs@lutov.net
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "recorder.h"
+
+#include <EASTL/algorithm.h>
+
+#include "posix.h"
+
+namespace extend::log {
+
+namespace {
+// Live recorders for crash handlers, which cannot take locks
+constexpr size_t MAX_RECORDERS = 16;
+eastl::atomic<FlightRecorderPipe*> live_recorders[MAX_RECORDERS];
+
+CrashChain crash_chain;
+
+void
+on_crash(int signal, siginfo_t* info, void* context)
+{
+  // SIGTERM handled by the application may not end the process, the lines
+  // are dumped only when it does
+  if (signal != SIGTERM || !crash_chain.handled(signal)) {
+    for (auto& recorder : live_recorders) {
+      if (FlightRecorderPipe* r = recorder.load(eastl::memory_order_acquire)) {
+        r->dump();
+      }
+    }
+  }
+  crash_chain.chain(signal, info, context);
+}
+
+void
+add_live(FlightRecorderPipe* pipe)
+{
+  for (auto& recorder : live_recorders) {
+    FlightRecorderPipe* expected = nullptr;
+    if (recorder.compare_exchange_strong(expected, pipe)) {
+      break;
+    }
+  }
+}
+
+}
+
+FlightRecorderPipe::FlightRecorderPipe(size_t capacity, int f)
+  : fd(f)
+  , sink_level(LEVEL::FATAL)
+  , sink(nullptr)
+  , mask(ceil_pow2(capacity) - 1)
+  , slots(eastl::make_unique<Slot[]>(mask + 1))
+{
+  add_live(this);
+}
+
+FlightRecorderPipe::FlightRecorderPipe(IPipe& s,
+                                       LEVEL level,
+                                       size_t capacity,
+                                       int f)
+  : fd(f)
+  , sink_level(level)
+  , sink(&s)
+  , mask(ceil_pow2(capacity) - 1)
+  , slots(eastl::make_unique<Slot[]>(mask + 1))
+{
+  add_live(this);
+}
+
+FlightRecorderPipe::~FlightRecorderPipe()
+{
+  for (auto& recorder : live_recorders) {
+    FlightRecorderPipe* expected = this;
+    if (recorder.compare_exchange_strong(expected, nullptr)) {
+      break;
+    }
+  }
+}
+
+void
+FlightRecorderPipe::log(LEVEL level, eastl::u8string_view str)
+{
+  const uint64_t position = head.fetch_add(1, eastl::memory_order_relaxed);
+  Slot& slot = slots[position & mask];
+  // Claim the slot unless another thread writes it or wrote a newer line
+  uint64_t sequence = slot.sequence.load(eastl::memory_order_relaxed);
+  bool claimed = false;
+  while ((sequence & 1) == 0 && sequence <= position * 2 &&
+         !(claimed = slot.sequence.compare_exchange_weak(
+             sequence, position * 2 + 1, eastl::memory_order_relaxed))) {
+  }
+  if (claimed) {
+    eastl::atomic_thread_fence(eastl::memory_order_release);
+    const size_t size = eastl::min(str.size(), WORDS * sizeof(uint64_t));
+    slot.info.store(size | static_cast<uint64_t>(level) << 32 |
+                      static_cast<uint64_t>(size < str.size()) << 40,
+                    eastl::memory_order_relaxed);
+    const size_t whole = size / sizeof(uint64_t);
+    for (size_t i = 0; i < whole; ++i) {
+      uint64_t word;
+      memcpy(&word, str.data() + i * sizeof(uint64_t), sizeof(word));
+      slot.words[i].store(word, eastl::memory_order_relaxed);
+    }
+    if (const size_t rest = size % sizeof(uint64_t); rest != 0) {
+      uint64_t word = 0;
+      memcpy(&word, str.data() + whole * sizeof(uint64_t), rest);
+      slot.words[whole].store(word, eastl::memory_order_relaxed);
+    }
+    slot.sequence.store(position * 2 + 2, eastl::memory_order_release);
+  }
+
+  if (sink != nullptr && level >= sink_level) {
+    sink->log(level, str);
+  }
+  if (level == LEVEL::FATAL) {
+    if (sink != nullptr) {
+      sink->flush();
+    }
+    dump();
+  }
+}
+
+void
+FlightRecorderPipe::flush()
+{
+  if (sink != nullptr) {
+    sink->flush();
+  }
+}
+
+FORMAT
+FlightRecorderPipe::format() const
+{
+  return sink != nullptr ? sink->format() : FORMAT::TEXT;
+}
+
+void
+FlightRecorderPipe::dump()
+{
+  const uint64_t end = head.load(eastl::memory_order_acquire);
+  const uint64_t begin = end - eastl::min<uint64_t>(end, mask + 1);
+  for (uint64_t position = begin; position < end; ++position) {
+    const Slot& slot = slots[position & mask];
+    const uint64_t sequence = position * 2 + 2;
+    if (slot.sequence.load(eastl::memory_order_acquire) != sequence) {
+      continue;
+    }
+    // Copy the line and check it was not overwritten meanwhile
+    const uint64_t info = slot.info.load(eastl::memory_order_relaxed);
+    const size_t size =
+      eastl::min<size_t>(info & UINT32_MAX, WORDS * sizeof(uint64_t));
+    uint64_t words[WORDS];
+    for (size_t i = 0; i * sizeof(uint64_t) < size; ++i) {
+      words[i] = slot.words[i].load(eastl::memory_order_relaxed);
+    }
+    eastl::atomic_thread_fence(eastl::memory_order_acquire);
+    if (slot.sequence.load(eastl::memory_order_relaxed) != sequence) {
+      continue;
+    }
+
+    const eastl::u8string_view tag =
+      linePrefix(static_cast<LEVEL>((info >> 32) & 0xff));
+    const bool cut = (info >> 40) != 0;
+    char8_t newline = u8'\n';
+    iovec iov[] = {
+      { const_cast<char8_t*>(tag.data()), tag.size() },
+      { words, size },
+      { const_cast<char8_t*>(TRUNCATED.data()), cut ? TRUNCATED.size() : 0 },
+      { &newline, 1 }
+    };
+    write_all(fd, iov, 4);
+  }
+}
+
+void
+FlightRecorderPipe::install_crash_handlers()
+{
+  crash_chain.install(on_crash);
+}
+
+}
@@ -0,0 +1,108 @@
+/* extend - expansible programming language
+ * Copyright (C) 2022 Vladimir Liutov vs@lutov.net
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <EASTL/atomic.h>
+#include <EASTL/unique_ptr.h>
+#include <unistd.h>
+
+#include "log.h"
+
+namespace extend::log {
+
+/** Keep the last lines of every level in memory and dump them on crash.
+ *
+ * A line is copied into the next slot of a fixed ring, claimed with one
+ * atomic increment, there is no lock and no syscall. A line whose slot is
+ * still written by a thread a whole ring behind is not recorded. Lines
+ * longer than the slot are cut and end with TRUNCATED in the dump. Lines at
+ * or above the sink level are passed to the sink, so
+ * with set_level(LEVEL::DEBUG) the recorder keeps DEBUG lines the sink never
+ * gets. Recorded lines are dumped to the file descriptor with write calls
+ * at FATAL and by install_crash_handlers() on fatal signals.
+ */
+struct FlightRecorderPipe : IPipe
+{
+  static constexpr size_t DEFAULT_CAPACITY = 4096;
+  /** Size of a slot, including the header. */
+  static constexpr size_t SLOT_SIZE = 256;
+  /** Written after a cut line. */
+  static constexpr eastl::u8string_view TRUNCATED = u8"...";
+
+  /** @param capacity Count of lines kept, rounded up to power of two.
+   *  @param fd       File descriptor to dump to, the pipe does not close it.
+   */
+  explicit FlightRecorderPipe(size_t capacity = DEFAULT_CAPACITY,
+                              int fd = STDERR_FILENO);
+
+  /** Record every line and pass lines from sink_level up to the sink.
+   *
+   * @param sink Pipe to write lines to, should outlive the recorder.
+   */
+  FlightRecorderPipe(IPipe& sink,
+                     LEVEL sink_level,
+                     size_t capacity = DEFAULT_CAPACITY,
+                     int fd = STDERR_FILENO);
+
+  virtual ~FlightRecorderPipe() override;
+
+  /** Record the line, dump the recorded lines at FATAL.
+   */
+  virtual void log(LEVEL level, eastl::u8string_view str) override;
+
+  virtual void flush() override;
+
+  virtual FORMAT format() const override;
+
+  /** Write the recorded lines, at most the capacity, async-signal-safe.
+   * Lines being overwritten during the dump are skipped.
+   */
+  void dump();
+
+  /** Dump every live recorder on fatal signals and SIGTERM, then pass the
+   * signal to the handler installed before, so install it after the other
+   * handlers, e.g. after MmapFilePipe::install_crash_handlers(). SIGTERM
+   * with a handler of the application does not dump, the process may go on.
+   */
+  static void install_crash_handlers();
+
+  const int fd;
+  const LEVEL sink_level;
+
+private:
+  static constexpr size_t WORDS = (SLOT_SIZE - 16) / sizeof(uint64_t);
+
+  /** Line copied with relaxed atomics and checked with the sequence like a
+   * seqlock, so a dump never reads a torn line.
+   */
+  struct alignas(64) Slot
+  {
+    /** Position of the line plus one, times two, odd while it is written. */
+    eastl::atomic<uint64_t> sequence{ 0 };
+    /** Size, level and whether the line was cut. */
+    eastl::atomic<uint64_t> info{ 0 };
+    eastl::atomic<uint64_t> words[WORDS];
+  };
+
+  IPipe* const sink;
+  const size_t mask;
+  eastl::unique_ptr<Slot[]> slots;
+  alignas(64) eastl::atomic<uint64_t> head{ 0 };
+};
+
+}
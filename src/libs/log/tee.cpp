@@ -0,0 +1,109 @@
+/* extend - expansible programming language
+ * Copyright (C) 2022 Vladimir Liutov vs@lutov.net
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "tee.h"
+
+#include <EASTL/algorithm.h>
+
+namespace extend::log {
+
+namespace {
+// Lines of a batch split at once, prefixes are kept on the stack
+constexpr size_t BATCH_LINES = 64;
+}
+
+TeePipe::TeePipe(eastl::span<const TeeSink> s, Prefix p)
+  : prefix(p)
+{
+  for (const TeeSink& sink : s) {
+    // Lines are formatted for the first sink
+    if (sink.pipe == nullptr || sinks.size() == MAX_SINKS ||
+        (!sinks.empty() &&
+         sink.pipe->format() != sinks.front().pipe->format())) {
+      continue;
+    }
+    sinks.push_back(sink);
+  }
+}
+
+void
+TeePipe::log(LEVEL level, eastl::u8string_view str)
+{
+  char8_t head[Prefix::MAX_SIZE];
+  const size_t head_size = prefix.write(level, head);
+  log_prefixed(level, { head, head_size }, str);
+}
+
+void
+TeePipe::log_prefixed(LEVEL level,
+                      eastl::u8string_view head,
+                      eastl::u8string_view str)
+{
+  for (const TeeSink& sink : sinks) {
+    if (level >= sink.level) {
+      sink.pipe->log_prefixed(level, head, str);
+    }
+  }
+}
+
+void
+TeePipe::log_batch(eastl::span<const Line> lines)
+{
+  char8_t heads[BATCH_LINES][Prefix::MAX_SIZE];
+  eastl::fixed_vector<Line, BATCH_LINES, false> prefixed;
+  eastl::fixed_vector<Line, BATCH_LINES, false> batch;
+  while (!lines.empty()) {
+    const size_t count = eastl::min(lines.size(), BATCH_LINES);
+    prefixed.clear();
+    for (size_t i = 0; i < count; ++i) {
+      Line line = lines[i];
+      if (line.head.empty()) {
+        line.head = { heads[i], prefix.write(line.level, heads[i]) };
+      }
+      prefixed.push_back(line);
+    }
+
+    for (const TeeSink& sink : sinks) {
+      batch.clear();
+      for (const Line& line : prefixed) {
+        if (line.level >= sink.level) {
+          batch.push_back(line);
+        }
+      }
+      if (!batch.empty()) {
+        sink.pipe->log_batch({ batch.data(), batch.size() });
+      }
+    }
+    lines = lines.subspan(count);
+  }
+}
+
+void
+TeePipe::flush()
+{
+  for (const TeeSink& sink : sinks) {
+    sink.pipe->flush();
+  }
+}
+
+FORMAT
+TeePipe::format() const
+{
+  return sinks.empty() ? FORMAT::TEXT : sinks.front().pipe->format();
+}
+
+}
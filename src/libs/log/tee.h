@@ -0,0 +1,72 @@
+/* extend - expansible programming language
+ * Copyright (C) 2022 Vladimir Liutov vs@lutov.net
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <EASTL/fixed_vector.h>
+
+#include "log.h"
+
+namespace extend::log {
+
+/** Pipe of TeePipe and the lowest level it gets.
+ */
+struct TeeSink
+{
+  IPipe* pipe = nullptr;
+  LEVEL level = LEVEL::DEBUG;
+};
+
+/** Write each line to several pipes, e.g. stderr, file and FlightRecorder.
+ *
+ * The stream formats the line once, the tee builds the prefix once and
+ * every sink gets the same prefix and line through log_prefixed(), so
+ * pipes with Prefix write the tee prefix instead of their own, and pipes
+ * without one, e.g. BufferPipe, their level tag. AsyncPipe passes the
+ * prefix on to its sink. Batches are split by the level of each sink and
+ * passed on as batches. The stream formats the line for the first sink,
+ * sinks expecting another format are skipped.
+ */
+struct TeePipe : IPipe
+{
+  static constexpr size_t MAX_SINKS = 8;
+
+  /** @param sinks  At most MAX_SINKS pipes with their levels, of the
+   *                format of the first one, the pipes should outlive the
+   *                tee.
+   *  @param prefix Fields written before each line.
+   */
+  explicit TeePipe(eastl::span<const TeeSink> sinks, Prefix prefix = {});
+
+  virtual void log(LEVEL level, eastl::u8string_view str) override;
+  virtual void log_batch(eastl::span<const Line> lines) override;
+  virtual void log_prefixed(LEVEL level,
+                            eastl::u8string_view head,
+                            eastl::u8string_view str) override;
+  virtual void flush() override;
+
+  /** Format of every sink.
+   */
+  virtual FORMAT format() const override;
+
+  const Prefix prefix;
+
+private:
+  eastl::fixed_vector<TeeSink, MAX_SINKS, false> sinks;
+};
+
+}
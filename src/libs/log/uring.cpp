@@ -0,0 +1,421 @@
+/* extend - expansible programming language
+ * Copyright (C) 2022 Vladimir Liutov vs@lutov.net
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "uring.h"
+
+#include <EASTL/algorithm.h>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace extend::log {
+
+/** Mapped submission and completion queues of io_uring.
+ */
+struct UringFilePipe::Ring
+{
+  int fd = -1;
+  void* rings = MAP_FAILED;
+  size_t rings_size = 0;
+  io_uring_sqe* sqes = static_cast<io_uring_sqe*>(MAP_FAILED);
+  size_t sqes_size = 0;
+
+  unsigned* sq_tail = nullptr;
+  unsigned* sq_mask = nullptr;
+  unsigned* sq_array = nullptr;
+  unsigned* cq_head = nullptr;
+  unsigned* cq_tail = nullptr;
+  unsigned* cq_mask = nullptr;
+  io_uring_cqe* cqes = nullptr;
+
+  ~Ring()
+  {
+    if (sqes != MAP_FAILED) {
+      munmap(sqes, sqes_size);
+    }
+    if (rings != MAP_FAILED) {
+      munmap(rings, rings_size);
+    }
+    if (fd >= 0) {
+      ::close(fd);
+    }
+  }
+
+  /** Create the ring and register buffers, false if io_uring is missing.
+   */
+  bool setup(unsigned entries, const iovec* iov, unsigned count)
+  {
+    io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    fd = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+    if (fd < 0 || (params.features & IORING_FEAT_SINGLE_MMAP) == 0) {
+      return false;
+    }
+
+    // Submission and completion rings share one mapping
+    rings_size =
+      eastl::max(params.sq_off.array + params.sq_entries * sizeof(unsigned),
+                 params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe));
+    rings = mmap(nullptr,
+                 rings_size,
+                 PROT_READ | PROT_WRITE,
+                 MAP_SHARED | MAP_POPULATE,
+                 fd,
+                 IORING_OFF_SQ_RING);
+    sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+    sqes = static_cast<io_uring_sqe*>(mmap(nullptr,
+                                           sqes_size,
+                                           PROT_READ | PROT_WRITE,
+                                           MAP_SHARED | MAP_POPULATE,
+                                           fd,
+                                           IORING_OFF_SQES));
+    if (rings == MAP_FAILED || sqes == MAP_FAILED) {
+      return false;
+    }
+
+    auto* base = static_cast<char*>(rings);
+    sq_tail = reinterpret_cast<unsigned*>(base + params.sq_off.tail);
+    sq_mask = reinterpret_cast<unsigned*>(base + params.sq_off.ring_mask);
+    sq_array = reinterpret_cast<unsigned*>(base + params.sq_off.array);
+    cq_head = reinterpret_cast<unsigned*>(base + params.cq_off.head);
+    cq_tail = reinterpret_cast<unsigned*>(base + params.cq_off.tail);
+    cq_mask = reinterpret_cast<unsigned*>(base + params.cq_off.ring_mask);
+    cqes = reinterpret_cast<io_uring_cqe*>(base + params.cq_off.cqes);
+
+    return syscall(
+             __NR_io_uring_register, fd, IORING_REGISTER_BUFFERS, iov, count) ==
+           0;
+  }
+
+  /** Queue write of registered buffer and enter the kernel once.
+   *
+   * Takes the entry back when the kernel did not consume it, so a later
+   * enter never submits it.
+   */
+  bool write(int file,
+             unsigned index,
+             const char8_t* data,
+             size_t size,
+             uint64_t offset)
+  {
+    const unsigned tail = *sq_tail;
+    const unsigned slot = tail & *sq_mask;
+    io_uring_sqe& sqe = sqes[slot];
+    memset(&sqe, 0, sizeof(sqe));
+    sqe.opcode = IORING_OP_WRITE_FIXED;
+    sqe.fd = file;
+    sqe.addr = reinterpret_cast<uint64_t>(data);
+    sqe.len = static_cast<uint32_t>(size);
+    sqe.off = offset;
+    sqe.buf_index = static_cast<uint16_t>(index);
+    sqe.user_data = index;
+    sq_array[slot] = slot;
+    __atomic_store_n(sq_tail, tail + 1, __ATOMIC_RELEASE);
+    if (enter(1, 0) == 1) {
+      return true;
+    }
+    __atomic_store_n(sq_tail, tail, __ATOMIC_RELEASE);
+    return false;
+  }
+
+  long enter(unsigned submit, unsigned wait)
+  {
+    for (;;) {
+      const long result = syscall(__NR_io_uring_enter,
+                                  fd,
+                                  submit,
+                                  wait,
+                                  wait != 0 ? IORING_ENTER_GETEVENTS : 0,
+                                  nullptr,
+                                  0);
+      if (result >= 0 || errno != EINTR) {
+        return result;
+      }
+    }
+  }
+};
+
+UringFilePipe::UringFilePipe(const char* path,
+                             size_t size,
+                             unsigned count,
+                             int64_t delay,
+                             Prefix p,
+                             bool use_uring)
+  : buffer_size(eastl::max(size, Prefix::MAX_SIZE + 1))
+  , buffer_count(count < 2 ? 2 : count)
+  , delay_ms(delay)
+  , prefix(p)
+  , buffers(new char8_t[buffer_size * buffer_count])
+  , writes(new Write[buffer_count])
+{
+  fd = ::open(path, O_WRONLY | O_CREAT | O_CLOEXEC, 0644);
+  struct stat info;
+  if (fd < 0 || fstat(fd, &info) != 0) {
+    if (fd >= 0) {
+      ::close(fd);
+      fd = -1;
+    }
+    return;
+  }
+  offset = info.st_size;
+
+  if (use_uring) {
+    eastl::unique_ptr<iovec[]> iov(new iovec[buffer_count]);
+    for (unsigned i = 0; i < buffer_count; ++i) {
+      iov[i] = { buffers.get() + i * buffer_size, buffer_size };
+    }
+    ring.reset(new Ring());
+    if (!ring->setup(buffer_count, iov.get(), buffer_count)) {
+      ring.reset();
+    }
+  }
+}
+
+UringFilePipe::~UringFilePipe()
+{
+  flush();
+  ring.reset();
+  if (fd >= 0) {
+    ::close(fd);
+  }
+}
+
+void
+UringFilePipe::log(LEVEL level, eastl::u8string_view str)
+{
+  char8_t head[Prefix::MAX_SIZE];
+  const size_t head_size = prefix.write(level, head);
+  log_prefixed(level, { head, head_size }, str);
+}
+
+void
+UringFilePipe::log_prefixed(LEVEL level,
+                            eastl::u8string_view head,
+                            eastl::u8string_view str)
+{
+  EA::Thread::AutoFutex guard(lock);
+  if (fd < 0) {
+    return;
+  }
+  if (used != 0 && EA::Thread::GetThreadTime() >= deadline) {
+    submit();
+  }
+  if (lost.load(eastl::memory_order_relaxed) != reported) {
+    if (!next_buffer()) {
+      lost.fetch_add(1, eastl::memory_order_relaxed);
+      return;
+    }
+    const uint64_t count = lost.load(eastl::memory_order_relaxed) - reported;
+    reported += count;
+    OStreamFactory factory(LEVEL::WARNING, *this, report_channel);
+    factory << u8"UringFilePipe dropped " << count << u8" lines";
+  }
+  append(head, str);
+  if (level >= LEVEL::ERROR) {
+    submit();
+  }
+}
+
+void
+UringFilePipe::flush()
+{
+  EA::Thread::AutoFutex guard(lock);
+  if (fd < 0) {
+    return;
+  }
+  submit();
+  drain();
+}
+
+bool
+UringFilePipe::is_open() const
+{
+  return fd >= 0;
+}
+
+bool
+UringFilePipe::uses_uring() const
+{
+  return ring != nullptr;
+}
+
+uint64_t
+UringFilePipe::dropped() const
+{
+  return lost.load(eastl::memory_order_relaxed);
+}
+
+void
+UringFilePipe::append(eastl::u8string_view head, eastl::u8string_view str)
+{
+  const size_t size = head.size() + str.size() + 1;
+  if (used + size > buffer_size) {
+    submit();
+  }
+  if (used == 0) {
+    if (!next_buffer()) {
+      lost.fetch_add(1, eastl::memory_order_relaxed);
+      return;
+    }
+    deadline = EA::Thread::GetThreadTime() + delay_ms;
+  }
+  if (size > buffer_size) {
+    // Longer than a buffer, the rest of the line cannot be dropped once a
+    // part is submitted, so wait for the next buffers
+    copy(head);
+    copy(str);
+    copy(u8"\n");
+    return;
+  }
+
+  char8_t* out = buffers.get() + current * buffer_size + used;
+  memcpy(out, head.data(), head.size());
+  memcpy(out + head.size(), str.data(), str.size());
+  out[size - 1] = u8'\n';
+  used += size;
+}
+
+bool
+UringFilePipe::next_buffer()
+{
+  if (used != 0) {
+    return true;
+  }
+  if (writes[current].busy) {
+    reap(0);
+  }
+  return !writes[current].busy;
+}
+
+void
+UringFilePipe::copy(eastl::u8string_view str)
+{
+  while (!str.empty()) {
+    if (used == buffer_size) {
+      submit();
+      while (writes[current].busy) {
+        reap(1);
+      }
+    }
+    const size_t part = eastl::min(str.size(), buffer_size - used);
+    memcpy(buffers.get() + current * buffer_size + used, str.data(), part);
+    used += part;
+    str.remove_prefix(part);
+  }
+}
+
+void
+UringFilePipe::submit()
+{
+  if (used == 0) {
+    return;
+  }
+  const char8_t* data = buffers.get() + current * buffer_size;
+  if (ring != nullptr && ring->write(fd, current, data, used, offset)) {
+    writes[current] = { true, 0, used, offset };
+    ++in_flight;
+  } else {
+    if (ring != nullptr) {
+      // The ring is broken, finish writes in flight and never use it again
+      drain();
+      ring.reset();
+    }
+    write_at(data, used, offset);
+  }
+  offset += used;
+  used = 0;
+  current = (current + 1) % buffer_count;
+}
+
+void
+UringFilePipe::reap(unsigned wait)
+{
+  if (ring == nullptr || in_flight == 0) {
+    return;
+  }
+  if (wait != 0) {
+    ring->enter(0, wait);
+  }
+
+  bool broken = false;
+  unsigned head = *ring->cq_head;
+  const unsigned tail = __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE);
+  for (; head != tail; ++head) {
+    const io_uring_cqe& cqe = ring->cqes[head & *ring->cq_mask];
+    const auto index = static_cast<unsigned>(cqe.user_data);
+    Write& done = writes[index];
+    const size_t written =
+      cqe.res < 0 ? 0 : eastl::min(static_cast<size_t>(cqe.res), done.size);
+    done.start += written;
+    done.size -= written;
+    done.offset += written;
+    if (done.size != 0) {
+      // Rest of a short write goes through the ring again, of a failed one
+      // with pwrite
+      const char8_t* rest = buffers.get() + index * buffer_size + done.start;
+      if (written != 0 && !broken) {
+        if (ring->write(fd, index, rest, done.size, done.offset)) {
+          continue;
+        }
+        broken = true;
+      }
+      write_at(rest, done.size, done.offset);
+    }
+    done.busy = false;
+    --in_flight;
+  }
+  __atomic_store_n(ring->cq_head, head, __ATOMIC_RELEASE);
+  if (broken) {
+    // The ring is broken as in submit(), finish writes in flight and never
+    // use it again
+    drain();
+    ring.reset();
+  }
+}
+
+void
+UringFilePipe::drain()
+{
+  while (ring != nullptr && in_flight != 0) {
+    reap(in_flight);
+  }
+}
+
+void
+UringFilePipe::write_at(const char8_t* data, size_t size, uint64_t at)
+{
+  while (size != 0) {
+    const ssize_t written = ::pwrite(fd, data, size, at);
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return;
+    }
+    data += written;
+    size -= written;
+    at += written;
+  }
+}
+
+}
@@ -0,0 +1,133 @@
+/* extend - expansible programming language
+ * Copyright (C) 2022 Vladimir Liutov vs@lutov.net
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <EASTL/atomic.h>
+#include <EASTL/fixed_string.h>
+#include <EASTL/unique_ptr.h>
+#include <eathread/eathread.h>
+#include <eathread/eathread_futex.h>
+
+#include "log.h"
+
+namespace extend::log {
+
+/** Write logs to file with io_uring.
+ *
+ * Lines are copied into one of the buffers registered with the ring. A full
+ * buffer is submitted as a single write and the next free one is used, so
+ * the logging thread does not wait for the disk. Completions are reaped in
+ * batches when a buffer is needed. If every buffer is in flight the line is
+ * dropped, the count is written with the next line as a warning regardless
+ * of set_level. Lines longer than a buffer span several, waiting for writes
+ * in flight instead. The rest of a short write is submitted again. Buffered
+ * lines are submitted when the oldest one is older than the delay, on
+ * flush() and right away at ERROR and FATAL.
+ *
+ * Without io_uring, e.g. on old kernels or under seccomp, full buffers are
+ * written with pwrite.
+ */
+struct UringFilePipe : IPipe
+{
+  static constexpr size_t DEFAULT_BUFFER_SIZE = 64 << 10;
+  static constexpr unsigned DEFAULT_BUFFER_COUNT = 8;
+  static constexpr int64_t DEFAULT_DELAY_MS = 100;
+
+  /** Open the file and append to it.
+   *
+   * @param path         File path.
+   * @param buffer_size  Size of one write.
+   * @param buffer_count Count of buffers, writes in flight at most.
+   * @param delay_ms     How long a line may wait in the buffer.
+   * @param prefix       Fields written before each line.
+   * @param use_uring    False to write with pwrite.
+   */
+  explicit UringFilePipe(const char* path,
+                         size_t buffer_size = DEFAULT_BUFFER_SIZE,
+                         unsigned buffer_count = DEFAULT_BUFFER_COUNT,
+                         int64_t delay_ms = DEFAULT_DELAY_MS,
+                         Prefix prefix = {},
+                         bool use_uring = true);
+
+  /** Write buffered lines and wait for them.
+   */
+  virtual ~UringFilePipe() override;
+
+  virtual void log(LEVEL level, eastl::u8string_view str) override;
+
+  virtual void log_prefixed(LEVEL level,
+                            eastl::u8string_view head,
+                            eastl::u8string_view str) override;
+
+  /** Submit buffered lines and wait until everything is written.
+   */
+  virtual void flush() override;
+
+  /** False if the file cannot be opened, lines are dropped.
+   */
+  bool is_open() const;
+
+  /** False if writes fall back to pwrite.
+   */
+  bool uses_uring() const;
+
+  /** Count of lines lost because every buffer was in flight.
+   */
+  uint64_t dropped() const;
+
+  const size_t buffer_size;
+  const unsigned buffer_count;
+  const int64_t delay_ms;
+  const Prefix prefix;
+
+private:
+  struct Ring;
+
+  /** Write of a buffer in flight.
+   */
+  struct Write
+  {
+    bool busy = false;
+    size_t start = 0;
+    size_t size = 0;
+    uint64_t offset = 0;
+  };
+
+  void append(eastl::u8string_view head, eastl::u8string_view str);
+  void copy(eastl::u8string_view str);
+  bool next_buffer();
+  void submit();
+  void reap(unsigned wait);
+  void drain();
+  void write_at(const char8_t* data, size_t size, uint64_t offset);
+
+  EA::Thread::Futex lock;
+  int fd = -1;
+  uint64_t offset = 0;
+  eastl::unique_ptr<char8_t[]> buffers;
+  eastl::unique_ptr<Write[]> writes;
+  unsigned current = 0;
+  size_t used = 0;
+  unsigned in_flight = 0;
+  EA::Thread::ThreadTime deadline{};
+  eastl::atomic<uint64_t> lost{ 0 };
+  uint64_t reported = 0;
+  eastl::unique_ptr<Ring> ring;
+};
+
+}
@@ -0,0 +1,378 @@
+/* extend - expansible programming language
+ * Copyright (C) 2022 Vladimir Liutov vs@lutov.net
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "utf.h"
+
+#include <EASTL/algorithm.h>
+#include <EASTL/atomic.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define EXTEND_LOG_UTF_SIMD 1
+#else
+#define EXTEND_LOG_UTF_SIMD 0
+#endif
+
+namespace extend::log {
+
+namespace {
+constexpr char32_t SURROGATE_HIGH = 0xD800;
+constexpr char32_t SURROGATE_LOW = 0xDC00;
+constexpr char32_t SURROGATE_END = 0xE000;
+constexpr char32_t MAX_CODE_POINT = 0x10FFFF;
+constexpr char32_t REPLACEMENT = 0xFFFD;
+
+// Code units left when SIMD loops stop, enough room for any block store,
+// shorter strings skip the dispatch
+constexpr ptrdiff_t SIMD_MIN = 16;
+
+char8_t*
+encode(char32_t c, char8_t* out)
+{
+  if (c < 0x80) {
+    *out++ = static_cast<char8_t>(c);
+  } else if (c < 0x800) {
+    out[0] = static_cast<char8_t>(0xC0 | (c >> 6));
+    out[1] = static_cast<char8_t>(0x80 | (c & 0x3F));
+    out += 2;
+  } else if (c < 0x10000) {
+    out[0] = static_cast<char8_t>(0xE0 | (c >> 12));
+    out[1] = static_cast<char8_t>(0x80 | ((c >> 6) & 0x3F));
+    out[2] = static_cast<char8_t>(0x80 | (c & 0x3F));
+    out += 3;
+  } else {
+    out[0] = static_cast<char8_t>(0xF0 | (c >> 18));
+    out[1] = static_cast<char8_t>(0x80 | ((c >> 12) & 0x3F));
+    out[2] = static_cast<char8_t>(0x80 | ((c >> 6) & 0x3F));
+    out[3] = static_cast<char8_t>(0x80 | (c & 0x3F));
+    out += 4;
+  }
+  return out;
+}
+
+/** Convert code units before the limit, a pair may end past it.
+ * False at an unpaired surrogate, src is left at it.
+ */
+bool
+scalar(const char16_t*& src,
+       const char16_t* limit,
+       const char16_t* end,
+       char8_t*& out)
+{
+  while (src < limit) {
+    char32_t c = *src;
+    if (c >= SURROGATE_HIGH && c < SURROGATE_END) {
+      if (c >= SURROGATE_LOW || src + 1 == end || src[1] < SURROGATE_LOW ||
+          src[1] >= SURROGATE_END) {
+        return false;
+      }
+      c = 0x10000 + ((c - SURROGATE_HIGH) << 10) + (src[1] - SURROGATE_LOW);
+      ++src;
+    }
+    out = encode(c, out);
+    ++src;
+  }
+  return true;
+}
+
+/** Convert code units before the limit, false at a surrogate.
+ */
+bool
+scalar(const char32_t*& src,
+       const char32_t* limit,
+       char8_t*& out,
+       bool& valid)
+{
+  for (; src < limit; ++src) {
+    char32_t c = *src;
+    if (c >= SURROGATE_HIGH && c < SURROGATE_END) {
+      return false;
+    }
+    if (c > MAX_CODE_POINT) {
+      c = REPLACEMENT;
+      valid = false;
+    }
+    out = encode(c, out);
+  }
+  return true;
+}
+
+UTF_PATH
+cpu_path()
+{
+#if EXTEND_LOG_UTF_SIMD
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) {
+    return UTF_PATH::AVX2;
+  }
+  if (__builtin_cpu_supports("sse4.1")) {
+    return UTF_PATH::SSE41;
+  }
+#endif
+  return UTF_PATH::SCALAR;
+}
+
+const UTF_PATH best_path = cpu_path();
+
+// Scalar until initialized, for static constructors of other files
+eastl::atomic<UTF_PATH> current_path{ best_path };
+
+#if EXTEND_LOG_UTF_SIMD
+__attribute__((target("sse4.1"))) inline __m128i
+splat(uint16_t x)
+{
+  return _mm_set1_epi16(static_cast<int16_t>(x));
+}
+
+__attribute__((target("sse4.1"))) inline bool
+all_above(__m128i v, uint16_t min)
+{
+  const __m128i ge = _mm_cmpeq_epi16(_mm_max_epu16(v, splat(min)), v);
+  return _mm_movemask_epi8(ge) == 0xFFFF;
+}
+
+/** Write 8 UTF-16 code units of the same UTF-8 length, 28 bytes at most
+ * are stored. False if the lengths are mixed or there are surrogates.
+ */
+__attribute__((target("sse4.1"))) inline bool
+block8(__m128i v, char8_t*& out)
+{
+  if (_mm_testz_si128(v, splat(0xFF80))) {
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(out), _mm_packus_epi16(v, v));
+    out += 8;
+    return true;
+  }
+  if (!all_above(v, 0x80)) {
+    return false;
+  }
+  const __m128i tail = _mm_or_si128(_mm_and_si128(v, splat(0x3F)), splat(0x80));
+  if (_mm_testz_si128(v, splat(0xF800))) {
+    const __m128i lead = _mm_or_si128(_mm_srli_epi16(v, 6), splat(0xC0));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out),
+                     _mm_or_si128(lead, _mm_slli_epi16(tail, 8)));
+    out += 16;
+    return true;
+  }
+  const __m128i surrogates =
+    _mm_cmpeq_epi16(_mm_and_si128(v, splat(0xF800)), splat(0xD800));
+  if (!all_above(v, 0x800) || !_mm_testz_si128(surrogates, surrogates)) {
+    return false;
+  }
+  const __m128i lead = _mm_or_si128(_mm_srli_epi16(v, 12), splat(0xE0));
+  const __m128i middle = _mm_or_si128(
+    _mm_and_si128(_mm_srli_epi16(v, 6), splat(0x3F)), splat(0x80));
+  const __m128i head = _mm_or_si128(lead, _mm_slli_epi16(middle, 8));
+  // Lanes of lead, middle, tail and zero, drop the zeros
+  const __m128i pack =
+    _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(out),
+                   _mm_shuffle_epi8(_mm_unpacklo_epi16(head, tail), pack));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 12),
+                   _mm_shuffle_epi8(_mm_unpackhi_epi16(head, tail), pack));
+  out += 24;
+  return true;
+}
+
+/** Write 16 UTF-16 code units, if all of them are ASCII or all are two
+ * bytes long.
+ */
+__attribute__((target("avx2"))) inline bool
+block16(__m256i v, char8_t*& out)
+{
+  const __m256i ascii = _mm256_set1_epi16(static_cast<int16_t>(0xFF80));
+  if (_mm256_testz_si256(v, ascii)) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out),
+                     _mm_packus_epi16(_mm256_castsi256_si128(v),
+                                      _mm256_extracti128_si256(v, 1)));
+    out += 16;
+    return true;
+  }
+  const __m256i low = _mm256_set1_epi16(0x80);
+  const __m256i ge = _mm256_cmpeq_epi16(_mm256_max_epu16(v, low), v);
+  const __m256i two = _mm256_set1_epi16(static_cast<int16_t>(0xF800));
+  if (_mm256_movemask_epi8(ge) != -1 || !_mm256_testz_si256(v, two)) {
+    return false;
+  }
+  const __m256i lead =
+    _mm256_or_si256(_mm256_srli_epi16(v, 6), _mm256_set1_epi16(0xC0));
+  const __m256i tail = _mm256_or_si256(
+    _mm256_and_si256(v, _mm256_set1_epi16(0x3F)), _mm256_set1_epi16(0x80));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out),
+                      _mm256_or_si256(lead, _mm256_slli_epi16(tail, 8)));
+  out += 32;
+  return true;
+}
+
+__attribute__((target("sse4.1"))) bool
+convert_sse41(const char16_t*& src, const char16_t* end, char8_t*& out)
+{
+  while (end - src >= SIMD_MIN) {
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    if (block8(v, out)) {
+      src += 8;
+    } else if (!scalar(src, src + 8, end, out)) {
+      return false;
+    }
+  }
+  return scalar(src, end, end, out);
+}
+
+__attribute__((target("avx2"))) bool
+convert_avx2(const char16_t*& src, const char16_t* end, char8_t*& out)
+{
+  while (end - src >= SIMD_MIN) {
+    const __m256i v =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+    if (block16(v, out)) {
+      src += 16;
+    } else if (block8(_mm256_castsi256_si128(v), out)) {
+      src += 8;
+    } else if (!scalar(src, src + 8, end, out)) {
+      return false;
+    }
+  }
+  return scalar(src, end, end, out);
+}
+
+// UTF-32 blocks are narrowed to UTF-16 if all code points are in the BMP
+__attribute__((target("sse4.1"))) bool
+convert_sse41(const char32_t*& src,
+              const char32_t* end,
+              char8_t*& out,
+              bool& valid)
+{
+  const __m128i bmp = _mm_set1_epi32(static_cast<int32_t>(0xFFFF0000));
+  while (end - src >= SIMD_MIN) {
+    const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    const __m128i b =
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 4));
+    if (_mm_testz_si128(_mm_or_si128(a, b), bmp) &&
+        block8(_mm_packus_epi32(a, b), out)) {
+      src += 8;
+    } else if (!scalar(src, src + 8, out, valid)) {
+      return false;
+    }
+  }
+  return scalar(src, end, out, valid);
+}
+
+__attribute__((target("avx2"))) bool
+convert_avx2(const char32_t*& src,
+             const char32_t* end,
+             char8_t*& out,
+             bool& valid)
+{
+  const __m256i bmp = _mm256_set1_epi32(static_cast<int32_t>(0xFFFF0000));
+  while (end - src >= SIMD_MIN) {
+    const __m256i a =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+    const __m256i b =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 8));
+    if (!_mm256_testz_si256(a, bmp)) {
+      if (!scalar(src, src + 8, out, valid)) {
+        return false;
+      }
+      continue;
+    }
+    if (_mm256_testz_si256(b, bmp)) {
+      // Pack works within 128-bit lanes, put the quarters back in order
+      const __m256i v =
+        _mm256_permute4x64_epi64(_mm256_packus_epi32(a, b), 0xD8);
+      if (block16(v, out)) {
+        src += 16;
+        continue;
+      }
+    }
+    const __m128i v = _mm_packus_epi32(_mm256_castsi256_si128(a),
+                                       _mm256_extracti128_si256(a, 1));
+    if (block8(v, out)) {
+      src += 8;
+    } else if (!scalar(src, src + 8, out, valid)) {
+      return false;
+    }
+  }
+  return scalar(src, end, out, valid);
+}
+#endif
+
+/** Convert with the current path, out of line, so short strings skip the
+ * frame of SIMD loops.
+ */
+__attribute__((noinline)) bool
+convert(const char16_t*& src, const char16_t* end, char8_t*& out)
+{
+#if EXTEND_LOG_UTF_SIMD
+  switch (current_path.load(eastl::memory_order_relaxed)) {
+    case UTF_PATH::AVX2:
+      return convert_avx2(src, end, out);
+    case UTF_PATH::SSE41:
+      return convert_sse41(src, end, out);
+    case UTF_PATH::SCALAR:
+      break;
+  }
+#endif
+  return scalar(src, end, end, out);
+}
+
+__attribute__((noinline)) bool
+convert(const char32_t*& src, const char32_t* end, char8_t*& out, bool& valid)
+{
+#if EXTEND_LOG_UTF_SIMD
+  switch (current_path.load(eastl::memory_order_relaxed)) {
+    case UTF_PATH::AVX2:
+      return convert_avx2(src, end, out, valid);
+    case UTF_PATH::SSE41:
+      return convert_sse41(src, end, out, valid);
+    case UTF_PATH::SCALAR:
+      break;
+  }
+#endif
+  return scalar(src, end, out, valid);
+}
+}
+
+UTF_PATH
+set_utf_path(UTF_PATH path)
+{
+  const UTF_PATH used = eastl::min(path, best_path);
+  current_path.store(used, eastl::memory_order_relaxed);
+  return used;
+}
+
+Transcoded
+utf16_to_utf8(eastl::u16string_view str, char8_t* buffer)
+{
+  const char16_t* src = str.data();
+  const char16_t* end = src + str.size();
+  char8_t* out = buffer;
+  const bool valid = end - src < SIMD_MIN ? scalar(src, end, end, out)
+                                          : convert(src, end, out);
+  return { static_cast<size_t>(out - buffer), valid };
+}
+
+Transcoded
+utf32_to_utf8(eastl::u32string_view str, char8_t* buffer)
+{
+  const char32_t* src = str.data();
+  const char32_t* end = src + str.size();
+  char8_t* out = buffer;
+  bool valid = true;
+  const bool complete = end - src < SIMD_MIN ? scalar(src, end, out, valid)
+                                             : convert(src, end, out, valid);
+  return { static_cast<size_t>(out - buffer), complete && valid };
+}
+}
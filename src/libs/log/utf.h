@@ -0,0 +1,79 @@
+/* extend - expansible programming language
+ * Copyright (C) 2022 Vladimir Liutov vs@lutov.net
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <EASTL/string_view.h>
+#include <cstddef>
+
+namespace extend::log {
+
+/** Bytes of UTF-8 per UTF-16 and UTF-32 code unit at most.
+ */
+constexpr size_t UTF8_PER_UTF16 = 3;
+constexpr size_t UTF8_PER_UTF32 = 4;
+
+/** Instruction sets of utf16_to_utf8 and utf32_to_utf8.
+ */
+enum struct UTF_PATH
+{
+  SCALAR,
+  SSE41,
+  AVX2
+};
+
+/** Use the instruction set at most, for tests and benchmarks of each path.
+ * The best one of the CPU is used by default.
+ *
+ * @return Instruction set in use, lower if the CPU lacks the given one.
+ */
+UTF_PATH
+set_utf_path(UTF_PATH path);
+
+/** Result of utf16_to_utf8 and utf32_to_utf8.
+ */
+struct Transcoded
+{
+  /** Count of written bytes. */
+  size_t size;
+  /** False if the string has invalid code units. */
+  bool valid;
+};
+
+/** Write UTF-16 string as UTF-8, the same way strict conversion of LLVM
+ * does: the output stops before the first unpaired surrogate.
+ *
+ * Runs of ASCII and of BMP characters of the same length are converted by
+ * SSE4.1 or AVX2 blocks, if the CPU has them, short strings by a scalar
+ * loop.
+ *
+ * @param  str    UTF-16 string.
+ * @param  buffer Should be at least UTF8_PER_UTF16 bytes per code unit.
+ */
+Transcoded
+utf16_to_utf8(eastl::u16string_view str, char8_t* buffer);
+
+/** Write UTF-32 string as UTF-8, the same way strict conversion of LLVM
+ * does: the output stops before the first surrogate, code points above
+ * U+10FFFF are written as U+FFFD.
+ *
+ * @param  str    UTF-32 string.
+ * @param  buffer Should be at least UTF8_PER_UTF32 bytes per code unit.
+ */
+Transcoded
+utf32_to_utf8(eastl::u32string_view str, char8_t* buffer);
+}
@@ -0,0 +1,216 @@
+/* extend - expansible programming language
+ * Copyright (C) 2022 Vladimir Liutov vs@lutov.net
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/** Engine of write_join, header only with no library behind it, so code
+ * outside the log library formats arrays with it too.
+ *
+ * Integers are converted by blocks of 8 digits with the SSE2 method of
+ * Wojciech Muła: the value is split into two halves of 4 digits, each half
+ * is broadcast to 4 lanes, divided by 1000, 100, 10 and 1 with multiplies
+ * and the higher digits are subtracted. Two blocks are packed to 16 bytes
+ * and the leading zeros are shuffled out, so a number of up to 16 digits is
+ * written with one store.
+ */
+
+#pragma once
+
+#include <EASTL/type_traits.h>
+#include <cstring>
+
+#include "join.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define EXTEND_LOG_JOIN_SIMD 1
+#else
+#define EXTEND_LOG_JOIN_SIMD 0
+#endif
+
+namespace extend::log {
+
+/** Separators up to this size are copied by one fixed size store. */
+constexpr size_t JOIN_SHORT_SEPARATOR = 8;
+static_assert(JOIN_SHORT_SEPARATOR <= JOIN_SLACK);
+
+/** Format elements separated by the separator, WRITE formats one element
+ * and returns its size.
+ */
+template<typename T, int (*WRITE)(T, char8_t*)>
+inline size_t
+join_elements(const Join<T>& j, char8_t* buffer)
+{
+  const eastl::span<const T> values = j.values;
+  const eastl::u8string_view separator = j.separator;
+  if (values.empty()) {
+    return 0;
+  }
+  char8_t* out = buffer + WRITE(values[0], buffer);
+  if (separator.size() <= JOIN_SHORT_SEPARATOR) {
+    char8_t word[JOIN_SHORT_SEPARATOR] = {};
+    memcpy(word, separator.data(), separator.size());
+    for (size_t i = 1; i < values.size(); ++i) {
+      memcpy(out, word, JOIN_SHORT_SEPARATOR);
+      out += separator.size();
+      out += WRITE(values[i], out);
+    }
+  } else {
+    for (size_t i = 1; i < values.size(); ++i) {
+      memcpy(out, separator.data(), separator.size());
+      out += separator.size();
+      out += WRITE(values[i], out);
+    }
+  }
+  return out - buffer;
+}
+
+#if EXTEND_LOG_JOIN_SIMD
+inline const bool join_has_sse41 = [] {
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("sse4.1") != 0;
+}();
+
+/** Shuffle indices that drop the first n bytes, read from n. */
+alignas(32) inline constexpr int8_t JOIN_SKIP[32] = {
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/** 8 decimal digits of x < 10^8 in 16-bit lanes, the highest first. */
+__attribute__((target("sse4.1"))) inline __m128i
+join_digits8(uint32_t x)
+{
+  // abcd = x / 10000 as multiply by 2^45 / 10000 rounded up
+  const __m128i abcdefgh = _mm_cvtsi32_si128(static_cast<int>(x));
+  const __m128i div10000 = _mm_set1_epi32(static_cast<int>(0xD1B71759));
+  const __m128i abcd = _mm_srli_epi64(_mm_mul_epu32(abcdefgh, div10000), 45);
+  const __m128i efgh =
+    _mm_sub_epi32(abcdefgh, _mm_mul_epu32(abcd, _mm_set1_epi32(10000)));
+  // [abcd, efgh] * 4 broadcast to [abcd x4, efgh x4]
+  const __m128i halves = _mm_slli_epi64(_mm_unpacklo_epi16(abcd, efgh), 2);
+  const __m128i pairs = _mm_unpacklo_epi16(halves, halves);
+  const __m128i lanes = _mm_unpacklo_epi32(pairs, pairs);
+  // Divide by 1000, 100, 10 and 1: [a, ab, abc, abcd, e, ef, efg, efgh]
+  const __m128i reciprocals =
+    _mm_setr_epi16(8389, 5243, 13108, -32768, 8389, 5243, 13108, -32768);
+  const __m128i shifts = _mm_setr_epi16(
+    1 << 7, 1 << 11, 1 << 13, -32768, 1 << 7, 1 << 11, 1 << 13, -32768);
+  const __m128i prefixes =
+    _mm_mulhi_epu16(_mm_mulhi_epu16(lanes, reciprocals), shifts);
+  // Subtract the prefix one digit shorter times 10
+  const __m128i tens =
+    _mm_slli_epi64(_mm_mullo_epi16(prefixes, _mm_set1_epi16(10)), 16);
+  return _mm_sub_epi16(prefixes, tens);
+}
+
+/** Drop leading zero digits of bytes, keep at least the last one. */
+__attribute__((target("sse4.1"))) inline int
+join_block(__m128i digits, int last, char8_t* buffer)
+{
+  const __m128i zero = _mm_cmpeq_epi8(digits, _mm_setzero_si128());
+  const uint32_t zeros = static_cast<uint32_t>(_mm_movemask_epi8(zero));
+  const int skip = __builtin_ctz(~zeros | (1U << last));
+  const __m128i ascii = _mm_add_epi8(digits, _mm_set1_epi8('0'));
+  const __m128i shuffle =
+    _mm_loadu_si128(reinterpret_cast<const __m128i*>(JOIN_SKIP + skip));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(buffer),
+                   _mm_shuffle_epi8(ascii, shuffle));
+  return last + 1 - skip;
+}
+
+template<typename U>
+__attribute__((target("sse4.1"), always_inline)) inline int
+join_unsigned(U x, char8_t* buffer)
+{
+  constexpr uint64_t BLOCK8 = 100000000;
+  constexpr uint64_t BLOCK16 = BLOCK8 * BLOCK8;
+  if (x < BLOCK8) {
+    const __m128i digits = join_digits8(static_cast<uint32_t>(x));
+    return join_block(_mm_packus_epi16(digits, digits), 7, buffer);
+  }
+  int length = 0;
+  if (x >= BLOCK16) {
+    // Up to 4 digits above the lower 16, which keep leading zeros
+    auto high = static_cast<uint32_t>(x / BLOCK16);
+    x -= high * BLOCK16;
+    length = high >= 1000 ? 4 : high >= 100 ? 3 : high >= 10 ? 2 : 1;
+    for (int i = length - 1; i >= 0; --i) {
+      buffer[i] = static_cast<char8_t>(u8'0' + high % 10);
+      high /= 10;
+    }
+    buffer += length;
+  }
+  const uint64_t high = x / BLOCK8;
+  const __m128i digits =
+    _mm_packus_epi16(join_digits8(static_cast<uint32_t>(high)),
+                     join_digits8(static_cast<uint32_t>(x - high * BLOCK8)));
+  if (length != 0) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(buffer),
+                     _mm_add_epi8(digits, _mm_set1_epi8('0')));
+    return length + 16;
+  }
+  return join_block(digits, 15, buffer);
+}
+
+/** Integer element by SIMD blocks, needs SSE4.1. */
+template<typename T>
+__attribute__((target("sse4.1"), always_inline)) inline int
+join_simd(T x, char8_t* buffer)
+{
+  using U = eastl::make_unsigned_t<T>;
+  if constexpr (eastl::is_signed_v<T>) {
+    const bool sign = x < 0;
+    *buffer = u8'-';
+    const U u = sign ? U(0) - static_cast<U>(x) : static_cast<U>(x);
+    return sign + join_unsigned(u, buffer + sign);
+  } else {
+    return join_unsigned(x, buffer);
+  }
+}
+
+/** The loop is compiled for SSE4.1 too, so that blocks are inlined into it.
+ */
+template<typename T>
+__attribute__((target("sse4.1"))) size_t
+join_elements_simd(const Join<T>& j, char8_t* buffer)
+{
+  return join_elements<T, join_simd<T>>(j, buffer);
+}
+#endif
+
+/** write_join with SCALAR for elements that SIMD blocks do not write:
+ * floats, and integers on CPUs without SSE4.1.
+ *
+ * @param  j      Elements and separator.
+ * @param  buffer At least join_capacity(j) chars, contents past the result
+ *                are unspecified.
+ * @return        Count of written chars.
+ */
+template<typename T, int (*SCALAR)(T, char8_t*)>
+size_t
+write_join_with(const Join<T>& j, char8_t* buffer)
+{
+#if EXTEND_LOG_JOIN_SIMD
+  if constexpr (eastl::is_integral_v<T>) {
+    if (join_has_sse41) {
+      return join_elements_simd(j, buffer);
+    }
+  }
+#endif
+  return join_elements<T, SCALAR>(j, buffer);
+}
+
+}
@@ -21,8 +21,10 @@
 #include <EASTL/string_view.h>
 #include <EASTL/vector.h>
 #include <llvm/Support/ConvertUTF.h>
+#include <log/write_join.h>
 
 #include <cassert>
+#include <charconv>
 #include <sstream>
 
 #include "GetTypeName.h"
@@ -76,6 +78,16 @@ operator<<(std::basic_ostream<char, Traits>& output, const eastl::string& str)
   return output;
 }
 
+/** Element of vector as std::to_chars writes it, for write_join_with(). */
+template<typename T>
+int
+to_chars_element(T x, char8_t* buffer)
+{
+  char* out = reinterpret_cast<char*>(buffer);
+  return std::to_chars(out, out + extend::log::JOIN_ELEMENT_SIZE<T>, x).ptr -
+         out;
+}
+
 template<
   typename T,
   typename Allocator,
@@ -85,8 +97,20 @@ OStream&
 operator<<(OStream& output, const eastl::vector<T, Allocator>& c)
 {
   output << "eastl::vector<" << GetTypeName<T>() << "> {";
-  for (const T& e : c) {
-    output << e << ", ";
+  // Bytes are characters for std::ostream, they keep the element loop
+  if constexpr (extend::log::JOINABLE<T> && sizeof(T) > 1) {
+    const auto j = extend::log::join(c, u8", ");
+    eastl::vector<char8_t> buffer(extend::log::join_capacity(j));
+    const size_t size = extend::log::write_join_with<T, to_chars_element<T>>(
+      j, buffer.data());
+    output.write(reinterpret_cast<const char*>(buffer.data()), size);
+    if (!c.empty()) {
+      output << ", ";
+    }
+  } else {
+    for (const T& e : c) {
+      output << e << ", ";
+    }
   }
   output << "}";
   return output;